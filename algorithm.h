@@ -0,0 +1,144 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_ALGORITHM_H
+#define VECTOR_ALGORITHM_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "simd_kernels.h"
+
+namespace my_vector {
+
+    namespace detail {
+
+    template<typename Container>
+    using element_t = std::remove_const_t<std::remove_pointer_t<decltype(std::declval<Container&>().data())>>;
+
+    template<typename Container>
+    using require_contiguous = std::void_t<decltype(std::declval<Container&>().data()),
+                                           decltype(std::declval<Container&>().size())>;
+
+    } // namespace detail
+
+/**
+ * Linear scans over contiguous containers: vector, devector, small_vector and anything else
+ * with data() and size(). For int32_t, int64_t, float and double the loops run on SSE2, AVX2
+ * or AVX-512, whichever is the widest the CPU supports; other element types use plain loops.
+ * Positions are indices, as elsewhere in the library.
+ */
+
+    /**
+     * @brief Finds the first element equal to value.
+     *
+     * @param c The container to search.
+     * @param value The value to search for.
+     * @return The index of the first match, or c.size() if there is none.
+     */
+    template<typename Container, typename = detail::require_contiguous<Container>>
+    size_t find(const Container& c, const detail::element_t<Container>& value) {
+      return detail::simd::find(c.data(), c.size(), value);
+    }
+
+    /**
+     * @brief Counts the elements equal to value.
+     *
+     * @param c The container to search.
+     * @param value The value to count.
+     * @return The number of matching elements.
+     */
+    template<typename Container, typename = detail::require_contiguous<Container>>
+    size_t count(const Container& c, const detail::element_t<Container>& value) {
+      return detail::simd::count(c.data(), c.size(), value);
+    }
+
+    /**
+     * @brief Checks whether any element equals value.
+     *
+     * @param c The container to search.
+     * @param value The value to search for.
+     * @return True if the value occurs in the container.
+     */
+    template<typename Container, typename = detail::require_contiguous<Container>>
+    bool contains(const Container& c, const detail::element_t<Container>& value) {
+      return find(c, value) != c.size();
+    }
+
+    /**
+     * @brief Adds up the elements.
+     *
+     * Integers are summed in 64 bits, so a sum of int32_t does not overflow. Floating-point
+     * elements are summed in several lanes at once, so the rounding may differ slightly from
+     * a left-to-right loop.
+     *
+     * @param c The container to sum.
+     * @return The sum, zero for an empty container.
+     */
+    template<typename Container, typename = detail::require_contiguous<Container>>
+    detail::simd::sum_t<detail::element_t<Container>> sum(const Container& c) {
+      return detail::simd::sum(c.data(), c.size());
+    }
+
+    /**
+     * @brief Returns the smallest element. The result is unspecified if the elements include NaN.
+     *
+     * @param c The container to scan.
+     * @return A copy of the smallest element.
+     * @throws std::out_of_range if the container is empty.
+     */
+    template<typename Container, typename = detail::require_contiguous<Container>>
+    detail::element_t<Container> min(const Container& c) {
+      if (c.size() == 0) {
+        throw std::out_of_range("Vector is empty");
+      }
+      return detail::simd::min(c.data(), c.size());
+    }
+
+    /**
+     * @brief Returns the largest element. The result is unspecified if the elements include NaN.
+     *
+     * @param c The container to scan.
+     * @return A copy of the largest element.
+     * @throws std::out_of_range if the container is empty.
+     */
+    template<typename Container, typename = detail::require_contiguous<Container>>
+    detail::element_t<Container> max(const Container& c) {
+      if (c.size() == 0) {
+        throw std::out_of_range("Vector is empty");
+      }
+      return detail::simd::max(c.data(), c.size());
+    }
+
+    /**
+     * @brief Returns the smallest and the largest element, found in a single pass.
+     *
+     * @param c The container to scan.
+     * @return The smallest element first and the largest second.
+     * @throws std::out_of_range if the container is empty.
+     */
+    template<typename Container, typename = detail::require_contiguous<Container>>
+    std::pair<detail::element_t<Container>, detail::element_t<Container>> minmax(const Container& c) {
+      if (c.size() == 0) {
+        throw std::out_of_range("Vector is empty");
+      }
+      return detail::simd::minmax(c.data(), c.size());
+    }
+
+    /**
+     * @brief Assigns value to every element.
+     *
+     * @param c The container to fill.
+     * @param value The value to assign.
+     */
+    template<typename Container, typename = detail::require_contiguous<Container>>
+    void fill(Container& c, const detail::element_t<Container>& value) {
+      detail::simd::fill(c.data(), c.size(), value);
+    }
+
+} // namespace my_vector
+
+#endif //VECTOR_ALGORITHM_H
@@ -0,0 +1,149 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_ASYNC_IO_H
+#define VECTOR_ASYNC_IO_H
+
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <type_traits>
+
+#include <sys/types.h>
+
+#include "vector.h"
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#error "async_io.h needs a POSIX system"
+#endif
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define MY_VECTOR_HAS_IO_URING 1
+#endif
+#endif
+
+#ifndef MY_VECTOR_HAS_IO_URING
+#define MY_VECTOR_HAS_IO_URING 0
+#endif
+
+namespace my_vector {
+
+/**
+ * Asynchronous bulk reads and writes between files and vectors of trivially copyable elements.
+ *
+ * A transfer is split into chunks that are queued at once, so the device sees many requests
+ * in flight and the caller is free to compute while they complete. On Linux the chunks go
+ * through a shared io_uring instance, whose completions are reaped by one internal thread.
+ * Elsewhere, or when io_uring cannot be set up or lacks the read and write opcodes (kernels
+ * before 5.6, seccomp filters, kernel.io_uring_disabled), the chunks run as blocking
+ * pread/pwrite calls on a dedicated I/O thread pool.
+ *
+ * The vector and the file descriptor must stay alive and untouched until the transfer
+ * completes. Completion is reported through a std::future or a callback. Callbacks run on
+ * an internal I/O thread, or before the call returns for empty transfers. They must not
+ * throw and should only hand the result on.
+ *
+ * For files opened with O_DIRECT, the file offset, the vector's data() and the chunk size
+ * must be multiples of the alignment. A vector with huge_page_allocator is page aligned
+ * once it is larger than the allocator's threshold. Reads round the last chunk up to the
+ * alignment and need spare capacity for it, which async_read_into reserves.
+ */
+
+    /**
+     * @brief Selects how a transfer is carried out.
+     */
+    enum class io_backend {
+        automatic, /// io_uring when available, otherwise the thread pool
+        io_uring, /// io_uring; transfers fail with ENOSYS where it is unavailable
+        thread_pool /// Blocking pread/pwrite calls on the I/O thread pool
+    };
+
+    /**
+     * @brief Tuning for an asynchronous transfer.
+     */
+    struct async_io_options {
+        size_t chunk_bytes = size_t(1) << 20; /// Bytes per submitted request, rounded up to alignment
+        size_t alignment = 0; /// O_DIRECT alignment in bytes; 0 picks 4096 for O_DIRECT descriptors and 1 otherwise
+        io_backend backend = io_backend::automatic; /// How the chunks are submitted
+    };
+
+    /**
+     * @brief Returns the backend io_backend::automatic resolves to in this process.
+     */
+    inline io_backend default_io_backend() noexcept;
+
+    /**
+     * @brief Starts reading count elements from a file into the vector.
+     *
+     * The vector is resized to count elements before the call returns; its previous contents
+     * are discarded. If the file ends early, the vector is shrunk to the elements that were
+     * read completely before the callback runs. If the transfer fails, the vector is cleared.
+     *
+     * @param vec The vector to read into.
+     * @param fd The file to read from.
+     * @param offset The byte offset in the file to start reading at.
+     * @param count The number of elements to read.
+     * @param options Chunk size, alignment and backend.
+     * @param done Called as done(std::exception_ptr error, size_t elements) when the transfer
+     *             completes. error holds a std::system_error if a read failed.
+     * @throws std::invalid_argument if an O_DIRECT transfer is not aligned. The vector is left
+     *         unchanged in that case.
+     */
+    template<typename T, typename Allocator, typename GrowthPolicy, typename Callback>
+    void async_read_into(vector<T, Allocator, GrowthPolicy>& vec, int fd, off_t offset, size_t count,
+                         const async_io_options& options, Callback done);
+
+    /**
+     * @brief Starts reading count elements from a file into the vector.
+     *
+     * See the callback overload for how the vector changes.
+     *
+     * @param vec The vector to read into.
+     * @param fd The file to read from.
+     * @param offset The byte offset in the file to start reading at.
+     * @param count The number of elements to read.
+     * @param options Chunk size, alignment and backend.
+     * @return A future for the number of elements read. It throws std::system_error if a read failed.
+     * @throws std::invalid_argument if an O_DIRECT transfer is not aligned.
+     */
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    std::future<size_t> async_read_into(vector<T, Allocator, GrowthPolicy>& vec, int fd, off_t offset, size_t count,
+                                        const async_io_options& options = async_io_options());
+
+    /**
+     * @brief Starts writing all elements of the vector to a file.
+     *
+     * @param vec The vector to write.
+     * @param fd The file to write to.
+     * @param offset The byte offset in the file to start writing at.
+     * @param options Chunk size, alignment and backend.
+     * @param done Called as done(std::exception_ptr error, size_t elements) when the transfer
+     *             completes. error holds a std::system_error if a write failed.
+     * @throws std::invalid_argument if an O_DIRECT transfer is not aligned, including a byte
+     *         length that is not a multiple of the alignment.
+     */
+    template<typename T, typename Allocator, typename GrowthPolicy, typename Callback>
+    void async_write_from(const vector<T, Allocator, GrowthPolicy>& vec, int fd, off_t offset,
+                          const async_io_options& options, Callback done);
+
+    /**
+     * @brief Starts writing all elements of the vector to a file.
+     *
+     * @param vec The vector to write.
+     * @param fd The file to write to.
+     * @param offset The byte offset in the file to start writing at.
+     * @param options Chunk size, alignment and backend.
+     * @return A future for the number of elements written. It throws std::system_error if a write failed.
+     * @throws std::invalid_argument if an O_DIRECT transfer is not aligned.
+     */
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    std::future<size_t> async_write_from(const vector<T, Allocator, GrowthPolicy>& vec, int fd, off_t offset,
+                                         const async_io_options& options = async_io_options());
+
+} // namespace my_vector
+
+#include "async_io_impl.h"
+
+#endif //VECTOR_ASYNC_IO_H
@@ -0,0 +1,620 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "posix_io.h"
+#include "thread_pool.h"
+
+#if MY_VECTOR_HAS_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+namespace my_vector {
+
+    namespace detail {
+
+    struct io_transfer;
+
+    /**
+     * @brief One submitted request of a transfer.
+     */
+    struct io_chunk {
+        io_transfer* owner; /// The transfer the chunk belongs to
+        char* data; /// Start of the chunk in the vector
+        size_t length; /// Bytes in the chunk
+        off_t offset; /// File offset of the chunk
+        size_t done; /// Bytes transferred so far
+        io_chunk* next; /// Links chunks the ring rejected, which are finished once its lock is released
+    };
+
+    /**
+     * @brief The shared state of a transfer. Deletes itself once the last chunk finished.
+     */
+    struct io_transfer {
+        bool write; /// Whether the chunks write to the file
+        bool direct; /// Whether the file uses O_DIRECT, so a short read means end of file
+        int fd; /// The file
+        size_t chunk_count; /// Number of chunks
+        std::unique_ptr<io_chunk[]> chunks; /// The chunks, in file order
+        std::atomic<size_t> pending; /// Chunks not finished yet
+        std::atomic<int> error; /// The first errno seen, or 0
+        std::function<void(std::exception_ptr, size_t)> done; /// Receives the error or the byte count
+
+        io_transfer(bool write, bool direct, int fd, size_t chunk_count,
+                    std::function<void(std::exception_ptr, size_t)> done)
+            : write(write), direct(direct), fd(fd), chunk_count(chunk_count), chunks(new io_chunk[chunk_count]),
+              pending(chunk_count), error(0), done(std::move(done)) {}
+
+      /**
+       * @brief Records an errno, keeping the first one.
+       */
+        void fail(int code) noexcept {
+          int expected = 0;
+          error.compare_exchange_strong(expected, code, std::memory_order_relaxed);
+        }
+
+      /**
+       * @brief Marks one chunk as finished; the last one reports the result and deletes the transfer.
+       */
+        void chunk_finished() {
+          if (pending.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return;
+          }
+          std::exception_ptr failure;
+          size_t bytes = 0;
+          if (const int code = error.load(std::memory_order_relaxed)) {
+            failure = std::make_exception_ptr(std::system_error(code, std::generic_category(),
+                                                                write ? "async_io: write" : "async_io: read"));
+          } else {
+            // Only the bytes before the first short chunk count; anything after it is past the end of file.
+            for (size_t i = 0; i < chunk_count; ++i) {
+              bytes += chunks[i].done;
+              if (chunks[i].done < chunks[i].length) {
+                break;
+              }
+            }
+          }
+          std::function<void(std::exception_ptr, size_t)> callback = std::move(done);
+          delete this;
+          callback(failure, bytes);
+        }
+    };
+
+    /**
+     * @brief Returns the pool that runs blocking transfers.
+     *
+     * It is separate from the compute pool and has at least four workers, since its threads
+     * spend their time waiting on the device rather than using a core.
+     */
+    inline thread_pool& io_pool() {
+      static thread_pool pool(std::max(4u, std::thread::hardware_concurrency()));
+      return pool;
+    }
+
+    /**
+     * @brief Runs one chunk with blocking pread/pwrite calls.
+     */
+    inline void run_blocking(io_chunk& chunk) noexcept {
+      io_transfer& transfer = *chunk.owner;
+      while (chunk.done < chunk.length) {
+        char* data = chunk.data + chunk.done;
+        const size_t length = chunk.length - chunk.done;
+        const off_t offset = chunk.offset + static_cast<off_t>(chunk.done);
+        const ssize_t got = transfer.write ? ::pwrite(transfer.fd, data, length, offset)
+                                           : ::pread(transfer.fd, data, length, offset);
+        if (got < 0) {
+          if (errno == EINTR) {
+            continue;
+          }
+          transfer.fail(errno);
+          break;
+        }
+        if (got == 0) {
+          if (transfer.write) {
+            transfer.fail(EIO);
+          }
+          break;
+        }
+        chunk.done += static_cast<size_t>(got);
+        if (!transfer.write && transfer.direct && static_cast<size_t>(got) < length) {
+          break;
+        }
+      }
+    }
+
+#if MY_VECTOR_HAS_IO_URING && defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) \
+    && defined(__NR_io_uring_register)
+#define MY_VECTOR_USE_IO_URING 1
+
+/**
+ * @brief The io_uring instance shared by all transfers, driven through the raw system calls.
+ *
+ * Submissions are serialized by a mutex. At most sq_entries requests are in flight, which
+ * keeps the completion queue (twice as large) from overflowing; further chunks wait in a
+ * backlog that completions drain. One reaper thread waits for completions, resubmits
+ * interrupted or short requests and finishes chunks.
+ */
+    class io_ring {
+        int fd_; /// The ring
+        void* sq_map_; /// Mapping of the submission ring
+        size_t sq_map_bytes_; /// Length of sq_map_
+        void* cq_map_; /// Mapping of the completion ring; equals sq_map_ with IORING_FEAT_SINGLE_MMAP
+        size_t cq_map_bytes_; /// Length of cq_map_
+        io_uring_sqe* sqes_; /// The submission queue entries
+        size_t sqes_bytes_; /// Length of the sqes_ mapping
+        unsigned* sq_tail_; /// Submission ring tail, written by us
+        unsigned sq_mask_; /// Submission ring index mask
+        unsigned* sq_array_; /// Submission ring slots, each naming an entry of sqes_
+        unsigned* cq_head_; /// Completion ring head, written by us
+        unsigned* cq_tail_; /// Completion ring tail, written by the kernel
+        unsigned cq_mask_; /// Completion ring index mask
+        io_uring_cqe* cqes_; /// The completion queue entries
+        unsigned entries_; /// Submission ring size, the limit on requests in flight
+
+        std::mutex mutex_; /// Guards the submission ring, the counters and backlog_
+        std::condition_variable idle_; /// Signalled when no request is in flight or being completed
+        unsigned in_flight_; /// Requests handed to the ring and not yet completed
+        unsigned completing_; /// Completions being handled by the reaper, which may resubmit
+        std::deque<io_chunk*> backlog_; /// Chunks waiting for room in the ring
+        std::thread reaper_; /// Waits for and handles completions
+
+        static int enter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags) noexcept {
+          return static_cast<int>(::syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0));
+        }
+
+      /**
+       * @brief Adds a request to the submission ring and hands it to the kernel.
+       *
+       * Must be called with mutex_ held and in_flight_ below entries_. A null chunk submits
+       * the no-op that stops the reaper. If io_uring_enter fails for good, the entry is taken
+       * back out of the ring and the chunk, failed with that errno, is added to rejected.
+       */
+        void push_locked(io_chunk* chunk, io_chunk*& rejected) noexcept {
+          const unsigned tail = *sq_tail_;
+          const unsigned index = tail & sq_mask_;
+          io_uring_sqe& sqe = sqes_[index];
+          std::memset(&sqe, 0, sizeof(sqe));
+          if (chunk) {
+            const io_transfer& transfer = *chunk->owner;
+            sqe.opcode = transfer.write ? IORING_OP_WRITE : IORING_OP_READ;
+            sqe.fd = transfer.fd;
+            sqe.off = static_cast<uint64_t>(chunk->offset) + chunk->done;
+            sqe.addr = reinterpret_cast<uintptr_t>(chunk->data + chunk->done);
+            sqe.len = static_cast<unsigned>(chunk->length - chunk->done);
+          } else {
+            sqe.opcode = IORING_OP_NOP;
+          }
+          sqe.user_data = reinterpret_cast<uintptr_t>(chunk);
+          sq_array_[index] = index;
+          __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+          ++in_flight_;
+          for (;;) {
+            const int submitted = enter(fd_, 1, 0, 0);
+            if (submitted > 0) {
+              return;
+            }
+            if (submitted < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+              break;
+            }
+          }
+          // The kernel only reads the ring inside io_uring_enter, so the entry can still be withdrawn.
+          const int code = errno;
+          __atomic_store_n(sq_tail_, tail, __ATOMIC_RELEASE);
+          --in_flight_;
+          if (chunk) {
+            chunk->owner->fail(code);
+            chunk->next = rejected;
+            rejected = chunk;
+          }
+        }
+
+      /**
+       * @brief Finishes the chunks push_locked rejected. Must be called without mutex_ held.
+       */
+        static void finish_rejected(io_chunk* rejected) {
+          while (rejected) {
+            // Finishing the last chunk deletes the transfer, and the chunk with it.
+            io_chunk* next = rejected->next;
+            rejected->owner->chunk_finished();
+            rejected = next;
+          }
+        }
+
+      /**
+       * @brief Handles one completion, resubmitting the rest of a short or interrupted request.
+       */
+        void complete(io_chunk* chunk, int result) {
+          io_transfer& transfer = *chunk->owner;
+          if (result == -EINTR || result == -EAGAIN) {
+            submit(chunk);
+            return;
+          }
+          if (result < 0) {
+            transfer.fail(-result);
+          } else if (result == 0) {
+            if (transfer.write) {
+              transfer.fail(EIO);
+            }
+          } else {
+            chunk->done += static_cast<size_t>(result);
+            if (chunk->done < chunk->length && (transfer.write || !transfer.direct)) {
+              submit(chunk);
+              return;
+            }
+          }
+          transfer.chunk_finished();
+        }
+
+      /**
+       * @brief The reaper thread: drains the completion ring until the stop no-op arrives.
+       */
+        void reap() {
+          for (;;) {
+            unsigned head = *cq_head_;
+            const unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+            if (head == tail) {
+              enter(fd_, 0, 1, IORING_ENTER_GETEVENTS);
+              continue;
+            }
+            for (; head != tail; ++head) {
+              const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+              io_chunk* chunk = reinterpret_cast<io_chunk*>(static_cast<uintptr_t>(cqe.user_data));
+              const int result = cqe.res;
+              __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+              if (!chunk) {
+                return;
+              }
+              // Taking the lock also orders this thread after the submitter for the chunk's fields.
+              io_chunk* rejected = nullptr;
+              {
+                std::lock_guard<std::mutex> lock(mutex_);
+                --in_flight_;
+                ++completing_;
+                // A rejected push leaves room, so the backlog keeps draining until the ring is full.
+                while (!backlog_.empty() && in_flight_ < entries_) {
+                  io_chunk* next = backlog_.front();
+                  backlog_.pop_front();
+                  push_locked(next, rejected);
+                }
+              }
+              finish_rejected(rejected);
+              complete(chunk, result);
+              std::lock_guard<std::mutex> lock(mutex_);
+              if (--completing_ == 0 && in_flight_ == 0) {
+                idle_.notify_all();
+              }
+            }
+          }
+        }
+
+        io_ring() : fd_(-1), sq_map_(MAP_FAILED), sq_map_bytes_(0), cq_map_(MAP_FAILED), cq_map_bytes_(0),
+                    sqes_(static_cast<io_uring_sqe*>(MAP_FAILED)), sqes_bytes_(0), in_flight_(0), completing_(0) {}
+
+      /**
+       * @brief Checks that the kernel knows IORING_OP_READ and IORING_OP_WRITE.
+       *
+       * Both arrived in Linux 5.6, together with IORING_REGISTER_PROBE, so an older kernel
+       * that can set up a ring fails the probe itself.
+       */
+        bool supports_transfers() const noexcept {
+          constexpr unsigned probed_ops = 256;
+          alignas(io_uring_probe) unsigned char buffer[sizeof(io_uring_probe) + probed_ops * sizeof(io_uring_probe_op)] {};
+          auto* probe = reinterpret_cast<io_uring_probe*>(buffer);
+          if (::syscall(__NR_io_uring_register, fd_, IORING_REGISTER_PROBE, probe, probed_ops) < 0) {
+            return false;
+          }
+          const auto supported = [probe](unsigned op) {
+            return op <= probe->last_op && (probe->ops[op].flags & IO_URING_OP_SUPPORTED) != 0;
+          };
+          return supported(IORING_OP_READ) && supported(IORING_OP_WRITE);
+        }
+
+      /**
+       * @brief Sets up the ring and starts the reaper.
+       *
+       * @return Whether io_uring is usable, which includes supporting the read and write opcodes.
+       */
+        bool open(unsigned entries) {
+          io_uring_params params {};
+          fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+          if (fd_ < 0 || !supports_transfers()) {
+            return false;
+          }
+          sq_map_bytes_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+          cq_map_bytes_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+          const bool single_map = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+          if (single_map) {
+            sq_map_bytes_ = cq_map_bytes_ = std::max(sq_map_bytes_, cq_map_bytes_);
+          }
+          sq_map_ = ::mmap(nullptr, sq_map_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_,
+                           IORING_OFF_SQ_RING);
+          if (sq_map_ == MAP_FAILED) {
+            return false;
+          }
+          cq_map_ = single_map ? sq_map_
+                               : ::mmap(nullptr, cq_map_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_,
+                                        IORING_OFF_CQ_RING);
+          if (cq_map_ == MAP_FAILED) {
+            return false;
+          }
+          sqes_bytes_ = params.sq_entries * sizeof(io_uring_sqe);
+          void* sqes = ::mmap(nullptr, sqes_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_,
+                              IORING_OFF_SQES);
+          if (sqes == MAP_FAILED) {
+            return false;
+          }
+          sqes_ = static_cast<io_uring_sqe*>(sqes);
+          char* sq = static_cast<char*>(sq_map_);
+          char* cq = static_cast<char*>(cq_map_);
+          sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+          sq_mask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+          sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+          cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+          cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+          cq_mask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+          cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+          entries_ = params.sq_entries;
+          reaper_ = std::thread([this] { reap(); });
+          return true;
+        }
+    public:
+        io_ring(const io_ring&) = delete;
+        io_ring& operator=(const io_ring&) = delete;
+
+        /**
+         * @brief Waits for the requests in flight, stops the reaper and closes the ring.
+         */
+        ~io_ring() {
+          if (reaper_.joinable()) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            idle_.wait(lock, [this] { return in_flight_ == 0 && completing_ == 0; });
+            io_chunk* rejected = nullptr;
+            push_locked(nullptr, rejected);
+            lock.unlock();
+            reaper_.join();
+          }
+          if (sqes_ != MAP_FAILED) {
+            ::munmap(sqes_, sqes_bytes_);
+          }
+          if (cq_map_ != MAP_FAILED && cq_map_ != sq_map_) {
+            ::munmap(cq_map_, cq_map_bytes_);
+          }
+          if (sq_map_ != MAP_FAILED) {
+            ::munmap(sq_map_, sq_map_bytes_);
+          }
+          if (fd_ >= 0) {
+            ::close(fd_);
+          }
+        }
+
+        /**
+         * @brief Queues a chunk, or parks it in the backlog while the ring is full.
+         */
+        void submit(io_chunk* chunk) {
+          io_chunk* rejected = nullptr;
+          {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (in_flight_ < entries_) {
+              push_locked(chunk, rejected);
+            } else {
+              backlog_.push_back(chunk);
+            }
+          }
+          finish_rejected(rejected);
+        }
+
+        /**
+         * @brief Returns the shared ring, or nullptr if io_uring cannot be used.
+         */
+        static io_ring* instance() {
+          static const std::unique_ptr<io_ring> ring = [] {
+            std::unique_ptr<io_ring> created(new io_ring());
+            if (!created->open(128)) {
+              created.reset();
+            }
+            return created;
+          }();
+          return ring.get();
+        }
+    };
+
+#else
+#define MY_VECTOR_USE_IO_URING 0
+#endif
+
+    /**
+     * @brief Returns the alignment transfers on fd need, see async_io_options::alignment.
+     */
+    inline size_t io_alignment(int fd, const async_io_options& options) noexcept {
+      if (options.alignment != 0) {
+        return options.alignment;
+      }
+#ifdef O_DIRECT
+      const int flags = ::fcntl(fd, F_GETFL);
+      if (flags >= 0 && (flags & O_DIRECT) != 0) {
+        return 4096;
+      }
+#else
+      (void) fd;
+#endif
+      return 1;
+    }
+
+    /**
+     * @brief Splits a byte range into chunks and submits them to the selected backend.
+     *
+     * Failures after the transfer is set up are reported through done, like I/O errors.
+     */
+    inline void start_transfer(bool write, int fd, char* data, size_t bytes, off_t offset, size_t alignment,
+                               const async_io_options& options, std::function<void(std::exception_ptr, size_t)> done) {
+      // io_uring takes 32-bit lengths.
+      size_t chunk_bytes = std::min(std::max(options.chunk_bytes, size_t(1)), size_t(1) << 30);
+      chunk_bytes = (chunk_bytes + alignment - 1) / alignment * alignment;
+      const size_t chunk_count = (bytes + chunk_bytes - 1) / chunk_bytes;
+      if (chunk_count == 0) {
+        done(nullptr, 0);
+        return;
+      }
+
+#if MY_VECTOR_USE_IO_URING
+      io_ring* ring = options.backend == io_backend::thread_pool ? nullptr : io_ring::instance();
+#else
+      void* ring = nullptr;
+#endif
+      if (!ring && options.backend == io_backend::io_uring) {
+        done(std::make_exception_ptr(std::system_error(ENOSYS, std::generic_category(), "async_io: io_uring")), 0);
+        return;
+      }
+
+      io_transfer* transfer = new io_transfer(write, alignment > 1, fd, chunk_count, std::move(done));
+      for (size_t i = 0; i < chunk_count; ++i) {
+        const size_t start = i * chunk_bytes;
+        transfer->chunks[i] = {transfer, data + start, std::min(chunk_bytes, bytes - start),
+                               offset + static_cast<off_t>(start), 0, nullptr};
+      }
+      size_t submitted = 0;
+      try {
+        for (; submitted < chunk_count; ++submitted) {
+          io_chunk* chunk = &transfer->chunks[submitted];
+#if MY_VECTOR_USE_IO_URING
+          if (ring) {
+            ring->submit(chunk);
+            continue;
+          }
+#endif
+          io_pool().submit([chunk] {
+            run_blocking(*chunk);
+            chunk->owner->chunk_finished();
+          });
+        }
+      } catch (...) {
+        // Chunks already submitted finish on their own; the transfer reports the failure once they have.
+        transfer->fail(ENOMEM);
+        for (size_t i = submitted; i < chunk_count; ++i) {
+          transfer->chunk_finished();
+        }
+      }
+    }
+
+    } // namespace detail
+
+    inline io_backend default_io_backend() noexcept {
+#if MY_VECTOR_USE_IO_URING
+      try {
+        return detail::io_ring::instance() ? io_backend::io_uring : io_backend::thread_pool;
+      } catch (...) {
+        return io_backend::thread_pool;
+      }
+#else
+      return io_backend::thread_pool;
+#endif
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy, typename Callback>
+    void async_read_into(vector<T, Allocator, GrowthPolicy>& vec, int fd, off_t offset, size_t count,
+                         const async_io_options& options, Callback done) {
+      static_assert(std::is_trivially_copyable<T>::value, "async_read_into fills the vector with raw file bytes");
+      static_assert(std::is_trivially_default_constructible<T>::value,
+                    "async_read_into leaves the elements uninitialized until the read completes");
+      const size_t alignment = detail::io_alignment(fd, options);
+      const size_t bytes = count * sizeof(T);
+      const size_t read_bytes = (bytes + alignment - 1) / alignment * alignment;
+      if (offset % static_cast<off_t>(alignment) != 0) {
+        throw std::invalid_argument("async_io: offset is not a multiple of the O_DIRECT alignment");
+      }
+      const size_t capacity = (read_bytes + sizeof(T) - 1) / sizeof(T);
+      const auto misaligned = [alignment](const T* data) {
+        return reinterpret_cast<uintptr_t>(data) % alignment != 0;
+      };
+      if (alignment > 1 && (vec.capacity() < capacity || misaligned(vec.data()))) {
+        // The storage is checked before vec is touched, so a misaligned allocation keeps the caller's elements.
+        vector<T, Allocator, GrowthPolicy> storage(vec.get_allocator());
+        storage.ensure_capacity(capacity);
+        if (misaligned(storage.data())) {
+          throw std::invalid_argument("async_io: data() is not aligned for O_DIRECT");
+        }
+        vec.swap(storage);
+      }
+      vec.clear();
+      vec.ensure_capacity(capacity);
+      vec.resize_for_overwrite(count);
+      detail::start_transfer(false, fd, reinterpret_cast<char*>(vec.data()), read_bytes, offset, alignment, options,
+                             [&vec, count, done = std::move(done)](std::exception_ptr error, size_t read) mutable {
+                               if (error) {
+                                 vec.clear();
+                                 done(error, 0);
+                                 return;
+                               }
+                               const size_t elements = std::min(count, read / sizeof(T));
+                               vec.resize_for_overwrite(elements);
+                               done(nullptr, elements);
+                             });
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    std::future<size_t> async_read_into(vector<T, Allocator, GrowthPolicy>& vec, int fd, off_t offset, size_t count,
+                                        const async_io_options& options) {
+      auto promise = std::make_shared<std::promise<size_t>>();
+      std::future<size_t> result = promise->get_future();
+      async_read_into(vec, fd, offset, count, options, [promise](std::exception_ptr error, size_t elements) {
+        if (error) {
+          promise->set_exception(error);
+        } else {
+          promise->set_value(elements);
+        }
+      });
+      return result;
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy, typename Callback>
+    void async_write_from(const vector<T, Allocator, GrowthPolicy>& vec, int fd, off_t offset,
+                          const async_io_options& options, Callback done) {
+      static_assert(std::is_trivially_copyable<T>::value, "async_write_from writes the raw element bytes");
+      const size_t alignment = detail::io_alignment(fd, options);
+      const size_t bytes = vec.size() * sizeof(T);
+      if (offset % static_cast<off_t>(alignment) != 0 || bytes % alignment != 0
+          || reinterpret_cast<uintptr_t>(vec.data()) % alignment != 0) {
+        throw std::invalid_argument("async_io: O_DIRECT write is not aligned");
+      }
+      detail::start_transfer(true, fd, reinterpret_cast<char*>(const_cast<T*>(vec.data())), bytes, offset, alignment,
+                             options, [done = std::move(done)](std::exception_ptr error, size_t written) mutable {
+                               done(error, error ? 0 : written / sizeof(T));
+                             });
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    std::future<size_t> async_write_from(const vector<T, Allocator, GrowthPolicy>& vec, int fd, off_t offset,
+                                         const async_io_options& options) {
+      auto promise = std::make_shared<std::promise<size_t>>();
+      std::future<size_t> result = promise->get_future();
+      async_write_from(vec, fd, offset, options, [promise](std::exception_ptr error, size_t elements) {
+        if (error) {
+          promise->set_exception(error);
+        } else {
+          promise->set_value(elements);
+        }
+      });
+      return result;
+    }
+
+} // namespace my_vector
@@ -0,0 +1,104 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+// Loads several files into vectors and sums each one, first with one blocking read per file
+// and then with all reads started up front, summing every vector as soon as it arrives.
+// The page cache is dropped for each file before every run, so the reads hit the device.
+//
+// Usage: async_load [directory] [files] [megabytes per file]
+
+#include "../algorithm.h"
+#include "../async_io.h"
+#include "../posix_io.h"
+#include "../vector.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <future>
+#include <iostream>
+#include <string>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+
+    volatile int64_t sink;
+
+    template<typename F>
+    double seconds(F&& f) {
+      const auto start = std::chrono::steady_clock::now();
+      f();
+      return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    void drop_cache(const my_vector::vector<int>& fds) {
+      for (size_t i = 0; i < fds.size(); ++i) {
+        ::fdatasync(fds[i]);
+        ::posix_fadvise(fds[i], 0, 0, POSIX_FADV_DONTNEED);
+      }
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+  const std::string directory = argc > 1 ? argv[1] : ".";
+  const size_t files = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 8;
+  const size_t megabytes = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 256;
+  const size_t count = megabytes * (size_t(1) << 20) / sizeof(int64_t);
+
+  my_vector::vector<int> fds;
+  {
+    my_vector::vector<int64_t> data(count, 1);
+    for (size_t i = 0; i < files; ++i) {
+      const std::string path = directory + "/async_load_" + std::to_string(i) + ".bin";
+      const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+      if (fd < 0) {
+        my_vector::detail::throw_errno("open");
+      }
+      ::unlink(path.c_str());
+      my_vector::detail::write_all_at(fd, data.data(), count * sizeof(int64_t), 0);
+      fds.push_back(fd);
+    }
+  }
+  std::cout << files << " files of " << megabytes << " MiB, backend "
+            << (my_vector::default_io_backend() == my_vector::io_backend::io_uring ? "io_uring" : "thread pool") << "\n";
+
+  my_vector::vector<my_vector::vector<int64_t>> vectors;
+  for (size_t i = 0; i < files; ++i) {
+    vectors.emplace_back();
+  }
+
+  drop_cache(fds);
+  const double blocking = seconds([&] {
+    int64_t total = 0;
+    for (size_t i = 0; i < files; ++i) {
+      vectors[i].resize_for_overwrite(count);
+      my_vector::detail::read_all(fds[i], vectors[i].data(), count * sizeof(int64_t), 0);
+      total += my_vector::sum(vectors[i]);
+    }
+    sink = total;
+  });
+
+  drop_cache(fds);
+  const double overlapped = seconds([&] {
+    my_vector::vector<std::future<size_t>> pending;
+    for (size_t i = 0; i < files; ++i) {
+      pending.push_back(my_vector::async_read_into(vectors[i], fds[i], 0, count));
+    }
+    int64_t total = 0;
+    for (size_t i = 0; i < files; ++i) {
+      pending[i].get();
+      total += my_vector::sum(vectors[i]);
+    }
+    sink = total;
+  });
+
+  std::cout << "blocking: " << blocking << " s, async: " << overlapped << " s (" << blocking / overlapped << "x)\n";
+  for (size_t i = 0; i < fds.size(); ++i) {
+    ::close(fds[i]);
+  }
+  return 0;
+}
@@ -0,0 +1,55 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+// Times the size-and-value constructor, the copy constructor and resize(n, value) of a
+// multi-gigabyte vector, first on one thread and then on the thread pool.
+//
+// Usage: parallel_construct [megabytes]
+
+#include "../vector.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+
+namespace {
+
+    template<typename F>
+    double seconds(F&& f) {
+      const auto start = std::chrono::steady_clock::now();
+      f();
+      return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    void run(size_t count, const char* mode) {
+      double fill = 0;
+      double copy = 0;
+      double grow = 0;
+      {
+        my_vector::vector<uint64_t> source;
+        fill = seconds([&] { source = my_vector::vector<uint64_t>(count, 42); });
+        copy = seconds([&] { my_vector::vector<uint64_t> copied(source); });
+        source.clear_and_free();
+        source.ensure_capacity(count);
+        grow = seconds([&] { source.resize(count, 7); });
+      }
+      std::cout << mode << ": fill " << fill << " s, copy " << copy << " s, resize " << grow << " s\n";
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+  const size_t megabytes = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2048;
+  const size_t count = megabytes * (size_t(1) << 20) / sizeof(uint64_t);
+  std::cout << megabytes << " MiB, " << std::thread::hardware_concurrency() << " hardware threads\n";
+
+  my_vector::set_parallel_threshold(my_vector::parallel_disabled);
+  run(count, "serial");
+
+  my_vector::set_parallel_threshold(size_t(64) << 20);
+  run(count, "parallel");
+  return 0;
+}
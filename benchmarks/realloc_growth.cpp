@@ -0,0 +1,148 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+// Compares growing a vector<uint64_t> with std::allocator, which allocates a new block and
+// copies on every reallocation, against realloc_allocator, which grows the block with realloc
+// below its 1 MiB mmap threshold and with mremap above it. Each case grows the vector two
+// ways: push_back with the default doubling, and ensure_capacity in fixed steps with a policy
+// that takes exactly the requested capacity, as a reader that reserves block by block would.
+// Every case runs in a child process, so its peak RSS is its own.
+//
+// Usage: realloc_growth [megabytes] [repetitions]
+
+#include "../realloc_allocator.h"
+#include "../vector.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+    /**
+     * Takes exactly the capacity asked for, so every ensure_capacity() step reallocates.
+     */
+    struct exact_growth {
+        static size_t next_capacity(size_t /*capacity*/, size_t required, size_t /*element_size*/) noexcept {
+          return required;
+        }
+    };
+
+    struct result {
+        double seconds;
+        long peak_rss_kib;
+    };
+
+    volatile uint64_t sink;
+
+    template<typename Allocator>
+    void grow_by_push_back(size_t count) {
+      my_vector::vector<uint64_t, Allocator> values;
+      for (size_t i = 0; i < count; ++i) {
+        values.push_back(i);
+      }
+      sink = values[count - 1];
+    }
+
+    template<typename Allocator>
+    void grow_by_steps(size_t count, size_t step) {
+      my_vector::vector<uint64_t, Allocator, exact_growth> values;
+      for (size_t capacity = step; capacity <= count; capacity += step) {
+        values.ensure_capacity(capacity);
+        while (values.size() < capacity) {
+          values.push_back(values.size());
+        }
+      }
+      sink = values[values.size() - 1];
+    }
+
+    /**
+     * Runs f repetitions times in a child process and reports its time and peak RSS.
+     */
+    template<typename F>
+    result in_child(size_t repetitions, F&& f) {
+      int fds[2];
+      if (::pipe(fds) != 0) {
+        std::perror("pipe");
+        std::exit(1);
+      }
+      const pid_t child = ::fork();
+      if (child < 0) {
+        std::perror("fork");
+        std::exit(1);
+      }
+      if (child == 0) {
+        ::close(fds[0]);
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < repetitions; ++i) {
+          f();
+        }
+        result measured {};
+        measured.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        rusage usage {};
+        ::getrusage(RUSAGE_SELF, &usage);
+        measured.peak_rss_kib = usage.ru_maxrss;
+        const ssize_t written = ::write(fds[1], &measured, sizeof(measured));
+        ::_exit(written == sizeof(measured) ? 0 : 1);
+      }
+      ::close(fds[1]);
+      result measured {};
+      const ssize_t read = ::read(fds[0], &measured, sizeof(measured));
+      ::close(fds[0]);
+      int status = 0;
+      ::waitpid(child, &status, 0);
+      if (read != sizeof(measured) || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        std::cerr << "benchmark child failed\n";
+        std::exit(1);
+      }
+      return measured;
+    }
+
+    void report(const char* name, const result& standard, const result& realloc) {
+      std::cout << "  " << name << ": std::allocator " << standard.seconds << " s, peak " << standard.peak_rss_kib / 1024
+                << " MiB; realloc_allocator " << realloc.seconds << " s, peak " << realloc.peak_rss_kib / 1024
+                << " MiB; speedup " << standard.seconds / realloc.seconds << "x\n";
+    }
+
+    template<typename Allocator>
+    result push_back_case(size_t count, size_t repetitions) {
+      return in_child(repetitions, [count] { grow_by_push_back<Allocator>(count); });
+    }
+
+    template<typename Allocator>
+    result steps_case(size_t count, size_t step, size_t repetitions) {
+      return in_child(repetitions, [count, step] { grow_by_steps<Allocator>(count, step); });
+    }
+
+    void run(const char* range, size_t bytes, size_t step_bytes, size_t repetitions) {
+      using standard = std::allocator<uint64_t>;
+      using growable = my_vector::realloc_allocator<uint64_t>;
+      const size_t count = bytes / sizeof(uint64_t);
+      const size_t step = step_bytes / sizeof(uint64_t);
+      std::cout << range << " range: grow to " << bytes / 1024 << " KiB, " << repetitions << " repetitions\n";
+      report("push_back", push_back_case<standard>(count, repetitions), push_back_case<growable>(count, repetitions));
+      report("ensure_capacity steps", steps_case<standard>(count, step, repetitions),
+             steps_case<growable>(count, step, repetitions));
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+  const size_t megabytes = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 256;
+  const size_t repetitions = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 500;
+
+  // Stays below the 1 MiB mmap threshold, so realloc_allocator grows with realloc.
+  run("realloc", size_t(768) << 10, size_t(32) << 10, repetitions);
+
+  // Crosses the threshold early, so realloc_allocator grows with mremap.
+  run("mremap", megabytes << 20, size_t(8) << 20, 1);
+  return 0;
+}
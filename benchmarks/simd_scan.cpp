@@ -0,0 +1,77 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+// Compares the scans in algorithm.h with the matching std:: algorithms on the same data,
+// for int32_t, float and double.
+//
+// Usage: simd_scan [elements] [repetitions]
+
+#include "../algorithm.h"
+#include "../vector.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <random>
+
+namespace {
+
+    volatile double sink;
+
+    template<typename F>
+    double milliseconds(size_t repetitions, F&& f) {
+      const auto start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < repetitions; ++i) {
+        sink = static_cast<double>(f());
+      }
+      return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / repetitions;
+    }
+
+    void report(const char* name, double simd, double standard) {
+      std::cout << "  " << name << ": " << simd << " ms vs " << standard << " ms (" << standard / simd << "x)\n";
+    }
+
+    template<typename T>
+    void run(const char* type, size_t count, size_t repetitions) {
+      my_vector::vector<T> v;
+      v.ensure_capacity(count);
+      std::mt19937 rng(42);
+      for (size_t i = 0; i < count; ++i) {
+        v.push_back(static_cast<T>(rng() % 1000000));
+      }
+      const T missing = static_cast<T>(-1);
+      const T* first = v.data();
+      const T* last = v.data() + v.size();
+
+      std::cout << type << ", " << count << " elements\n";
+      report("find", milliseconds(repetitions, [&] { return my_vector::find(v, missing); }),
+             milliseconds(repetitions, [&] { return std::find(first, last, missing) - first; }));
+      report("count", milliseconds(repetitions, [&] { return my_vector::count(v, T(7)); }),
+             milliseconds(repetitions, [&] { return std::count(first, last, T(7)); }));
+      report("sum", milliseconds(repetitions, [&] { return my_vector::sum(v); }),
+             milliseconds(repetitions, [&] { return std::accumulate(first, last, my_vector::detail::simd::sum_t<T>(0)); }));
+      report("min", milliseconds(repetitions, [&] { return my_vector::min(v); }),
+             milliseconds(repetitions, [&] { return *std::min_element(first, last); }));
+      report("max", milliseconds(repetitions, [&] { return my_vector::max(v); }),
+             milliseconds(repetitions, [&] { return *std::max_element(first, last); }));
+      report("minmax", milliseconds(repetitions, [&] { return my_vector::minmax(v).first; }),
+             milliseconds(repetitions, [&] { return *std::minmax_element(first, last).first; }));
+      report("fill", milliseconds(repetitions, [&] { my_vector::fill(v, T(3)); return v[0]; }),
+             milliseconds(repetitions, [&] { std::fill(v.data(), v.data() + v.size(), T(3)); return v[0]; }));
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+  const size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : size_t(1) << 20;
+  const size_t repetitions = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 100;
+  std::cout << "instruction set level " << static_cast<int>(my_vector::detail::simd::current_isa()) << "\n";
+  run<int32_t>("int32_t", count, repetitions);
+  run<float>("float", count, repetitions);
+  run<double>("double", count, repetitions);
+  return 0;
+}
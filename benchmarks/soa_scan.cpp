@@ -0,0 +1,105 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+// Compares scans over particles stored as an array of structures (vector<particle>) with the
+// same scans over a soa_vector, which keeps each field in its own array. The scans read one
+// field, then two.
+//
+// Usage: soa_scan [elements] [repetitions]
+
+#include "../algorithm.h"
+#include "../soa_vector.h"
+#include "../vector.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+namespace {
+
+    struct particle {
+        float x, y, z;
+        float vx, vy, vz;
+        float mass;
+        int32_t id;
+    };
+
+    using particles = my_vector::soa_vector<float, float, float, float, float, float, float, int32_t>;
+
+    volatile double sink;
+
+    template<typename F>
+    double milliseconds(size_t repetitions, F&& f) {
+      const auto start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < repetitions; ++i) {
+        sink = static_cast<double>(f());
+      }
+      return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / repetitions;
+    }
+
+    void report(const char* name, double soa, double aos) {
+      std::cout << "  " << name << ": " << soa << " ms vs " << aos << " ms (" << aos / soa << "x)\n";
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+  const size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : size_t(1) << 22;
+  const size_t repetitions = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 50;
+
+  my_vector::vector<particle> aos;
+  particles soa;
+  aos.ensure_capacity(count);
+  soa.ensure_capacity(count);
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  for (size_t i = 0; i < count; ++i) {
+    const particle p{dist(rng), dist(rng), dist(rng), dist(rng), dist(rng), dist(rng), 1.0f + dist(rng),
+                     static_cast<int32_t>(i)};
+    aos.push_back(p);
+    soa.emplace_back(p.x, p.y, p.z, p.vx, p.vy, p.vz, p.mass, p.id);
+  }
+
+  std::cout << count << " particles, " << sizeof(particle) << " bytes each, soa_vector vs vector<particle>\n";
+  report("sum of x", milliseconds(repetitions, [&] {
+    float sum = 0;
+    for (float x : soa.field<0>()) {
+      sum += x;
+    }
+    return sum;
+  }), milliseconds(repetitions, [&] {
+    float sum = 0;
+    for (size_t i = 0; i < aos.size(); ++i) {
+      sum += aos[i].x;
+    }
+    return sum;
+  }));
+  report("sum of x, algorithm.h", milliseconds(repetitions, [&] {
+    return my_vector::sum(soa.field<0>());
+  }), milliseconds(repetitions, [&] {
+    double sum = 0;
+    for (size_t i = 0; i < aos.size(); ++i) {
+      sum += aos[i].x;
+    }
+    return sum;
+  }));
+  report("sum of x * vx", milliseconds(repetitions, [&] {
+    const float* x = soa.data<0>();
+    const float* vx = soa.data<3>();
+    float sum = 0;
+    for (size_t i = 0; i < soa.size(); ++i) {
+      sum += x[i] * vx[i];
+    }
+    return sum;
+  }), milliseconds(repetitions, [&] {
+    float sum = 0;
+    for (size_t i = 0; i < aos.size(); ++i) {
+      sum += aos[i].x * aos[i].vx;
+    }
+    return sum;
+  }));
+  return 0;
+}
@@ -0,0 +1,306 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_BIT_KERNELS_H
+#define VECTOR_BIT_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "simd.h"
+
+namespace my_vector {
+
+    namespace detail {
+
+    namespace simd {
+
+    /**
+     * @brief A word-wise operation combine_words applies, dst = dst op src.
+     */
+    enum class bit_op {
+        and_,
+        or_,
+        xor_,
+        and_not
+    };
+
+    template<bit_op Op>
+    constexpr uint64_t apply_bit_op(uint64_t dst, uint64_t src) noexcept {
+      if constexpr (Op == bit_op::and_) {
+        return dst & src;
+      } else if constexpr (Op == bit_op::or_) {
+        return dst | src;
+      } else if constexpr (Op == bit_op::xor_) {
+        return dst ^ src;
+      } else {
+        return dst & ~src;
+      }
+    }
+
+    namespace scalar {
+
+    inline size_t popcount_words(const uint64_t* words, size_t n) noexcept {
+      size_t total = 0;
+      for (size_t i = 0; i < n; ++i) {
+        total += static_cast<size_t>(__builtin_popcountll(words[i]));
+      }
+      return total;
+    }
+
+    template<bit_op Op>
+    void combine_words(uint64_t* dst, const uint64_t* src, size_t n) noexcept {
+      for (size_t i = 0; i < n; ++i) {
+        dst[i] = apply_bit_op<Op>(dst[i], src[i]);
+      }
+    }
+
+    inline unsigned select_in_word(uint64_t word, unsigned k) noexcept {
+      for (; k > 0; --k) {
+        word &= word - 1;
+      }
+      return static_cast<unsigned>(__builtin_ctzll(word));
+    }
+
+    } // namespace scalar
+
+#if defined(MY_VECTOR_SIMD_X86)
+    /**
+     * @brief CPU features beyond the isa levels that only the bit kernels use.
+     */
+    struct bit_features {
+        bool popcnt;
+        bool bmi2;
+        bool avx512_popcount;
+    };
+
+    inline bit_features detect_bit_features() noexcept {
+      __builtin_cpu_init();
+      return {__builtin_cpu_supports("popcnt") != 0, __builtin_cpu_supports("bmi2") != 0,
+              __builtin_cpu_supports("avx512vpopcntdq") != 0};
+    }
+
+    inline const bit_features& current_bit_features() noexcept {
+      static const bit_features features = detect_bit_features();
+      return features;
+    }
+
+    /**
+     * @brief Counts with the popcnt instruction, which plain -O2 code does not use without -mpopcnt.
+     */
+    __attribute__((target("popcnt"))) inline size_t popcount_words_popcnt(const uint64_t* words, size_t n) noexcept {
+      // Four counters keep popcnt's false dependency on its output from serializing the loop.
+      size_t total0 = 0, total1 = 0, total2 = 0, total3 = 0;
+      size_t i = 0;
+      for (; i + 4 <= n; i += 4) {
+        total0 += static_cast<size_t>(__builtin_popcountll(words[i]));
+        total1 += static_cast<size_t>(__builtin_popcountll(words[i + 1]));
+        total2 += static_cast<size_t>(__builtin_popcountll(words[i + 2]));
+        total3 += static_cast<size_t>(__builtin_popcountll(words[i + 3]));
+      }
+      for (; i < n; ++i) {
+        total0 += static_cast<size_t>(__builtin_popcountll(words[i]));
+      }
+      return total0 + total1 + total2 + total3;
+    }
+
+    /**
+     * @brief Counts 256 bits at a time: a nibble lookup with pshufb, summed per word with psadbw.
+     */
+    MY_VECTOR_TARGET_AVX2 inline size_t popcount_words_avx2(const uint64_t* words, size_t n) noexcept {
+      const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                              0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+      const __m256i low_nibbles = _mm256_set1_epi8(0x0f);
+      __m256i totals = _mm256_setzero_si256();
+      size_t i = 0;
+      for (; i + 4 <= n; i += 4) {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + i));
+        const __m256i low = _mm256_shuffle_epi8(lookup, _mm256_and_si256(block, low_nibbles));
+        const __m256i high = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(block, 4), low_nibbles));
+        totals = _mm256_add_epi64(totals, _mm256_sad_epu8(_mm256_add_epi8(low, high), _mm256_setzero_si256()));
+      }
+      alignas(32) uint64_t lanes[4];
+      _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), totals);
+      size_t total = static_cast<size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+      for (; i < n; ++i) {
+        total += static_cast<size_t>(__builtin_popcountll(words[i]));
+      }
+      return total;
+    }
+
+    template<bit_op Op>
+    MY_VECTOR_TARGET_SSE2 inline __m128i apply_bit_op(__m128i dst, __m128i src) noexcept {
+      if constexpr (Op == bit_op::and_) {
+        return _mm_and_si128(dst, src);
+      } else if constexpr (Op == bit_op::or_) {
+        return _mm_or_si128(dst, src);
+      } else if constexpr (Op == bit_op::xor_) {
+        return _mm_xor_si128(dst, src);
+      } else {
+        return _mm_andnot_si128(src, dst);
+      }
+    }
+
+    template<bit_op Op>
+    MY_VECTOR_TARGET_AVX2 inline __m256i apply_bit_op(__m256i dst, __m256i src) noexcept {
+      if constexpr (Op == bit_op::and_) {
+        return _mm256_and_si256(dst, src);
+      } else if constexpr (Op == bit_op::or_) {
+        return _mm256_or_si256(dst, src);
+      } else if constexpr (Op == bit_op::xor_) {
+        return _mm256_xor_si256(dst, src);
+      } else {
+        return _mm256_andnot_si256(src, dst);
+      }
+    }
+
+    template<bit_op Op>
+    MY_VECTOR_TARGET_SSE2 void combine_words_sse2(uint64_t* dst, const uint64_t* src, size_t n) noexcept {
+      size_t i = 0;
+      for (; i + 2 <= n; i += 2) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), apply_bit_op<Op>(a, b));
+      }
+      for (; i < n; ++i) {
+        dst[i] = apply_bit_op<Op>(dst[i], src[i]);
+      }
+    }
+
+    template<bit_op Op>
+    MY_VECTOR_TARGET_AVX2 void combine_words_avx2(uint64_t* dst, const uint64_t* src, size_t n) noexcept {
+      size_t i = 0;
+      for (; i + 4 <= n; i += 4) {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), apply_bit_op<Op>(a, b));
+      }
+      for (; i < n; ++i) {
+        dst[i] = apply_bit_op<Op>(dst[i], src[i]);
+      }
+    }
+
+    // GCC 12's AVX-512 headers trip -Wmaybe-uninitialized on their own _mm512_undefined_* helpers.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+    /**
+     * @brief Counts 512 bits at a time with vpopcntq.
+     */
+    __attribute__((target("avx512f,avx512vpopcntdq"))) inline size_t popcount_words_avx512(const uint64_t* words,
+                                                                                         size_t n) noexcept {
+      __m512i totals = _mm512_setzero_si512();
+      size_t i = 0;
+      for (; i + 8 <= n; i += 8) {
+        totals = _mm512_add_epi64(totals, _mm512_popcnt_epi64(_mm512_loadu_si512(words + i)));
+      }
+      if (i < n) {
+        const __mmask8 tail = static_cast<__mmask8>((1u << (n - i)) - 1);
+        totals = _mm512_add_epi64(totals, _mm512_popcnt_epi64(_mm512_maskz_loadu_epi64(tail, words + i)));
+      }
+      return static_cast<size_t>(_mm512_reduce_add_epi64(totals));
+    }
+
+    template<bit_op Op>
+    MY_VECTOR_TARGET_AVX512 inline __m512i apply_bit_op(__m512i dst, __m512i src) noexcept {
+      if constexpr (Op == bit_op::and_) {
+        return _mm512_and_si512(dst, src);
+      } else if constexpr (Op == bit_op::or_) {
+        return _mm512_or_si512(dst, src);
+      } else if constexpr (Op == bit_op::xor_) {
+        return _mm512_xor_si512(dst, src);
+      } else {
+        return _mm512_andnot_si512(src, dst);
+      }
+    }
+
+    template<bit_op Op>
+    MY_VECTOR_TARGET_AVX512 void combine_words_avx512(uint64_t* dst, const uint64_t* src, size_t n) noexcept {
+      size_t i = 0;
+      for (; i + 8 <= n; i += 8) {
+        const __m512i a = _mm512_loadu_si512(dst + i);
+        const __m512i b = _mm512_loadu_si512(src + i);
+        _mm512_storeu_si512(dst + i, apply_bit_op<Op>(a, b));
+      }
+      if (i < n) {
+        const __mmask8 tail = static_cast<__mmask8>((1u << (n - i)) - 1);
+        const __m512i a = _mm512_maskz_loadu_epi64(tail, dst + i);
+        const __m512i b = _mm512_maskz_loadu_epi64(tail, src + i);
+        _mm512_mask_storeu_epi64(dst + i, tail, apply_bit_op<Op>(a, b));
+      }
+    }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+    /**
+     * @brief Deposits a single bit at the position of the k-th set bit with pdep.
+     */
+    __attribute__((target("bmi,bmi2"))) inline unsigned select_in_word_bmi2(uint64_t word, unsigned k) noexcept {
+      return static_cast<unsigned>(_tzcnt_u64(_pdep_u64(uint64_t(1) << k, word)));
+    }
+#endif
+
+    /**
+     * @brief Returns the number of set bits in n words.
+     */
+    inline size_t popcount_words(const uint64_t* words, size_t n) noexcept {
+#if defined(MY_VECTOR_SIMD_X86)
+      const bit_features& features = current_bit_features();
+      if (features.avx512_popcount && current_isa() >= isa::avx512) {
+        return popcount_words_avx512(words, n);
+      }
+      if (current_isa() >= isa::avx2) {
+        return popcount_words_avx2(words, n);
+      }
+      if (features.popcnt) {
+        return popcount_words_popcnt(words, n);
+      }
+#endif
+      return scalar::popcount_words(words, n);
+    }
+
+    /**
+     * @brief Combines n words of src into dst word by word, dst[i] = dst[i] op src[i].
+     */
+    template<bit_op Op>
+    void combine_words(uint64_t* dst, const uint64_t* src, size_t n) noexcept {
+#if defined(MY_VECTOR_SIMD_X86)
+      const isa level = current_isa();
+      if (level >= isa::avx512) {
+        return combine_words_avx512<Op>(dst, src, n);
+      }
+      if (level >= isa::avx2) {
+        return combine_words_avx2<Op>(dst, src, n);
+      }
+      if (level >= isa::sse2) {
+        return combine_words_sse2<Op>(dst, src, n);
+      }
+#endif
+      scalar::combine_words<Op>(dst, src, n);
+    }
+
+    /**
+     * @brief Returns the position of the set bit of word with rank k, counting from zero.
+     *
+     * word must have more than k set bits.
+     */
+    inline unsigned select_in_word(uint64_t word, unsigned k) noexcept {
+#if defined(MY_VECTOR_SIMD_X86)
+      if (current_bit_features().bmi2) {
+        return select_in_word_bmi2(word, k);
+      }
+#endif
+      return scalar::select_in_word(word, k);
+    }
+
+    } // namespace simd
+
+    } // namespace detail
+
+} // namespace my_vector
+
+#endif //VECTOR_BIT_KERNELS_H
@@ -0,0 +1,595 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_BIT_VECTOR_H
+#define VECTOR_BIT_VECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include "bit_kernels.h"
+#include "span.h"
+#include "vector.h"
+
+namespace my_vector {
+
+    namespace detail {
+
+/**
+ * @brief Proxy reference to one bit of a bit_vector.
+ */
+    class bit_reference {
+        uint64_t* word_; /// The word that holds the bit
+        uint64_t mask_; /// The bit within the word
+    public:
+        bit_reference(uint64_t* word, uint64_t mask) noexcept : word_(word), mask_(mask) {}
+        bit_reference(const bit_reference& other) noexcept = default;
+
+        operator bool() const noexcept { return (*word_ & mask_) != 0; }
+        bool operator~() const noexcept { return (*word_ & mask_) == 0; }
+
+        bit_reference& operator=(bool value) noexcept {
+          *word_ = value ? *word_ | mask_ : *word_ & ~mask_;
+          return *this;
+        }
+
+        bit_reference& operator=(const bit_reference& other) noexcept { return *this = static_cast<bool>(other); }
+
+        /**
+         * @brief Inverts the bit.
+         */
+        void flip() noexcept { *word_ ^= mask_; }
+
+        friend void swap(bit_reference a, bit_reference b) noexcept {
+          const bool value = a;
+          a = static_cast<bool>(b);
+          b = value;
+        }
+    };
+
+/**
+ * @brief Random-access iterator over the bits of a bit_vector.
+ *
+ * @tparam Const True for const iterators, which dereference to bool.
+ */
+    template<bool Const>
+    class bit_iterator {
+        using word_pointer = std::conditional_t<Const, const uint64_t*, uint64_t*>;
+
+        word_pointer words;
+        size_t index;
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = bool;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = std::conditional_t<Const, bool, bit_reference>;
+
+        bit_iterator() noexcept : words(nullptr), index(0) {}
+        bit_iterator(word_pointer words, size_t index) noexcept : words(words), index(index) {}
+
+        /**
+         * @brief Converts an iterator into a const_iterator.
+         */
+        template<bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+        bit_iterator(const bit_iterator<OtherConst>& other) noexcept : words(other.base()), index(other.position()) {}
+
+        /**
+         * @brief Returns the words the iterator refers into.
+         */
+        word_pointer base() const noexcept { return words; }
+
+        /**
+         * @brief Returns the index of the bit the iterator refers to.
+         */
+        size_t position() const noexcept { return index; }
+
+        reference operator*() const noexcept { return (*this)[0]; }
+
+        reference operator[](difference_type n) const noexcept {
+          const size_t bit = index + n;
+          if constexpr (Const) {
+            return (words[bit / 64] >> (bit % 64)) & 1;
+          } else {
+            return bit_reference(words + bit / 64, uint64_t(1) << (bit % 64));
+          }
+        }
+
+        bit_iterator& operator++() noexcept { ++index; return *this; }
+        bit_iterator operator++(int) noexcept { bit_iterator tmp = *this; ++index; return tmp; }
+        bit_iterator& operator--() noexcept { --index; return *this; }
+        bit_iterator operator--(int) noexcept { bit_iterator tmp = *this; --index; return tmp; }
+        bit_iterator& operator+=(difference_type n) noexcept { index += n; return *this; }
+        bit_iterator& operator-=(difference_type n) noexcept { index -= n; return *this; }
+
+        friend bit_iterator operator+(bit_iterator it, difference_type n) noexcept { return it += n; }
+        friend bit_iterator operator+(difference_type n, bit_iterator it) noexcept { return it += n; }
+        friend bit_iterator operator-(bit_iterator it, difference_type n) noexcept { return it -= n; }
+
+        template<bool C>
+        difference_type operator-(const bit_iterator<C>& other) const noexcept {
+          return static_cast<difference_type>(index) - static_cast<difference_type>(other.position());
+        }
+
+        template<bool C>
+        bool operator==(const bit_iterator<C>& other) const noexcept { return index == other.position(); }
+        template<bool C>
+        bool operator!=(const bit_iterator<C>& other) const noexcept { return index != other.position(); }
+        template<bool C>
+        bool operator<(const bit_iterator<C>& other) const noexcept { return index < other.position(); }
+        template<bool C>
+        bool operator>(const bit_iterator<C>& other) const noexcept { return index > other.position(); }
+        template<bool C>
+        bool operator<=(const bit_iterator<C>& other) const noexcept { return index <= other.position(); }
+        template<bool C>
+        bool operator>=(const bit_iterator<C>& other) const noexcept { return index >= other.position(); }
+    };
+
+    } // namespace detail
+
+/**
+ * @brief A vector of bits packed 64 to a word, for bitmaps and bitmap indexes.
+ *
+ * Takes one bit per element instead of the byte vector<bool> uses. Besides element access
+ * through bit_reference proxies, it works on whole words: count() uses popcount, find_first()
+ * and find_next() skip zero words, and the &=, |=, ^= and and_not operations combine two
+ * vectors 128 to 512 bits at a time with SSE2, AVX2 or AVX-512, whichever the CPU supports.
+ * rank() and select() scan the words; rank_select_index answers both in constant or
+ * logarithmic time for a vector that no longer changes.
+ *
+ * The bits past size() in the last word are always zero, so the word operations never have
+ * to mask them.
+ *
+ * @tparam Allocator The allocator used to obtain the 64-bit words.
+ */
+    template<typename Allocator = std::allocator<uint64_t>>
+    class bit_vector {
+        static_assert(std::is_same<typename Allocator::value_type, uint64_t>::value,
+                      "bit_vector allocates uint64_t words");
+
+        static constexpr size_t word_bits = 64;
+
+        vector<uint64_t, Allocator> words_; /// The bits, lowest index in the lowest bit of the first word
+        size_t size_; /// Number of bits
+
+      /**
+       * @brief Returns the number of words that hold the given number of bits.
+       */
+        static constexpr size_t words_for(size_t bits) noexcept;
+
+      /**
+       * @brief Returns the mask of the bits in use in the last word, all ones if it is full.
+       */
+        uint64_t tail_mask() const noexcept;
+
+      /**
+       * @brief Clears the bits past size() in the last word.
+       */
+        void clear_tail() noexcept;
+
+      /**
+       * @brief Throws std::out_of_range unless index < size().
+       */
+        void check_index(size_t index) const;
+
+      /**
+       * @brief Throws std::invalid_argument unless the other vector has the same size.
+       */
+        void check_same_size(const bit_vector& other) const;
+
+      /**
+       * @brief Checks if the vector is empty.
+       *
+       * @return True if the vector is empty, false otherwise.
+       */
+        bool is_empty() const noexcept;
+    public:
+        using value_type = bool;
+        using allocator_type = Allocator;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = detail::bit_reference;
+        using const_reference = bool;
+        using iterator = detail::bit_iterator<false>;
+        using const_iterator = detail::bit_iterator<true>;
+
+        /**
+         * @brief Default constructor.
+         *
+         * Creates an empty vector without allocating.
+         */
+        bit_vector() noexcept(std::is_nothrow_default_constructible<Allocator>::value);
+
+        /**
+         * @brief Constructs an empty vector that obtains its words from the given allocator.
+         *
+         * @param alloc The allocator to use.
+         */
+        explicit bit_vector(const Allocator& alloc) noexcept;
+
+        /**
+         * @brief Constructor with size and value.
+         *
+         * @param size The number of bits.
+         * @param value The value of every bit.
+         * @param alloc The allocator to use.
+         */
+        explicit bit_vector(size_t size, bool value = false, const Allocator& alloc = Allocator());
+
+        /**
+         * @brief Constructor with initializer list.
+         *
+         * @param init The bits, first element first.
+         * @param alloc The allocator to use.
+         */
+        bit_vector(std::initializer_list<bool> init, const Allocator& alloc = Allocator());
+
+        bit_vector(const bit_vector& other) = default;
+        bit_vector& operator=(const bit_vector& other) = default;
+
+        /**
+         * @brief Move constructor. Leaves the other vector empty.
+         *
+         * @param other The vector to move from.
+         */
+        bit_vector(bit_vector&& other) noexcept;
+
+        /**
+         * @brief Move assignment operator. Leaves the other vector empty.
+         *
+         * @param other The vector to move from.
+         * @return A reference to the assigned vector.
+         */
+        bit_vector& operator=(bit_vector&& other)
+            noexcept(std::is_nothrow_move_assignable<vector<uint64_t, Allocator>>::value);
+
+        /**
+         * @brief Appends a bit.
+         *
+         * @param value The bit to append.
+         */
+        void push_back(bool value);
+
+        /**
+         * @brief Removes the last bit.
+         *
+         * @throws std::out_of_range if the vector is empty.
+         */
+        void pop_back();
+
+        /**
+         * @brief Changes the number of bits, giving new ones the specified value.
+         *
+         * @param new_size The new number of bits.
+         * @param value The value of the new bits.
+         */
+        void resize(size_t new_size, bool value = false);
+
+        /**
+         * @brief Accesses the bit at the specified position.
+         *
+         * @param index The position of the bit.
+         * @return A proxy reference to the bit.
+         */
+        reference operator[] (size_t index) noexcept;
+
+        /**
+         * @brief Returns the bit at the specified position.
+         *
+         * @param index The position of the bit.
+         */
+        bool operator[] (size_t index) const noexcept;
+
+        /**
+         * @brief Accesses the bit at the specified position with bounds checking.
+         *
+         * @param index The position of the bit.
+         * @return A proxy reference to the bit.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        reference at(size_t index);
+
+        /**
+         * @brief Returns the bit at the specified position with bounds checking.
+         *
+         * @param index The position of the bit.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        bool at(size_t index) const;
+
+        /**
+         * @brief Sets the bit at the specified position to the given value.
+         *
+         * @param index The position of the bit.
+         * @param value The new value.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        void set(size_t index, bool value = true);
+
+        /**
+         * @brief Clears the bit at the specified position.
+         *
+         * @param index The position of the bit.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        void reset(size_t index);
+
+        /**
+         * @brief Inverts the bit at the specified position.
+         *
+         * @param index The position of the bit.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        void flip(size_t index);
+
+        /**
+         * @brief Sets every bit.
+         */
+        void set() noexcept;
+
+        /**
+         * @brief Clears every bit.
+         */
+        void reset() noexcept;
+
+        /**
+         * @brief Inverts every bit.
+         */
+        void flip() noexcept;
+
+        /**
+         * @brief Returns the number of set bits.
+         */
+        [[nodiscard]] size_t count() const noexcept;
+
+        /**
+         * @brief Checks whether any bit is set.
+         */
+        [[nodiscard]] bool any() const noexcept;
+
+        /**
+         * @brief Checks whether no bit is set.
+         */
+        [[nodiscard]] bool none() const noexcept;
+
+        /**
+         * @brief Returns the position of the first set bit.
+         *
+         * @return The position, or size() if no bit is set.
+         */
+        [[nodiscard]] size_t find_first() const noexcept;
+
+        /**
+         * @brief Returns the position of the first set bit after the given position.
+         *
+         * @param index The position to search after. Any value is allowed.
+         * @return The position, or size() if no later bit is set.
+         */
+        [[nodiscard]] size_t find_next(size_t index) const noexcept;
+
+        /**
+         * @brief Returns the number of set bits before the given position.
+         *
+         * Scans the words; use rank_select_index for many queries on an unchanging vector.
+         *
+         * @param index The position, at most size().
+         * @throws std::out_of_range if the index is greater than size().
+         */
+        [[nodiscard]] size_t rank(size_t index) const;
+
+        /**
+         * @brief Returns the position of the set bit with the given rank, counting from zero.
+         *
+         * Scans the words; use rank_select_index for many queries on an unchanging vector.
+         *
+         * @param rank The number of set bits before the one to find.
+         * @return The position, or size() if fewer bits are set.
+         */
+        [[nodiscard]] size_t select(size_t rank) const noexcept;
+
+        /**
+         * @brief Keeps the bits that are also set in the other vector.
+         *
+         * @param other A vector of the same size.
+         * @return A reference to this vector.
+         * @throws std::invalid_argument if the sizes differ.
+         */
+        bit_vector& operator&=(const bit_vector& other);
+
+        /**
+         * @brief Sets the bits that are set in the other vector.
+         *
+         * @param other A vector of the same size.
+         * @return A reference to this vector.
+         * @throws std::invalid_argument if the sizes differ.
+         */
+        bit_vector& operator|=(const bit_vector& other);
+
+        /**
+         * @brief Inverts the bits that are set in the other vector.
+         *
+         * @param other A vector of the same size.
+         * @return A reference to this vector.
+         * @throws std::invalid_argument if the sizes differ.
+         */
+        bit_vector& operator^=(const bit_vector& other);
+
+        /**
+         * @brief Clears the bits that are set in the other vector.
+         *
+         * @param other A vector of the same size.
+         * @return A reference to this vector.
+         * @throws std::invalid_argument if the sizes differ.
+         */
+        bit_vector& and_not(const bit_vector& other);
+
+        /**
+         * @brief Returns a copy with every bit inverted.
+         */
+        bit_vector operator~() const;
+
+        /**
+         * @brief Returns the 64-bit words that hold the bits; bits past size() are zero.
+         */
+        span<const uint64_t> words() const noexcept;
+
+        /**
+         * @brief Returns an iterator to the first bit.
+         */
+        iterator begin() noexcept;
+
+        /**
+         * @brief Returns an iterator to the first bit.
+         */
+        const_iterator begin() const noexcept;
+
+        /**
+         * @brief Returns an iterator past the last bit.
+         */
+        iterator end() noexcept;
+
+        /**
+         * @brief Returns an iterator past the last bit.
+         */
+        const_iterator end() const noexcept;
+
+        /**
+         * @brief Returns a const iterator to the first bit.
+         */
+        const_iterator cbegin() const noexcept;
+
+        /**
+         * @brief Returns a const iterator past the last bit.
+         */
+        const_iterator cend() const noexcept;
+
+        /**
+         * @brief Returns the number of bits.
+         */
+        [[nodiscard]] size_t size() const noexcept;
+
+        /**
+         * @brief Returns the number of bits the vector can hold without reallocating.
+         */
+        [[nodiscard]] size_t capacity() const noexcept;
+
+        /**
+         * @brief Ensures that the vector can hold at least the given number of bits.
+         *
+         * @param min_capacity The minimum capacity in bits.
+         */
+        void ensure_capacity(size_t min_capacity);
+
+        /**
+         * @brief Reduces the capacity to the words in use.
+         */
+        void shrink_to_fit();
+
+        /**
+         * @brief Removes all bits but keeps the storage.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Removes all bits and frees the storage.
+         */
+        void clear_and_free() noexcept;
+
+        /**
+         * @brief Exchanges the contents with another vector.
+         *
+         * @param other The vector to swap with.
+         */
+        void swap(bit_vector& other) noexcept;
+
+        /**
+         * @brief Returns the allocator associated with the vector.
+         */
+        allocator_type get_allocator() const noexcept;
+
+        /**
+         * @brief Compares two vectors bit by bit.
+         */
+        friend bool operator==(const bit_vector& lhs, const bit_vector& rhs) noexcept {
+          if (lhs.size_ != rhs.size_) {
+            return false;
+          }
+          const span<const uint64_t> a = lhs.words();
+          const span<const uint64_t> b = rhs.words();
+          for (size_t i = 0; i < a.size(); ++i) {
+            if (a[i] != b[i]) {
+              return false;
+            }
+          }
+          return true;
+        }
+
+        friend bool operator!=(const bit_vector& lhs, const bit_vector& rhs) noexcept { return !(lhs == rhs); }
+
+        friend bit_vector operator&(bit_vector lhs, const bit_vector& rhs) { return lhs &= rhs; }
+        friend bit_vector operator|(bit_vector lhs, const bit_vector& rhs) { return lhs |= rhs; }
+        friend bit_vector operator^(bit_vector lhs, const bit_vector& rhs) { return lhs ^= rhs; }
+    };
+
+/**
+ * @brief Constant-time rank and logarithmic-time select over a bit_vector that no longer changes.
+ *
+ * Stores the number of set bits before every block of 512 bits, which costs one extra bit
+ * for every eight stored. rank() adds the popcounts of at most seven words to one lookup;
+ * select() binary-searches the blocks and then selects within a word with pdep where the
+ * CPU has BMI2. The index refers to the vector's words, so it must be rebuilt after the
+ * vector changes and must not outlive it.
+ */
+    class rank_select_index {
+        static constexpr size_t block_words = 8;
+        static constexpr size_t block_bits = block_words * 64;
+
+        const uint64_t* words_; /// The indexed bits
+        size_t size_; /// Number of indexed bits
+        vector<uint64_t> ranks_; /// Set bits before each block, followed by the total
+    public:
+        /**
+         * @brief Builds the index for a bit vector.
+         *
+         * @param bits The vector to index.
+         */
+        template<typename Allocator>
+        explicit rank_select_index(const bit_vector<Allocator>& bits);
+
+        /**
+         * @brief Returns the number of set bits before the given position.
+         *
+         * @param index The position, at most size().
+         * @throws std::out_of_range if the index is greater than size().
+         */
+        [[nodiscard]] size_t rank(size_t index) const;
+
+        /**
+         * @brief Returns the position of the set bit with the given rank, counting from zero.
+         *
+         * @param rank The number of set bits before the one to find.
+         * @return The position, or size() if fewer bits are set.
+         */
+        [[nodiscard]] size_t select(size_t rank) const noexcept;
+
+        /**
+         * @brief Returns the number of set bits.
+         */
+        [[nodiscard]] size_t count() const noexcept;
+
+        /**
+         * @brief Returns the number of indexed bits.
+         */
+        [[nodiscard]] size_t size() const noexcept;
+    };
+
+} // namespace my_vector
+
+#include "bit_vector_impl.h"
+
+#endif //VECTOR_BIT_VECTOR_H
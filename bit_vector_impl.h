@@ -0,0 +1,422 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace my_vector {
+
+    template<typename Allocator>
+    constexpr size_t bit_vector<Allocator>::words_for(size_t bits) noexcept {
+      return bits / word_bits + (bits % word_bits != 0);
+    }
+
+    template<typename Allocator>
+    uint64_t bit_vector<Allocator>::tail_mask() const noexcept {
+      const size_t used = size_ % word_bits;
+      return used == 0 ? ~uint64_t(0) : (uint64_t(1) << used) - 1;
+    }
+
+    template<typename Allocator>
+    void bit_vector<Allocator>::clear_tail() noexcept {
+      if (size_ % word_bits != 0) {
+        words_[words_.size() - 1] &= tail_mask();
+      }
+    }
+
+    template<typename Allocator>
+    void bit_vector<Allocator>::check_index(size_t index) const {
+      if (index >= size_) {
+        throw std::out_of_range("Index out of range");
+      }
+    }
+
+    template<typename Allocator>
+    void bit_vector<Allocator>::check_same_size(const bit_vector& other) const {
+      if (other.size_ != size_) {
+        throw std::invalid_argument("bit_vector: sizes differ");
+      }
+    }
+
+    template<typename Allocator>
+    bool bit_vector<Allocator>::is_empty() const noexcept {
+      return size_ == 0;
+    }
+
+    template<typename Allocator>
+    bit_vector<Allocator>::bit_vector() noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+        : words_(), size_(0) {
+    }
+
+    template<typename Allocator>
+    bit_vector<Allocator>::bit_vector(const Allocator& alloc) noexcept : words_(alloc), size_(0) {
+    }
+
+    template<typename Allocator>
+    bit_vector<Allocator>::bit_vector(size_t size, bool value, const Allocator& alloc)
+        : words_(words_for(size), value ? ~uint64_t(0) : 0, alloc), size_(size) {
+      clear_tail();
+    }
+
+    template<typename Allocator>
+    bit_vector<Allocator>::bit_vector(std::initializer_list<bool> init, const Allocator& alloc)
+        : words_(words_for(init.size()), 0, alloc), size_(init.size()) {
+      size_t index = 0;
+      for (bool value : init) {
+        words_[index / word_bits] |= uint64_t(value) << (index % word_bits);
+        ++index;
+      }
+    }
+
+    template<typename Allocator>
+    bit_vector<Allocator>::bit_vector(bit_vector&& other) noexcept
+        : words_(std::move(other.words_)), size_(std::exchange(other.size_, 0)) {
+    }
+
+    template<typename Allocator>
+    bit_vector<Allocator>& bit_vector<Allocator>::operator=(bit_vector&& other)
+        noexcept(std::is_nothrow_move_assignable<vector<uint64_t, Allocator>>::value) {
+      if (this != &other) {
+        words_ = std::move(other.words_);
+        size_ = std::exchange(other.size_, 0);
+        other.words_.clear();
+      }
+      return *this;
+    }
+
+    template<typename Allocator>
+    void bit_vector<Allocator>::push_back(bool value) {
+      if (size_ % word_bits == 0) {
+        words_.push_back(0);
+      }
+      words_[size_ / word_bits] |= uint64_t(value) << (size_ % word_bits);
+      ++size_;
+    }
+
+    template<typename Allocator>
+    void bit_vector<Allocator>::pop_back() {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      --size_;
+      if (size_ % word_bits == 0) {
+        words_.pop_back();
+      } else {
+        clear_tail();
+      }
+    }
+
+    template<typename Allocator>
+    void bit_vector<Allocator>::resize(size_t new_size, bool value) {
+      if (new_size <= size_) {
+        words_.resize(words_for(new_size));
+        size_ = new_size;
+        clear_tail();
+        return;
+      }
+      if (value && size_ % word_bits != 0) {
+        words_[size_ / word_bits] |= ~tail_mask();
+      }
+      words_.resize(words_for(new_size), value ? ~uint64_t(0) : 0);
+      size_ = new_size;
+      clear_tail();
+    }
+
+    template<typename Allocator>
+    typename bit_vector<Allocator>::reference bit_vector<Allocator>::operator[](size_t index) noexcept {
+      return reference(words_.data() + index / word_bits, uint64_t(1) << (index % word_bits));
+    }
+
+    template<typename Allocator>
+    bool bit_vector<Allocator>::operator[](size_t index) const noexcept {
+      return (words_[index / word_bits] >> (index % word_bits)) & 1;
+    }
+
+    template<typename Allocator>
+    typename bit_vector<Allocator>::reference bit_vector<Allocator>::at(size_t index) {
+      check_index(index);
+      return (*this)[index];
+    }
+
+    template<typename Allocator>
+    bool bit_vector<Allocator>::at(size_t index) const {
+      check_index(index);
+      return (*this)[index];
+    }
+
+    template<typename Allocator>
+    void bit_vector<Allocator>::set(size_t index, bool value) {
+      check_index(index);
+      (*this)[index] = value;
+    }
+
+    template<typename Allocator>
+    void bit_vector<Allocator>::reset(size_t index) {
+      check_index(index);
+      (*this)[index] = false;
+    }
+
+    template<typename Allocator>
+    void bit_vector<Allocator>::flip(size_t index) {
+      check_index(index);
+      (*this)[index].flip();
+    }
+
+    template<typename Allocator>
+    void bit_vector<Allocator>::set() noexcept {
+      std::fill(words_.data(), words_.data() + words_.size(), ~uint64_t(0));
+      clear_tail();
+    }
+
+    template<typename Allocator>
+    void bit_vector<Allocator>::reset() noexcept {
+      std::fill(words_.data(), words_.data() + words_.size(), uint64_t(0));
+    }
+
+    template<typename Allocator>
+    void bit_vector<Allocator>::flip() noexcept {
+      for (size_t i = 0; i < words_.size(); ++i) {
+        words_[i] = ~words_[i];
+      }
+      clear_tail();
+    }
+
+    template<typename Allocator>
+    size_t bit_vector<Allocator>::count() const noexcept {
+      return detail::simd::popcount_words(words_.data(), words_.size());
+    }
+
+    template<typename Allocator>
+    bool bit_vector<Allocator>::any() const noexcept {
+      return find_first() != size_;
+    }
+
+    template<typename Allocator>
+    bool bit_vector<Allocator>::none() const noexcept {
+      return !any();
+    }
+
+    template<typename Allocator>
+    size_t bit_vector<Allocator>::find_first() const noexcept {
+      for (size_t i = 0; i < words_.size(); ++i) {
+        if (words_[i] != 0) {
+          return i * word_bits + static_cast<size_t>(__builtin_ctzll(words_[i]));
+        }
+      }
+      return size_;
+    }
+
+    template<typename Allocator>
+    size_t bit_vector<Allocator>::find_next(size_t index) const noexcept {
+      if (index >= size_ || ++index == size_) {
+        return size_;
+      }
+      size_t word = index / word_bits;
+      uint64_t bits = words_[word] & (~uint64_t(0) << (index % word_bits));
+      while (bits == 0) {
+        if (++word == words_.size()) {
+          return size_;
+        }
+        bits = words_[word];
+      }
+      return word * word_bits + static_cast<size_t>(__builtin_ctzll(bits));
+    }
+
+    template<typename Allocator>
+    size_t bit_vector<Allocator>::rank(size_t index) const {
+      if (index > size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      const size_t full = index / word_bits;
+      size_t total = detail::simd::popcount_words(words_.data(), full);
+      if (index % word_bits != 0) {
+        total += static_cast<size_t>(__builtin_popcountll(words_[full] & ((uint64_t(1) << (index % word_bits)) - 1)));
+      }
+      return total;
+    }
+
+    template<typename Allocator>
+    size_t bit_vector<Allocator>::select(size_t rank) const noexcept {
+      for (size_t i = 0; i < words_.size(); ++i) {
+        const size_t ones = static_cast<size_t>(__builtin_popcountll(words_[i]));
+        if (rank < ones) {
+          return i * word_bits + detail::simd::select_in_word(words_[i], static_cast<unsigned>(rank));
+        }
+        rank -= ones;
+      }
+      return size_;
+    }
+
+    template<typename Allocator>
+    bit_vector<Allocator>& bit_vector<Allocator>::operator&=(const bit_vector& other) {
+      check_same_size(other);
+      detail::simd::combine_words<detail::simd::bit_op::and_>(words_.data(), other.words_.data(), words_.size());
+      return *this;
+    }
+
+    template<typename Allocator>
+    bit_vector<Allocator>& bit_vector<Allocator>::operator|=(const bit_vector& other) {
+      check_same_size(other);
+      detail::simd::combine_words<detail::simd::bit_op::or_>(words_.data(), other.words_.data(), words_.size());
+      return *this;
+    }
+
+    template<typename Allocator>
+    bit_vector<Allocator>& bit_vector<Allocator>::operator^=(const bit_vector& other) {
+      check_same_size(other);
+      detail::simd::combine_words<detail::simd::bit_op::xor_>(words_.data(), other.words_.data(), words_.size());
+      return *this;
+    }
+
+    template<typename Allocator>
+    bit_vector<Allocator>& bit_vector<Allocator>::and_not(const bit_vector& other) {
+      check_same_size(other);
+      detail::simd::combine_words<detail::simd::bit_op::and_not>(words_.data(), other.words_.data(), words_.size());
+      return *this;
+    }
+
+    template<typename Allocator>
+    bit_vector<Allocator> bit_vector<Allocator>::operator~() const {
+      bit_vector result(*this);
+      result.flip();
+      return result;
+    }
+
+    template<typename Allocator>
+    span<const uint64_t> bit_vector<Allocator>::words() const noexcept {
+      return span<const uint64_t>(words_.data(), words_.size());
+    }
+
+    template<typename Allocator>
+    typename bit_vector<Allocator>::iterator bit_vector<Allocator>::begin() noexcept {
+      return iterator(words_.data(), 0);
+    }
+
+    template<typename Allocator>
+    typename bit_vector<Allocator>::const_iterator bit_vector<Allocator>::begin() const noexcept {
+      return const_iterator(words_.data(), 0);
+    }
+
+    template<typename Allocator>
+    typename bit_vector<Allocator>::iterator bit_vector<Allocator>::end() noexcept {
+      return iterator(words_.data(), size_);
+    }
+
+    template<typename Allocator>
+    typename bit_vector<Allocator>::const_iterator bit_vector<Allocator>::end() const noexcept {
+      return const_iterator(words_.data(), size_);
+    }
+
+    template<typename Allocator>
+    typename bit_vector<Allocator>::const_iterator bit_vector<Allocator>::cbegin() const noexcept {
+      return begin();
+    }
+
+    template<typename Allocator>
+    typename bit_vector<Allocator>::const_iterator bit_vector<Allocator>::cend() const noexcept {
+      return end();
+    }
+
+    template<typename Allocator>
+    size_t bit_vector<Allocator>::size() const noexcept {
+      return size_;
+    }
+
+    template<typename Allocator>
+    size_t bit_vector<Allocator>::capacity() const noexcept {
+      return words_.capacity() * word_bits;
+    }
+
+    template<typename Allocator>
+    void bit_vector<Allocator>::ensure_capacity(size_t min_capacity) {
+      words_.ensure_capacity(words_for(min_capacity));
+    }
+
+    template<typename Allocator>
+    void bit_vector<Allocator>::shrink_to_fit() {
+      words_.shrink_to_fit();
+    }
+
+    template<typename Allocator>
+    void bit_vector<Allocator>::clear() noexcept {
+      words_.clear();
+      size_ = 0;
+    }
+
+    template<typename Allocator>
+    void bit_vector<Allocator>::clear_and_free() noexcept {
+      words_.clear_and_free();
+      size_ = 0;
+    }
+
+    template<typename Allocator>
+    void bit_vector<Allocator>::swap(bit_vector& other) noexcept {
+      words_.swap(other.words_);
+      std::swap(size_, other.size_);
+    }
+
+    template<typename Allocator>
+    typename bit_vector<Allocator>::allocator_type bit_vector<Allocator>::get_allocator() const noexcept {
+      return words_.get_allocator();
+    }
+
+    template<typename Allocator>
+    rank_select_index::rank_select_index(const bit_vector<Allocator>& bits)
+        : words_(bits.words().data()), size_(bits.size()), ranks_() {
+      const span<const uint64_t> words = bits.words();
+      const size_t blocks = (words.size() + block_words - 1) / block_words;
+      ranks_.ensure_capacity(blocks + 1);
+      uint64_t total = 0;
+      for (size_t block = 0; block < blocks; ++block) {
+        ranks_.push_back(total);
+        const size_t first = block * block_words;
+        total += detail::simd::popcount_words(words.data() + first, std::min(block_words, words.size() - first));
+      }
+      ranks_.push_back(total);
+    }
+
+    inline size_t rank_select_index::rank(size_t index) const {
+      if (index > size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      const size_t word = index / 64;
+      const size_t block = index / block_bits;
+      size_t total = static_cast<size_t>(ranks_[block]);
+      for (size_t i = block * block_words; i < word; ++i) {
+        total += static_cast<size_t>(__builtin_popcountll(words_[i]));
+      }
+      if (index % 64 != 0) {
+        total += static_cast<size_t>(__builtin_popcountll(words_[word] & ((uint64_t(1) << (index % 64)) - 1)));
+      }
+      return total;
+    }
+
+    inline size_t rank_select_index::select(size_t rank) const noexcept {
+      if (rank >= count()) {
+        return size_;
+      }
+      // The last block whose preceding count is at most rank holds the bit.
+      const uint64_t* first = ranks_.data();
+      const uint64_t* last = ranks_.data() + ranks_.size() - 1;
+      const size_t block = static_cast<size_t>(std::upper_bound(first, last, uint64_t(rank)) - first) - 1;
+      rank -= static_cast<size_t>(ranks_[block]);
+      for (size_t i = block * block_words;; ++i) {
+        const size_t ones = static_cast<size_t>(__builtin_popcountll(words_[i]));
+        if (rank < ones) {
+          return i * 64 + detail::simd::select_in_word(words_[i], static_cast<unsigned>(rank));
+        }
+        rank -= ones;
+      }
+    }
+
+    inline size_t rank_select_index::count() const noexcept {
+      return static_cast<size_t>(ranks_[ranks_.size() - 1]);
+    }
+
+    inline size_t rank_select_index::size() const noexcept {
+      return size_;
+    }
+
+} // namespace my_vector
@@ -0,0 +1,236 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_BITPACK_H
+#define VECTOR_BITPACK_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "simd.h"
+
+namespace my_vector {
+
+    namespace detail {
+
+    namespace simd {
+
+/**
+ * Bit-packing of 128 values of up to 32 bits each, in the four-lane vertical layout of
+ * SIMD-BP128: value j belongs to lane j % 4, each lane packs its 32 values one after another
+ * in width-bit fields, and the lanes' words are interleaved. 128 values of width w take 4 * w
+ * 32-bit words, and a 128-bit register packs or unpacks four values per shift and mask.
+ */
+
+    /**
+     * @brief The number of values bitpack packs together.
+     */
+    inline constexpr size_t bitpack_values = 128;
+
+    /**
+     * @brief Returns the number of 32-bit words 128 values of the given width pack into.
+     */
+    constexpr size_t bitpack_words(unsigned width) noexcept {
+      return 4 * static_cast<size_t>(width);
+    }
+
+    /**
+     * @brief Returns the mask of the low width bits.
+     */
+    constexpr uint32_t low_bits(unsigned width) noexcept {
+      return width >= 32 ? ~uint32_t(0) : (uint32_t(1) << width) - 1;
+    }
+
+    /**
+     * @brief Returns the number of bits needed to store value.
+     */
+    constexpr unsigned bit_width(uint64_t value) noexcept {
+      return value == 0 ? 0 : 64 - static_cast<unsigned>(__builtin_clzll(value));
+    }
+
+    namespace scalar {
+
+    inline void pack(const uint32_t* in, uint32_t* out, unsigned width) noexcept {
+      if (width == 0) {
+        return;
+      }
+      const uint32_t mask = low_bits(width);
+      for (size_t lane = 0; lane < 4; ++lane) {
+        uint64_t buffer = 0;
+        unsigned filled = 0;
+        uint32_t* word = out + lane;
+        for (size_t slot = 0; slot < 32; ++slot) {
+          buffer |= uint64_t(in[4 * slot + lane] & mask) << filled;
+          filled += width;
+          if (filled >= 32) {
+            *word = static_cast<uint32_t>(buffer);
+            word += 4;
+            buffer >>= 32;
+            filled -= 32;
+          }
+        }
+      }
+    }
+
+    inline void unpack(const uint32_t* in, uint32_t* out, unsigned width) noexcept {
+      const uint32_t mask = low_bits(width);
+      for (size_t lane = 0; lane < 4; ++lane) {
+        uint64_t buffer = 0;
+        unsigned filled = 0;
+        const uint32_t* word = in + lane;
+        for (size_t slot = 0; slot < 32; ++slot) {
+          if (filled < width) {
+            buffer |= uint64_t(*word) << filled;
+            word += 4;
+            filled += 32;
+          }
+          out[4 * slot + lane] = static_cast<uint32_t>(buffer) & mask;
+          buffer >>= width;
+          filled -= width;
+        }
+      }
+    }
+
+    } // namespace scalar
+
+#if defined(MY_VECTOR_SIMD_X86)
+    /**
+     * @brief Packs 128 values into width-bit fields, four lanes at a time.
+     *
+     * The width is a template parameter so the fully unrolled loop has constant shifts.
+     */
+    template<unsigned Width>
+    MY_VECTOR_TARGET_SSE2 void pack_sse2(const uint32_t* in, uint32_t* out) noexcept {
+      if constexpr (Width > 0) {
+        const __m128i mask = _mm_set1_epi32(static_cast<int>(low_bits(Width)));
+        auto* dst = reinterpret_cast<__m128i*>(out);
+        __m128i word = _mm_setzero_si128();
+        unsigned shift = 0;
+#pragma GCC unroll 32
+        for (size_t slot = 0; slot < 32; ++slot) {
+          const __m128i value = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 4 * slot)), mask);
+          word = _mm_or_si128(word, _mm_slli_epi32(value, static_cast<int>(shift)));
+          if (shift + Width >= 32) {
+            _mm_storeu_si128(dst++, word);
+            word = shift + Width > 32 ? _mm_srli_epi32(value, static_cast<int>(32 - shift)) : _mm_setzero_si128();
+            shift = shift + Width - 32;
+          } else {
+            shift += Width;
+          }
+        }
+      }
+    }
+
+    /**
+     * @brief Unpacks 128 width-bit fields, four lanes at a time.
+     */
+    template<unsigned Width>
+    MY_VECTOR_TARGET_SSE2 void unpack_sse2(const uint32_t* in, uint32_t* out) noexcept {
+      if constexpr (Width == 0) {
+        for (size_t i = 0; i < bitpack_values; i += 4) {
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_setzero_si128());
+        }
+      } else {
+        const __m128i mask = _mm_set1_epi32(static_cast<int>(low_bits(Width)));
+        const auto* src = reinterpret_cast<const __m128i*>(in);
+        __m128i word = _mm_loadu_si128(src++);
+        unsigned shift = 0;
+#pragma GCC unroll 32
+        for (size_t slot = 0; slot < 32; ++slot) {
+          __m128i value = _mm_srli_epi32(word, static_cast<int>(shift));
+          if (shift + Width > 32) {
+            word = _mm_loadu_si128(src++);
+            value = _mm_or_si128(value, _mm_slli_epi32(word, static_cast<int>(32 - shift)));
+            shift = shift + Width - 32;
+          } else if (shift + Width == 32) {
+            if (slot != 31) {
+              word = _mm_loadu_si128(src++);
+            }
+            shift = 0;
+          } else {
+            shift += Width;
+          }
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4 * slot), _mm_and_si128(value, mask));
+        }
+      }
+    }
+
+    using bitpack_kernel = void (*)(const uint32_t*, uint32_t*) noexcept;
+
+    template<size_t... Width>
+    constexpr std::array<bitpack_kernel, 33> make_pack_table(std::index_sequence<Width...>) noexcept {
+      return {{&pack_sse2<Width>...}};
+    }
+
+    template<size_t... Width>
+    constexpr std::array<bitpack_kernel, 33> make_unpack_table(std::index_sequence<Width...>) noexcept {
+      return {{&unpack_sse2<Width>...}};
+    }
+
+    inline constexpr std::array<bitpack_kernel, 33> pack_table = make_pack_table(std::make_index_sequence<33>());
+    inline constexpr std::array<bitpack_kernel, 33> unpack_table = make_unpack_table(std::make_index_sequence<33>());
+#endif
+
+    /**
+     * @brief Packs the low width bits of 128 values into bitpack_words(width) words.
+     *
+     * @param in 128 values.
+     * @param out Room for bitpack_words(width) words.
+     * @param width The field width, at most 32.
+     */
+    inline void bitpack(const uint32_t* in, uint32_t* out, unsigned width) noexcept {
+#if defined(MY_VECTOR_SIMD_X86)
+      if (current_isa() >= isa::sse2) {
+        return pack_table[width](in, out);
+      }
+#endif
+      scalar::pack(in, out, width);
+    }
+
+    /**
+     * @brief Unpacks 128 values of the given width.
+     *
+     * @param in bitpack_words(width) words written by bitpack.
+     * @param out Room for 128 values.
+     * @param width The field width, at most 32.
+     */
+    inline void bitunpack(const uint32_t* in, uint32_t* out, unsigned width) noexcept {
+#if defined(MY_VECTOR_SIMD_X86)
+      if (current_isa() >= isa::sse2) {
+        return unpack_table[width](in, out);
+      }
+#endif
+      scalar::unpack(in, out, width);
+    }
+
+    /**
+     * @brief Extracts a single value from a packed block without unpacking the rest.
+     *
+     * @param in bitpack_words(width) words written by bitpack.
+     * @param index The position of the value, below 128.
+     * @param width The field width, at most 32.
+     */
+    inline uint32_t bitunpack_one(const uint32_t* in, size_t index, unsigned width) noexcept {
+      if (width == 0) {
+        return 0;
+      }
+      const size_t bit = (index / 4) * width;
+      const uint32_t* word = in + 4 * (bit / 32) + index % 4;
+      const unsigned shift = bit % 32;
+      uint64_t fields = word[0] >> shift;
+      if (shift + width > 32) {
+        fields |= uint64_t(word[4]) << (32 - shift);
+      }
+      return static_cast<uint32_t>(fields) & low_bits(width);
+    }
+
+    } // namespace simd
+
+    } // namespace detail
+
+} // namespace my_vector
+
+#endif //VECTOR_BITPACK_H
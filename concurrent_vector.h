@@ -0,0 +1,380 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_CONCURRENT_VECTOR_H
+#define VECTOR_CONCURRENT_VECTOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+
+#include "iterator.h"
+#include "vector.h"
+
+namespace my_vector {
+
+/**
+ * @brief A vector that many threads can append to at once, whose elements never move.
+ *
+ * Elements live in segments that double in size: segment k holds first_segment_size << k
+ * elements, and a fixed table holds one pointer per segment. Appending reserves indices with
+ * a single atomic fetch_add on the size and installs a missing segment with a compare-and-swap,
+ * so push_back, emplace_back and grow_by never take a lock and never relocate anything.
+ *
+ * Every segment carries one bit per element that is set, with release ordering, once the
+ * element is constructed. Another thread may read an element while appends continue as soon
+ * as it has learned the element's index through some synchronization, or after
+ * is_constructed(index) returned true. size() counts reserved slots, so it can include
+ * elements that are still being constructed.
+ *
+ * If an element's constructor throws, its slot stays reserved but empty: is_constructed and
+ * at() report it, the destructor skips it, and operator[] and iteration must not reach it.
+ * Anything that is not one of the appending functions or an element access, such as
+ * copying, assignment, clear() and swap(), must not run concurrently with other calls.
+ *
+ * @tparam T The type of elements stored in the vector.
+ * @tparam Allocator The allocator used to obtain segments. It is called from several threads.
+ */
+    template<typename T, typename Allocator = std::allocator<T>>
+    class concurrent_vector : private detail::allocator_holder<Allocator> {
+        using alloc_traits = std::allocator_traits<Allocator>;
+        using detail::allocator_holder<Allocator>::allocator;
+        using ready_word = std::atomic<uint64_t>;
+
+        static constexpr size_t first_segment_bits = 5;
+        static constexpr size_t max_segments = 64 - first_segment_bits;
+
+        std::atomic<T*> segments_[max_segments]; /// Segment k holds the elements from segment_base(k) on
+        std::atomic<size_t> size_; /// Number of reserved slots
+
+      /**
+       * @brief Returns the number of elements in a segment.
+       */
+        static constexpr size_t segment_size(size_t segment) noexcept;
+
+      /**
+       * @brief Returns the index of the first element in a segment.
+       */
+        static constexpr size_t segment_base(size_t segment) noexcept;
+
+      /**
+       * @brief Returns the segment that holds the element with the given index.
+       */
+        static size_t segment_of(size_t index) noexcept;
+
+      /**
+       * @brief Returns the number of T-sized slots allocated for a segment, including its ready bits.
+       */
+        static size_t allocated_slots(size_t segment) noexcept;
+
+      /**
+       * @brief Returns the ready bits that follow the elements of a segment.
+       */
+        static ready_word* ready_bits(T* elements, size_t segment) noexcept;
+
+      /**
+       * @brief Returns the segment, allocating and installing it if no thread has done so yet.
+       *
+       * @throws std::length_error if the segment lies beyond the largest possible size.
+       */
+        T* acquire_segment(size_t segment);
+
+      /**
+       * @brief Constructs the element in a reserved slot and publishes it.
+       *
+       * @param index The reserved index.
+       * @param args The arguments for the constructor of T.
+       * @return A reference to the new element.
+       */
+        template<typename... Args>
+        T& construct_at(size_t index, Args&&... args);
+
+      /**
+       * @brief Constructs the reserved slots [first, last) with construct(T* slot) and publishes them.
+       *
+       * The ready bits are set once per 64 elements rather than once per element. If a
+       * constructor throws, the elements built so far are published and the rest stay empty.
+       */
+        template<typename Construct>
+        void construct_range(size_t first, size_t last, Construct&& construct);
+
+      /**
+       * @brief Destroys the constructed elements and clears the ready bits, keeping the segments.
+       */
+        void destroy_elements() noexcept;
+
+      /**
+       * @brief Destroys all elements and returns every segment to the allocator.
+       */
+        void destroy_and_deallocate() noexcept;
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using iterator = detail::index_iterator<T, concurrent_vector>;
+        using const_iterator = detail::index_iterator<const T, const concurrent_vector>;
+
+        /**
+         * @brief The number of elements in the first segment.
+         */
+        static constexpr size_t first_segment_size = size_t(1) << first_segment_bits;
+
+        /**
+         * @brief Default constructor.
+         *
+         * Creates an empty vector without allocating.
+         */
+        concurrent_vector() noexcept(std::is_nothrow_default_constructible<Allocator>::value);
+
+        /**
+         * @brief Constructs an empty vector that obtains its segments from the given allocator.
+         *
+         * @param alloc The allocator to use.
+         */
+        explicit concurrent_vector(const Allocator& alloc) noexcept;
+
+        /**
+         * @brief Constructor with size and value.
+         *
+         * @param size The number of elements to initialize.
+         * @param value The value to initialize each element with.
+         * @param alloc The allocator to use.
+         */
+        concurrent_vector(size_t size, const T& value, const Allocator& alloc = Allocator());
+
+        /**
+         * @brief Constructor with initializer list.
+         *
+         * @param init The initializer list to initialize the elements.
+         * @param alloc The allocator to use.
+         */
+        concurrent_vector(std::initializer_list<T> init, const Allocator& alloc = Allocator());
+
+        /**
+         * @brief Copy constructor. Copies the constructed elements; empty slots stay empty.
+         *
+         * @param other The vector to copy from.
+         */
+        concurrent_vector(const concurrent_vector& other);
+
+        /**
+         * @brief Copy assignment operator.
+         *
+         * @param other The vector to copy from.
+         * @return A reference to the assigned vector.
+         */
+        concurrent_vector& operator=(const concurrent_vector& other);
+
+        /**
+         * @brief Move constructor. Takes over the segments, so no element moves.
+         *
+         * @param other The vector to move from.
+         */
+        concurrent_vector(concurrent_vector&& other) noexcept;
+
+        /**
+         * @brief Move assignment operator.
+         *
+         * Takes over the segments if the allocators propagate or compare equal, and moves
+         * the elements one by one otherwise.
+         *
+         * @param other The vector to move from.
+         * @return A reference to the assigned vector.
+         */
+        concurrent_vector& operator=(concurrent_vector&& other)
+            noexcept(alloc_traits::propagate_on_container_move_assignment::value
+                     || alloc_traits::is_always_equal::value);
+
+        /**
+         * @brief Destructor.
+         */
+        ~concurrent_vector();
+
+        /**
+         * @brief Appends a copy of the value. Safe to call from several threads at once.
+         *
+         * @param value The value to append.
+         * @return The index of the new element.
+         */
+        size_t push_back(const T& value);
+
+        /**
+         * @brief Appends the value by moving it. Safe to call from several threads at once.
+         *
+         * @param value The value to append.
+         * @return The index of the new element.
+         */
+        size_t push_back(T&& value);
+
+        /**
+         * @brief Constructs an element in place at the end. Safe to call from several threads at once.
+         *
+         * @param args The arguments for the constructor of T.
+         * @return A reference to the new element, valid until the vector is cleared or destroyed.
+         */
+        template<typename... Args>
+        T& emplace_back(Args&&... args);
+
+        /**
+         * @brief Appends count value-initialized elements as one contiguous range of indices.
+         *
+         * Safe to call from several threads at once. The range may span several segments.
+         *
+         * @param count The number of elements to append.
+         * @return The index of the first new element.
+         */
+        size_t grow_by(size_t count);
+
+        /**
+         * @brief Appends count copies of the value as one contiguous range of indices.
+         *
+         * @param count The number of elements to append.
+         * @param value The value to copy.
+         * @return The index of the first new element.
+         */
+        size_t grow_by(size_t count, const T& value);
+
+        /**
+         * @brief Appends value-initialized elements until the size is at least the given one.
+         *
+         * Safe to call from several threads at once; only one of them appends any given slot.
+         *
+         * @param new_size The size to grow to.
+         * @return The number of reserved slots before the call.
+         */
+        size_t grow_to_at_least(size_t new_size);
+
+        /**
+         * @brief Allocates the segments needed to hold the given number of elements.
+         *
+         * Safe to call concurrently with appends.
+         *
+         * @param new_capacity The number of elements to make room for.
+         */
+        void reserve(size_t new_capacity);
+
+        /**
+         * @brief Accesses the element at the specified position.
+         *
+         * @param index The position of the element to access.
+         * @return A reference to the element.
+         */
+        T& operator[] (size_t index);
+
+        /**
+         * @brief Accesses the element at the specified position.
+         *
+         * @param index The position of the element to access.
+         * @return A const reference to the element.
+         */
+        const T& operator[] (size_t index) const;
+
+        /**
+         * @brief Accesses the element at the specified position, checking that it has been constructed.
+         *
+         * @param index The position of the element to access.
+         * @return A reference to the element.
+         * @throws std::out_of_range if the index is out of range or the element is not constructed yet.
+         */
+        T& at(size_t index);
+
+        /**
+         * @brief Accesses the element at the specified position, checking that it has been constructed.
+         *
+         * @param index The position of the element to access.
+         * @return A const reference to the element.
+         * @throws std::out_of_range if the index is out of range or the element is not constructed yet.
+         */
+        const T& at(size_t index) const;
+
+        /**
+         * @brief Checks whether the element at the given index has been constructed and published.
+         *
+         * A true result synchronizes with the construction, so the element can be read safely.
+         *
+         * @param index The position to check.
+         */
+        [[nodiscard]] bool is_constructed(size_t index) const noexcept;
+
+        /**
+         * @brief Returns an iterator to the first element.
+         */
+        iterator begin() noexcept;
+
+        /**
+         * @brief Returns an iterator to the first element.
+         */
+        const_iterator begin() const noexcept;
+
+        /**
+         * @brief Returns an iterator past the last reserved slot.
+         */
+        iterator end() noexcept;
+
+        /**
+         * @brief Returns an iterator past the last reserved slot.
+         */
+        const_iterator end() const noexcept;
+
+        /**
+         * @brief Returns a const iterator to the first element.
+         */
+        const_iterator cbegin() const noexcept;
+
+        /**
+         * @brief Returns a const iterator past the last reserved slot.
+         */
+        const_iterator cend() const noexcept;
+
+        /**
+         * @brief Returns the number of reserved slots.
+         */
+        [[nodiscard]] size_t size() const noexcept;
+
+        /**
+         * @brief Checks whether no slot has been reserved.
+         */
+        [[nodiscard]] bool empty() const noexcept;
+
+        /**
+         * @brief Returns the number of elements the leading run of allocated segments can hold.
+         */
+        [[nodiscard]] size_t capacity() const noexcept;
+
+        /**
+         * @brief Destroys all elements but keeps the segments. Not safe to call concurrently.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Destroys all elements and frees every segment. Not safe to call concurrently.
+         */
+        void clear_and_free() noexcept;
+
+        /**
+         * @brief Exchanges the contents with another vector. Not safe to call concurrently.
+         *
+         * @param other The vector to swap with.
+         */
+        void swap(concurrent_vector& other) noexcept;
+
+        /**
+         * @brief Returns the allocator associated with the vector.
+         */
+        allocator_type get_allocator() const noexcept;
+    };
+
+} // namespace my_vector
+
+#include "concurrent_vector_impl.h"
+
+#endif //VECTOR_CONCURRENT_VECTOR_H
@@ -0,0 +1,443 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace my_vector {
+
+    template<typename T, typename Allocator>
+    constexpr size_t concurrent_vector<T, Allocator>::segment_size(size_t segment) noexcept {
+      return first_segment_size << segment;
+    }
+
+    template<typename T, typename Allocator>
+    constexpr size_t concurrent_vector<T, Allocator>::segment_base(size_t segment) noexcept {
+      return (first_segment_size << segment) - first_segment_size;
+    }
+
+    template<typename T, typename Allocator>
+    size_t concurrent_vector<T, Allocator>::segment_of(size_t index) noexcept {
+      // Shifting by the first segment size makes segment k start at the power of two 2^(k + bits).
+      const unsigned long long shifted = static_cast<unsigned long long>(index) + first_segment_size;
+      return static_cast<size_t>(63 - __builtin_clzll(shifted)) - first_segment_bits;
+    }
+
+    template<typename T, typename Allocator>
+    size_t concurrent_vector<T, Allocator>::allocated_slots(size_t segment) noexcept {
+      const size_t elements = segment_size(segment);
+      const size_t words = (elements + 63) / 64;
+      const size_t bytes = elements * sizeof(T) + alignof(ready_word) - 1 + words * sizeof(ready_word);
+      return (bytes + sizeof(T) - 1) / sizeof(T);
+    }
+
+    template<typename T, typename Allocator>
+    typename concurrent_vector<T, Allocator>::ready_word*
+    concurrent_vector<T, Allocator>::ready_bits(T* elements, size_t segment) noexcept {
+      const uintptr_t end = reinterpret_cast<uintptr_t>(elements + segment_size(segment));
+      const uintptr_t aligned = (end + alignof(ready_word) - 1) & ~static_cast<uintptr_t>(alignof(ready_word) - 1);
+      return reinterpret_cast<ready_word*>(aligned);
+    }
+
+    template<typename T, typename Allocator>
+    T* concurrent_vector<T, Allocator>::acquire_segment(size_t segment) {
+      if (segment >= max_segments) {
+        throw std::length_error("concurrent_vector: too many elements");
+      }
+      T* elements = segments_[segment].load(std::memory_order_acquire);
+      if (elements) {
+        return elements;
+      }
+      T* fresh = alloc_traits::allocate(allocator(), allocated_slots(segment));
+      ready_word* bits = ready_bits(fresh, segment);
+      for (size_t i = 0, words = (segment_size(segment) + 63) / 64; i < words; ++i) {
+        ::new (static_cast<void*>(bits + i)) ready_word(0);
+      }
+      if (segments_[segment].compare_exchange_strong(elements, fresh, std::memory_order_acq_rel,
+                                                     std::memory_order_acquire)) {
+        return fresh;
+      }
+      // Another thread installed the segment first.
+      alloc_traits::deallocate(allocator(), fresh, allocated_slots(segment));
+      return elements;
+    }
+
+    template<typename T, typename Allocator>
+    template<typename... Args>
+    T& concurrent_vector<T, Allocator>::construct_at(size_t index, Args&&... args) {
+      const size_t segment = segment_of(index);
+      T* elements = acquire_segment(segment);
+      const size_t offset = index - segment_base(segment);
+      alloc_traits::construct(allocator(), elements + offset, std::forward<Args>(args)...);
+      ready_bits(elements, segment)[offset / 64].fetch_or(uint64_t(1) << (offset % 64), std::memory_order_release);
+      return elements[offset];
+    }
+
+    template<typename T, typename Allocator>
+    template<typename Construct>
+    void concurrent_vector<T, Allocator>::construct_range(size_t first, size_t last, Construct&& construct) {
+      size_t index = first;
+      while (index < last) {
+        const size_t segment = segment_of(index);
+        T* elements = acquire_segment(segment);
+        ready_word* bits = ready_bits(elements, segment);
+        const size_t base = segment_base(segment);
+        const size_t stop = std::min(last, base + segment_size(segment));
+        uint64_t mask = 0;
+        for (; index < stop; ++index) {
+          const size_t offset = index - base;
+          try {
+            construct(elements + offset);
+          } catch (...) {
+            if (mask) {
+              bits[offset / 64].fetch_or(mask, std::memory_order_release);
+            }
+            throw;
+          }
+          mask |= uint64_t(1) << (offset % 64);
+          if (offset % 64 == 63 || index + 1 == stop) {
+            bits[offset / 64].fetch_or(mask, std::memory_order_release);
+            mask = 0;
+          }
+        }
+      }
+    }
+
+    template<typename T, typename Allocator>
+    void concurrent_vector<T, Allocator>::destroy_elements() noexcept {
+      for (size_t segment = 0; segment < max_segments; ++segment) {
+        T* elements = segments_[segment].load(std::memory_order_relaxed);
+        if (!elements) {
+          continue;
+        }
+        ready_word* bits = ready_bits(elements, segment);
+        for (size_t i = 0, words = (segment_size(segment) + 63) / 64; i < words; ++i) {
+          uint64_t constructed = bits[i].load(std::memory_order_acquire);
+          if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (; constructed; constructed &= constructed - 1) {
+              alloc_traits::destroy(allocator(), elements + i * 64 + __builtin_ctzll(constructed));
+            }
+          }
+          bits[i].store(0, std::memory_order_relaxed);
+        }
+      }
+    }
+
+    template<typename T, typename Allocator>
+    void concurrent_vector<T, Allocator>::destroy_and_deallocate() noexcept {
+      destroy_elements();
+      for (size_t segment = 0; segment < max_segments; ++segment) {
+        if (T* elements = segments_[segment].exchange(nullptr, std::memory_order_relaxed)) {
+          alloc_traits::deallocate(allocator(), elements, allocated_slots(segment));
+        }
+      }
+    }
+
+    template<typename T, typename Allocator>
+    concurrent_vector<T, Allocator>::concurrent_vector()
+        noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+        : segments_(), size_(0) {
+    }
+
+    template<typename T, typename Allocator>
+    concurrent_vector<T, Allocator>::concurrent_vector(const Allocator& alloc) noexcept
+        : detail::allocator_holder<Allocator>(alloc), segments_(), size_(0) {
+    }
+
+    template<typename T, typename Allocator>
+    concurrent_vector<T, Allocator>::concurrent_vector(size_t size, const T& value, const Allocator& alloc)
+        : detail::allocator_holder<Allocator>(alloc), segments_(), size_(0) {
+      try {
+        grow_by(size, value);
+      } catch (...) {
+        destroy_and_deallocate();
+        throw;
+      }
+    }
+
+    template<typename T, typename Allocator>
+    concurrent_vector<T, Allocator>::concurrent_vector(std::initializer_list<T> init, const Allocator& alloc)
+        : detail::allocator_holder<Allocator>(alloc), segments_(), size_(0) {
+      try {
+        size_.store(init.size(), std::memory_order_relaxed);
+        const T* source = init.begin();
+        construct_range(0, init.size(), [this, &source](T* slot) {
+          alloc_traits::construct(allocator(), slot, *source++);
+        });
+      } catch (...) {
+        destroy_and_deallocate();
+        throw;
+      }
+    }
+
+    template<typename T, typename Allocator>
+    concurrent_vector<T, Allocator>::concurrent_vector(const concurrent_vector& other)
+        : detail::allocator_holder<Allocator>(alloc_traits::select_on_container_copy_construction(other.allocator())),
+          segments_(), size_(0) {
+      try {
+        const size_t size = other.size();
+        size_.store(size, std::memory_order_relaxed);
+        for (size_t i = 0; i < size; ++i) {
+          if (other.is_constructed(i)) {
+            construct_at(i, other[i]);
+          }
+        }
+      } catch (...) {
+        destroy_and_deallocate();
+        throw;
+      }
+    }
+
+    template<typename T, typename Allocator>
+    concurrent_vector<T, Allocator>& concurrent_vector<T, Allocator>::operator=(const concurrent_vector& other) {
+      if (this != &other) {
+        destroy_and_deallocate();
+        size_.store(0, std::memory_order_relaxed);
+        if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+          allocator() = other.allocator();
+        }
+        // Slots whose copy throws stay empty, so the vector is valid at every step.
+        const size_t size = other.size();
+        size_.store(size, std::memory_order_relaxed);
+        for (size_t i = 0; i < size; ++i) {
+          if (other.is_constructed(i)) {
+            construct_at(i, other[i]);
+          }
+        }
+      }
+      return *this;
+    }
+
+    template<typename T, typename Allocator>
+    concurrent_vector<T, Allocator>::concurrent_vector(concurrent_vector&& other) noexcept
+        : detail::allocator_holder<Allocator>(std::move(other.allocator())), segments_(),
+          size_(other.size_.exchange(0, std::memory_order_relaxed)) {
+      for (size_t segment = 0; segment < max_segments; ++segment) {
+        segments_[segment].store(other.segments_[segment].exchange(nullptr, std::memory_order_relaxed),
+                                 std::memory_order_relaxed);
+      }
+    }
+
+    template<typename T, typename Allocator>
+    concurrent_vector<T, Allocator>& concurrent_vector<T, Allocator>::operator=(concurrent_vector&& other)
+        noexcept(alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value) {
+      if (this != &other) {
+        destroy_and_deallocate();
+        size_.store(0, std::memory_order_relaxed);
+
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+          allocator() = std::move(other.allocator());
+        } else if (allocator() != other.allocator()) {
+          // Segments cannot change hands between unequal allocators, move element-wise instead.
+          const size_t size = other.size();
+          size_.store(size, std::memory_order_relaxed);
+          for (size_t i = 0; i < size; ++i) {
+            if (other.is_constructed(i)) {
+              construct_at(i, std::move(other[i]));
+            }
+          }
+          return *this;
+        }
+        size_.store(other.size_.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+        for (size_t segment = 0; segment < max_segments; ++segment) {
+          segments_[segment].store(other.segments_[segment].exchange(nullptr, std::memory_order_relaxed),
+                                   std::memory_order_relaxed);
+        }
+      }
+      return *this;
+    }
+
+    template<typename T, typename Allocator>
+    concurrent_vector<T, Allocator>::~concurrent_vector() {
+      destroy_and_deallocate();
+    }
+
+    template<typename T, typename Allocator>
+    size_t concurrent_vector<T, Allocator>::push_back(const T& value) {
+      const size_t index = size_.fetch_add(1, std::memory_order_relaxed);
+      construct_at(index, value);
+      return index;
+    }
+
+    template<typename T, typename Allocator>
+    size_t concurrent_vector<T, Allocator>::push_back(T&& value) {
+      const size_t index = size_.fetch_add(1, std::memory_order_relaxed);
+      construct_at(index, std::move(value));
+      return index;
+    }
+
+    template<typename T, typename Allocator>
+    template<typename... Args>
+    T& concurrent_vector<T, Allocator>::emplace_back(Args&&... args) {
+      return construct_at(size_.fetch_add(1, std::memory_order_relaxed), std::forward<Args>(args)...);
+    }
+
+    template<typename T, typename Allocator>
+    size_t concurrent_vector<T, Allocator>::grow_by(size_t count) {
+      const size_t first = size_.fetch_add(count, std::memory_order_relaxed);
+      construct_range(first, first + count, [this](T* slot) {
+        alloc_traits::construct(allocator(), slot);
+      });
+      return first;
+    }
+
+    template<typename T, typename Allocator>
+    size_t concurrent_vector<T, Allocator>::grow_by(size_t count, const T& value) {
+      const size_t first = size_.fetch_add(count, std::memory_order_relaxed);
+      construct_range(first, first + count, [this, &value](T* slot) {
+        alloc_traits::construct(allocator(), slot, value);
+      });
+      return first;
+    }
+
+    template<typename T, typename Allocator>
+    size_t concurrent_vector<T, Allocator>::grow_to_at_least(size_t new_size) {
+      size_t current = size_.load(std::memory_order_relaxed);
+      while (current < new_size) {
+        if (size_.compare_exchange_weak(current, new_size, std::memory_order_relaxed)) {
+          construct_range(current, new_size, [this](T* slot) {
+            alloc_traits::construct(allocator(), slot);
+          });
+          break;
+        }
+      }
+      return current;
+    }
+
+    template<typename T, typename Allocator>
+    void concurrent_vector<T, Allocator>::reserve(size_t new_capacity) {
+      if (new_capacity == 0) {
+        return;
+      }
+      for (size_t segment = 0, last = segment_of(new_capacity - 1); segment <= last; ++segment) {
+        acquire_segment(segment);
+      }
+    }
+
+    template<typename T, typename Allocator>
+    T& concurrent_vector<T, Allocator>::operator[] (size_t index) {
+      const size_t segment = segment_of(index);
+      return segments_[segment].load(std::memory_order_acquire)[index - segment_base(segment)];
+    }
+
+    template<typename T, typename Allocator>
+    const T& concurrent_vector<T, Allocator>::operator[] (size_t index) const {
+      const size_t segment = segment_of(index);
+      return segments_[segment].load(std::memory_order_acquire)[index - segment_base(segment)];
+    }
+
+    template<typename T, typename Allocator>
+    T& concurrent_vector<T, Allocator>::at(size_t index) {
+      if (!is_constructed(index)) {
+        throw std::out_of_range("Index out of range");
+      }
+      return (*this)[index];
+    }
+
+    template<typename T, typename Allocator>
+    const T& concurrent_vector<T, Allocator>::at(size_t index) const {
+      if (!is_constructed(index)) {
+        throw std::out_of_range("Index out of range");
+      }
+      return (*this)[index];
+    }
+
+    template<typename T, typename Allocator>
+    bool concurrent_vector<T, Allocator>::is_constructed(size_t index) const noexcept {
+      if (index >= size_.load(std::memory_order_relaxed)) {
+        return false;
+      }
+      const size_t segment = segment_of(index);
+      T* elements = segments_[segment].load(std::memory_order_acquire);
+      if (!elements) {
+        return false;
+      }
+      const size_t offset = index - segment_base(segment);
+      return (ready_bits(elements, segment)[offset / 64].load(std::memory_order_acquire) >> (offset % 64)) & 1;
+    }
+
+    template<typename T, typename Allocator>
+    typename concurrent_vector<T, Allocator>::iterator concurrent_vector<T, Allocator>::begin() noexcept {
+      return iterator(this, 0);
+    }
+
+    template<typename T, typename Allocator>
+    typename concurrent_vector<T, Allocator>::const_iterator concurrent_vector<T, Allocator>::begin() const noexcept {
+      return const_iterator(this, 0);
+    }
+
+    template<typename T, typename Allocator>
+    typename concurrent_vector<T, Allocator>::iterator concurrent_vector<T, Allocator>::end() noexcept {
+      return iterator(this, size());
+    }
+
+    template<typename T, typename Allocator>
+    typename concurrent_vector<T, Allocator>::const_iterator concurrent_vector<T, Allocator>::end() const noexcept {
+      return const_iterator(this, size());
+    }
+
+    template<typename T, typename Allocator>
+    typename concurrent_vector<T, Allocator>::const_iterator concurrent_vector<T, Allocator>::cbegin() const noexcept {
+      return begin();
+    }
+
+    template<typename T, typename Allocator>
+    typename concurrent_vector<T, Allocator>::const_iterator concurrent_vector<T, Allocator>::cend() const noexcept {
+      return end();
+    }
+
+    template<typename T, typename Allocator>
+    size_t concurrent_vector<T, Allocator>::size() const noexcept {
+      return size_.load(std::memory_order_acquire);
+    }
+
+    template<typename T, typename Allocator>
+    bool concurrent_vector<T, Allocator>::empty() const noexcept {
+      return size() == 0;
+    }
+
+    template<typename T, typename Allocator>
+    size_t concurrent_vector<T, Allocator>::capacity() const noexcept {
+      size_t capacity = 0;
+      for (size_t segment = 0; segment < max_segments && segments_[segment].load(std::memory_order_acquire); ++segment) {
+        capacity += segment_size(segment);
+      }
+      return capacity;
+    }
+
+    template<typename T, typename Allocator>
+    void concurrent_vector<T, Allocator>::clear() noexcept {
+      destroy_elements();
+      size_.store(0, std::memory_order_relaxed);
+    }
+
+    template<typename T, typename Allocator>
+    void concurrent_vector<T, Allocator>::clear_and_free() noexcept {
+      destroy_and_deallocate();
+      size_.store(0, std::memory_order_relaxed);
+    }
+
+    template<typename T, typename Allocator>
+    void concurrent_vector<T, Allocator>::swap(concurrent_vector& other) noexcept {
+      if constexpr (alloc_traits::propagate_on_container_swap::value) {
+        using std::swap;
+        swap(allocator(), other.allocator());
+      }
+      for (size_t segment = 0; segment < max_segments; ++segment) {
+        segments_[segment].store(other.segments_[segment].exchange(segments_[segment].load(std::memory_order_relaxed),
+                                                                   std::memory_order_relaxed),
+                                 std::memory_order_relaxed);
+      }
+      size_.store(other.size_.exchange(size_.load(std::memory_order_relaxed), std::memory_order_relaxed),
+                  std::memory_order_relaxed);
+    }
+
+    template<typename T, typename Allocator>
+    typename concurrent_vector<T, Allocator>::allocator_type concurrent_vector<T, Allocator>::get_allocator() const noexcept {
+      return allocator();
+    }
+
+} // namespace my_vector
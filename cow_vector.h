@@ -0,0 +1,406 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_COW_VECTOR_H
+#define VECTOR_COW_VECTOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+
+#include "growth_policy.h"
+#include "iterator.h"
+#include "relocation.h"
+#include "span.h"
+#include "vector.h"
+
+namespace my_vector {
+
+    template<typename T, typename Allocator>
+    class cow_view;
+
+/**
+ * @brief A vector whose copies share one buffer until one of them writes.
+ *
+ * The elements live in a single allocation behind a header with an atomic reference count.
+ * Copying a cow_vector only increments the count, so handing the same table to many threads
+ * costs O(1) per copy. The first modifying call on a copy whose buffer is shared detaches it:
+ * the copy gets a private buffer with copies of the elements, and the other owners keep the
+ * original. A buffer that is not shared is modified in place, like a vector's.
+ *
+ * Read access is const only. Writes go through the modifying functions, set() or
+ * mutable_data(), which detach first. view() returns a read-only cow_view that shares the
+ * buffer and so never changes, whatever the vector does afterwards.
+ *
+ * Like std::shared_ptr, different objects that share a buffer may be used from different
+ * threads at once; a single object must not be used from several threads while one writes.
+ * Copies share only when their allocators compare equal; otherwise copying is a deep copy.
+ *
+ * @tparam T The type of elements stored in the vector.
+ * @tparam Allocator The allocator for elements, rebound to bytes for the buffers.
+ */
+    template<typename T, typename Allocator = std::allocator<T>>
+    class cow_vector : private detail::allocator_holder<Allocator> {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "cow_vector does not support over-aligned types");
+
+        using alloc_traits = std::allocator_traits<Allocator>;
+        using byte_allocator = typename alloc_traits::template rebind_alloc<unsigned char>;
+        using byte_traits = std::allocator_traits<byte_allocator>;
+        using detail::allocator_holder<Allocator>::allocator;
+
+        /**
+         * @brief The start of a buffer, followed by capacity elements.
+         */
+        struct buffer_header {
+            std::atomic<size_t> refs; /// Number of cow_vector objects that share the buffer
+            size_t size; /// Number of elements
+            size_t capacity; /// Number of elements the buffer can hold
+        };
+
+        static constexpr size_t elements_offset = (sizeof(buffer_header) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+        buffer_header* buffer_; /// The shared buffer, or nullptr while the vector has never held anything
+
+      /**
+       * @brief Returns the elements of a buffer.
+       */
+        static T* elements(buffer_header* buffer) noexcept;
+
+      /**
+       * @brief Allocates a buffer with a reference count of one and no elements.
+       */
+        buffer_header* allocate(size_t capacity);
+
+      /**
+       * @brief Frees a buffer without destroying its elements.
+       */
+        void deallocate(buffer_header* buffer) noexcept;
+
+      /**
+       * @brief Drops this vector's reference, destroying the buffer if it was the last one.
+       */
+        void release() noexcept;
+
+      /**
+       * @brief Checks whether another vector shares the buffer.
+       */
+        bool is_shared() const noexcept;
+
+      /**
+       * @brief Makes the buffer private to this vector and able to hold required elements.
+       *
+       * A shared buffer is copied, a private one is reallocated only when it is too small.
+       * On an exception the vector is unchanged.
+       */
+        void detach(size_t required);
+
+      /**
+       * @brief Shares the buffer of another vector, or copies its elements if the allocators differ.
+       */
+        void share_or_copy(const cow_vector& other);
+
+      /**
+       * @brief Checks if the vector is empty.
+       *
+       * @return True if the vector is empty, false otherwise.
+       */
+        bool is_empty() const noexcept;
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using const_reference = const T&;
+        using const_pointer = const T*;
+        using const_iterator = detail::contiguous_iterator<const T, cow_vector>;
+        using iterator = const_iterator;
+
+        /**
+         * @brief Default constructor.
+         *
+         * Creates an empty vector without allocating.
+         */
+        cow_vector() noexcept(std::is_nothrow_default_constructible<Allocator>::value);
+
+        /**
+         * @brief Constructs an empty vector that uses the given allocator.
+         *
+         * @param alloc The allocator to use.
+         */
+        explicit cow_vector(const Allocator& alloc) noexcept;
+
+        /**
+         * @brief Constructor with size and value.
+         *
+         * @param size The number of elements to initialize.
+         * @param value The value to initialize each element with.
+         * @param alloc The allocator to use.
+         */
+        cow_vector(size_t size, const T& value, const Allocator& alloc = Allocator());
+
+        /**
+         * @brief Constructor with initializer list.
+         *
+         * @param init The initializer list to initialize the elements.
+         * @param alloc The allocator to use.
+         */
+        cow_vector(std::initializer_list<T> init, const Allocator& alloc = Allocator());
+
+        /**
+         * @brief Copy constructor. Shares the buffer, so it takes O(1).
+         *
+         * @param other The vector to copy from.
+         */
+        cow_vector(const cow_vector& other);
+
+        /**
+         * @brief Copy constructor with allocator. Shares the buffer if the allocators compare equal.
+         *
+         * @param other The vector to copy from.
+         * @param alloc The allocator to use.
+         */
+        cow_vector(const cow_vector& other, const Allocator& alloc);
+
+        /**
+         * @brief Copy assignment operator. Shares the buffer if the allocators compare equal.
+         *
+         * @param other The vector to copy from.
+         * @return A reference to the assigned vector.
+         */
+        cow_vector& operator=(const cow_vector& other);
+
+        /**
+         * @brief Move constructor. Takes over the reference to the buffer.
+         *
+         * @param other The vector to move from.
+         */
+        cow_vector(cow_vector&& other) noexcept;
+
+        /**
+         * @brief Move assignment operator.
+         *
+         * Takes over the buffer if the allocators propagate or compare equal, and copies the
+         * elements otherwise.
+         *
+         * @param other The vector to move from.
+         * @return A reference to the assigned vector.
+         */
+        cow_vector& operator=(cow_vector&& other)
+            noexcept(alloc_traits::propagate_on_container_move_assignment::value
+                     || alloc_traits::is_always_equal::value);
+
+        /**
+         * @brief Destructor. Frees the buffer if no other vector shares it.
+         */
+        ~cow_vector();
+
+        /**
+         * @brief Appends a copy of the value, detaching first if the buffer is shared.
+         *
+         * @param value The value to append.
+         */
+        void push_back(const T& value);
+
+        /**
+         * @brief Appends the value by moving it, detaching first if the buffer is shared.
+         *
+         * @param value The value to append.
+         */
+        void push_back(T&& value);
+
+        /**
+         * @brief Constructs an element in place at the end, detaching first if the buffer is shared.
+         *
+         * @param args The arguments for the constructor of T.
+         * @return A reference to the new element, valid until the vector is next copied or modified.
+         */
+        template<typename... Args>
+        T& emplace_back(Args&&... args);
+
+        /**
+         * @brief Removes the last element, detaching first if the buffer is shared.
+         *
+         * @throws std::out_of_range if the vector is empty.
+         */
+        void pop_back();
+
+        /**
+         * @brief Replaces the element at the specified position, detaching first if the buffer is shared.
+         *
+         * @param index The position of the element.
+         * @param value The new value.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        void set(size_t index, const T& value);
+
+        /**
+         * @brief Changes the number of elements, value-initializing new ones.
+         *
+         * @param new_size The new number of elements.
+         */
+        void resize(size_t new_size);
+
+        /**
+         * @brief Changes the number of elements, copying the value into new ones.
+         *
+         * @param new_size The new number of elements.
+         * @param value The value to copy into new elements.
+         */
+        void resize(size_t new_size, const T& value);
+
+        /**
+         * @brief Detaches the buffer and returns a pointer to the elements for writing.
+         *
+         * The pointer is valid until the vector is next modified. Writes through it must not
+         * happen after the vector has been copied again, or the copy would see them.
+         */
+        T* mutable_data();
+
+        /**
+         * @brief Accesses the element at the specified position.
+         *
+         * @param index The position of the element to access.
+         * @return A const reference to the element.
+         */
+        const T& operator[] (size_t index) const noexcept;
+
+        /**
+         * @brief Accesses the element at the specified position with bounds checking.
+         *
+         * @param index The position of the element to access.
+         * @return A const reference to the element.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        const T& at(size_t index) const;
+
+        /**
+         * @brief Accesses the first element.
+         *
+         * @throws std::out_of_range if the vector is empty.
+         */
+        const T& front() const;
+
+        /**
+         * @brief Accesses the last element.
+         *
+         * @throws std::out_of_range if the vector is empty.
+         */
+        const T& back() const;
+
+        /**
+         * @brief Returns a pointer to the first element, or nullptr if nothing was ever allocated.
+         */
+        const T* data() const noexcept;
+
+        /**
+         * @brief Returns a read-only view that shares the buffer and is unaffected by later writes.
+         */
+        cow_view<T, Allocator> view() const;
+
+        /**
+         * @brief Returns an iterator to the first element.
+         */
+        const_iterator begin() const noexcept;
+
+        /**
+         * @brief Returns an iterator past the last element.
+         */
+        const_iterator end() const noexcept;
+
+        /**
+         * @brief Returns an iterator to the first element.
+         */
+        const_iterator cbegin() const noexcept;
+
+        /**
+         * @brief Returns an iterator past the last element.
+         */
+        const_iterator cend() const noexcept;
+
+        /**
+         * @brief Returns the number of elements.
+         */
+        [[nodiscard]] size_t size() const noexcept;
+
+        /**
+         * @brief Returns the number of elements the buffer can hold.
+         */
+        [[nodiscard]] size_t capacity() const noexcept;
+
+        /**
+         * @brief Returns the number of vectors and views that share the buffer, zero without one.
+         */
+        [[nodiscard]] size_t use_count() const noexcept;
+
+        /**
+         * @brief Ensures a private buffer that can hold at least the given number of elements.
+         *
+         * @param min_capacity The minimum capacity.
+         */
+        void ensure_capacity(size_t min_capacity);
+
+        /**
+         * @brief Removes all elements. A shared buffer is released instead of being copied.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Exchanges the contents with another vector.
+         *
+         * @param other The vector to swap with.
+         */
+        void swap(cow_vector& other) noexcept;
+
+        /**
+         * @brief Returns the allocator associated with the vector.
+         */
+        allocator_type get_allocator() const noexcept;
+    };
+
+/**
+ * @brief An immutable snapshot of a cow_vector's elements.
+ *
+ * Holds a reference to the buffer, so it stays valid and unchanged while the vector it came
+ * from is modified or destroyed. Copying a view takes O(1).
+ */
+    template<typename T, typename Allocator = std::allocator<T>>
+    class cow_view {
+        cow_vector<T, Allocator> elements_; /// Shares the buffer and is never modified
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using const_reference = const T&;
+        using const_iterator = typename cow_vector<T, Allocator>::const_iterator;
+        using iterator = const_iterator;
+
+        cow_view() = default;
+
+        /**
+         * @brief Creates a view that shares the buffer of a vector.
+         *
+         * @param source The vector to view.
+         */
+        explicit cow_view(const cow_vector<T, Allocator>& source) : elements_(source, source.get_allocator()) {}
+
+        const T& operator[] (size_t index) const noexcept { return elements_[index]; }
+        const T& at(size_t index) const { return elements_.at(index); }
+        const T* data() const noexcept { return elements_.data(); }
+        [[nodiscard]] size_t size() const noexcept { return elements_.size(); }
+
+        const_iterator begin() const noexcept { return elements_.begin(); }
+        const_iterator end() const noexcept { return elements_.end(); }
+
+        /**
+         * @brief Returns the elements as a span.
+         */
+        span<const T> elements() const noexcept { return span<const T>(elements_.data(), elements_.size()); }
+    };
+
+} // namespace my_vector
+
+#include "cow_vector_impl.h"
+
+#endif //VECTOR_COW_VECTOR_H
@@ -0,0 +1,413 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace my_vector {
+
+    template<typename T, typename Allocator>
+    T* cow_vector<T, Allocator>::elements(buffer_header* buffer) noexcept {
+      return reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(buffer) + elements_offset);
+    }
+
+    template<typename T, typename Allocator>
+    typename cow_vector<T, Allocator>::buffer_header* cow_vector<T, Allocator>::allocate(size_t capacity) {
+      if (capacity > (alloc_traits::max_size(allocator()) - elements_offset / sizeof(T))) {
+        throw std::length_error("cow_vector: capacity too large");
+      }
+      byte_allocator bytes(allocator());
+      unsigned char* memory = byte_traits::allocate(bytes, elements_offset + capacity * sizeof(T));
+      return ::new (static_cast<void*>(memory)) buffer_header{{1}, 0, capacity};
+    }
+
+    template<typename T, typename Allocator>
+    void cow_vector<T, Allocator>::deallocate(buffer_header* buffer) noexcept {
+      const size_t bytes_used = elements_offset + buffer->capacity * sizeof(T);
+      buffer->~buffer_header();
+      byte_allocator bytes(allocator());
+      byte_traits::deallocate(bytes, reinterpret_cast<unsigned char*>(buffer), bytes_used);
+    }
+
+    template<typename T, typename Allocator>
+    void cow_vector<T, Allocator>::release() noexcept {
+      // The last owner's acquire pairs with every other owner's release, so their reads of
+      // the elements happen before the elements are destroyed.
+      if (buffer_ && buffer_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        T* first = elements(buffer_);
+        for (size_t i = 0; i < buffer_->size; ++i) {
+          alloc_traits::destroy(allocator(), first + i);
+        }
+        deallocate(buffer_);
+      }
+      buffer_ = nullptr;
+    }
+
+    template<typename T, typename Allocator>
+    bool cow_vector<T, Allocator>::is_shared() const noexcept {
+      return buffer_ && buffer_->refs.load(std::memory_order_acquire) > 1;
+    }
+
+    template<typename T, typename Allocator>
+    void cow_vector<T, Allocator>::detach(size_t required) {
+      const bool shared = is_shared();
+      const size_t capacity = buffer_ ? buffer_->capacity : 0;
+      if (buffer_ && !shared && required <= capacity) {
+        return;
+      }
+      const size_t count = size();
+      const size_t new_capacity = required <= capacity ? capacity
+                                                       : double_growth::next_capacity(capacity, required, sizeof(T));
+      buffer_header* fresh = allocate(new_capacity);
+      if (shared) {
+        // Other owners still read the old elements, so they are copied rather than moved.
+        T* source = elements(buffer_);
+        T* target = elements(fresh);
+        size_t built = 0;
+        try {
+          for (; built < count; ++built) {
+            alloc_traits::construct(allocator(), target + built, source[built]);
+          }
+        } catch (...) {
+          for (size_t i = 0; i < built; ++i) {
+            alloc_traits::destroy(allocator(), target + i);
+          }
+          deallocate(fresh);
+          throw;
+        }
+        fresh->size = count;
+        release();
+      } else if (buffer_) {
+        try {
+          detail::relocate(allocator(), elements(buffer_), count, elements(fresh));
+        } catch (...) {
+          deallocate(fresh);
+          throw;
+        }
+        fresh->size = count;
+        deallocate(buffer_);
+      }
+      buffer_ = fresh;
+    }
+
+    template<typename T, typename Allocator>
+    void cow_vector<T, Allocator>::share_or_copy(const cow_vector& other) {
+      if (!other.buffer_) {
+        return;
+      }
+      if (allocator() == other.allocator()) {
+        other.buffer_->refs.fetch_add(1, std::memory_order_relaxed);
+        buffer_ = other.buffer_;
+        return;
+      }
+      // Storage cannot change hands between unequal allocators, copy element-wise instead.
+      buffer_ = allocate(other.size());
+      T* target = elements(buffer_);
+      for (; buffer_->size < other.size(); ++buffer_->size) {
+        alloc_traits::construct(allocator(), target + buffer_->size, other[buffer_->size]);
+      }
+    }
+
+    template<typename T, typename Allocator>
+    bool cow_vector<T, Allocator>::is_empty() const noexcept {
+      return size() == 0;
+    }
+
+    template<typename T, typename Allocator>
+    cow_vector<T, Allocator>::cow_vector() noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+        : buffer_(nullptr) {
+    }
+
+    template<typename T, typename Allocator>
+    cow_vector<T, Allocator>::cow_vector(const Allocator& alloc) noexcept
+        : detail::allocator_holder<Allocator>(alloc), buffer_(nullptr) {
+    }
+
+    template<typename T, typename Allocator>
+    cow_vector<T, Allocator>::cow_vector(size_t size, const T& value, const Allocator& alloc) : cow_vector(alloc) {
+      try {
+        resize(size, value);
+      } catch (...) {
+        release();
+        throw;
+      }
+    }
+
+    template<typename T, typename Allocator>
+    cow_vector<T, Allocator>::cow_vector(std::initializer_list<T> init, const Allocator& alloc) : cow_vector(alloc) {
+      try {
+        ensure_capacity(init.size());
+        for (const T& value : init) {
+          push_back(value);
+        }
+      } catch (...) {
+        release();
+        throw;
+      }
+    }
+
+    template<typename T, typename Allocator>
+    cow_vector<T, Allocator>::cow_vector(const cow_vector& other)
+        : cow_vector(other, alloc_traits::select_on_container_copy_construction(other.allocator())) {
+    }
+
+    template<typename T, typename Allocator>
+    cow_vector<T, Allocator>::cow_vector(const cow_vector& other, const Allocator& alloc) : cow_vector(alloc) {
+      try {
+        share_or_copy(other);
+      } catch (...) {
+        release();
+        throw;
+      }
+    }
+
+    template<typename T, typename Allocator>
+    cow_vector<T, Allocator>& cow_vector<T, Allocator>::operator=(const cow_vector& other) {
+      if (buffer_ != other.buffer_) {
+        release();
+        if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+          allocator() = other.allocator();
+        }
+        try {
+          share_or_copy(other);
+        } catch (...) {
+          release();
+          throw;
+        }
+      }
+      return *this;
+    }
+
+    template<typename T, typename Allocator>
+    cow_vector<T, Allocator>::cow_vector(cow_vector&& other) noexcept
+        : detail::allocator_holder<Allocator>(std::move(other.allocator())),
+          buffer_(std::exchange(other.buffer_, nullptr)) {
+    }
+
+    template<typename T, typename Allocator>
+    cow_vector<T, Allocator>& cow_vector<T, Allocator>::operator=(cow_vector&& other)
+        noexcept(alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value) {
+      if (this != &other) {
+        release();
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+          allocator() = std::move(other.allocator());
+        } else if (allocator() != other.allocator()) {
+          share_or_copy(other);
+          return *this;
+        }
+        buffer_ = std::exchange(other.buffer_, nullptr);
+      }
+      return *this;
+    }
+
+    template<typename T, typename Allocator>
+    cow_vector<T, Allocator>::~cow_vector() {
+      release();
+    }
+
+    template<typename T, typename Allocator>
+    void cow_vector<T, Allocator>::push_back(const T& value) {
+      emplace_back(value);
+    }
+
+    template<typename T, typename Allocator>
+    void cow_vector<T, Allocator>::push_back(T&& value) {
+      emplace_back(std::move(value));
+    }
+
+    template<typename T, typename Allocator>
+    template<typename... Args>
+    T& cow_vector<T, Allocator>::emplace_back(Args&&... args) {
+      const size_t count = size();
+      if (!buffer_ || count == buffer_->capacity || is_shared()) {
+        // The arguments may refer into the buffer that detaching releases.
+        T value(std::forward<Args>(args)...);
+        detach(count + 1);
+        alloc_traits::construct(allocator(), elements(buffer_) + count, std::move(value));
+      } else {
+        alloc_traits::construct(allocator(), elements(buffer_) + count, std::forward<Args>(args)...);
+      }
+      ++buffer_->size;
+      return elements(buffer_)[count];
+    }
+
+    template<typename T, typename Allocator>
+    void cow_vector<T, Allocator>::pop_back() {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      detach(size());
+      alloc_traits::destroy(allocator(), elements(buffer_) + --buffer_->size);
+    }
+
+    template<typename T, typename Allocator>
+    void cow_vector<T, Allocator>::set(size_t index, const T& value) {
+      if (index >= size()) {
+        throw std::out_of_range("Index out of range");
+      }
+      if (is_shared()) {
+        T copy(value);
+        detach(size());
+        elements(buffer_)[index] = std::move(copy);
+      } else {
+        elements(buffer_)[index] = value;
+      }
+    }
+
+    template<typename T, typename Allocator>
+    void cow_vector<T, Allocator>::resize(size_t new_size) {
+      if (new_size == size()) {
+        return;
+      }
+      detach(new_size);
+      T* first = elements(buffer_);
+      for (; buffer_->size > new_size; --buffer_->size) {
+        alloc_traits::destroy(allocator(), first + buffer_->size - 1);
+      }
+      for (; buffer_->size < new_size; ++buffer_->size) {
+        alloc_traits::construct(allocator(), first + buffer_->size);
+      }
+    }
+
+    template<typename T, typename Allocator>
+    void cow_vector<T, Allocator>::resize(size_t new_size, const T& value) {
+      if (new_size == size()) {
+        return;
+      }
+      if (new_size > capacity() || is_shared()) {
+        // The value may refer into the buffer that detaching releases.
+        const T copy(value);
+        detach(new_size);
+        resize(new_size, copy);
+        return;
+      }
+      T* first = elements(buffer_);
+      for (; buffer_->size > new_size; --buffer_->size) {
+        alloc_traits::destroy(allocator(), first + buffer_->size - 1);
+      }
+      for (; buffer_->size < new_size; ++buffer_->size) {
+        alloc_traits::construct(allocator(), first + buffer_->size, value);
+      }
+    }
+
+    template<typename T, typename Allocator>
+    T* cow_vector<T, Allocator>::mutable_data() {
+      if (!buffer_) {
+        return nullptr;
+      }
+      detach(size());
+      return elements(buffer_);
+    }
+
+    template<typename T, typename Allocator>
+    const T& cow_vector<T, Allocator>::operator[](size_t index) const noexcept {
+      return elements(buffer_)[index];
+    }
+
+    template<typename T, typename Allocator>
+    const T& cow_vector<T, Allocator>::at(size_t index) const {
+      if (index >= size()) {
+        throw std::out_of_range("Index out of range");
+      }
+      return (*this)[index];
+    }
+
+    template<typename T, typename Allocator>
+    const T& cow_vector<T, Allocator>::front() const {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      return (*this)[0];
+    }
+
+    template<typename T, typename Allocator>
+    const T& cow_vector<T, Allocator>::back() const {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      return (*this)[size() - 1];
+    }
+
+    template<typename T, typename Allocator>
+    const T* cow_vector<T, Allocator>::data() const noexcept {
+      return buffer_ ? elements(buffer_) : nullptr;
+    }
+
+    template<typename T, typename Allocator>
+    cow_view<T, Allocator> cow_vector<T, Allocator>::view() const {
+      return cow_view<T, Allocator>(*this);
+    }
+
+    template<typename T, typename Allocator>
+    typename cow_vector<T, Allocator>::const_iterator cow_vector<T, Allocator>::begin() const noexcept {
+      return const_iterator(data());
+    }
+
+    template<typename T, typename Allocator>
+    typename cow_vector<T, Allocator>::const_iterator cow_vector<T, Allocator>::end() const noexcept {
+      return const_iterator(data() + size());
+    }
+
+    template<typename T, typename Allocator>
+    typename cow_vector<T, Allocator>::const_iterator cow_vector<T, Allocator>::cbegin() const noexcept {
+      return begin();
+    }
+
+    template<typename T, typename Allocator>
+    typename cow_vector<T, Allocator>::const_iterator cow_vector<T, Allocator>::cend() const noexcept {
+      return end();
+    }
+
+    template<typename T, typename Allocator>
+    size_t cow_vector<T, Allocator>::size() const noexcept {
+      return buffer_ ? buffer_->size : 0;
+    }
+
+    template<typename T, typename Allocator>
+    size_t cow_vector<T, Allocator>::capacity() const noexcept {
+      return buffer_ ? buffer_->capacity : 0;
+    }
+
+    template<typename T, typename Allocator>
+    size_t cow_vector<T, Allocator>::use_count() const noexcept {
+      return buffer_ ? buffer_->refs.load(std::memory_order_relaxed) : 0;
+    }
+
+    template<typename T, typename Allocator>
+    void cow_vector<T, Allocator>::ensure_capacity(size_t min_capacity) {
+      if (min_capacity > capacity() || is_shared()) {
+        detach(min_capacity);
+      }
+    }
+
+    template<typename T, typename Allocator>
+    void cow_vector<T, Allocator>::clear() noexcept {
+      if (is_shared()) {
+        release();
+        return;
+      }
+      if (buffer_) {
+        T* first = elements(buffer_);
+        for (; buffer_->size > 0; --buffer_->size) {
+          alloc_traits::destroy(allocator(), first + buffer_->size - 1);
+        }
+      }
+    }
+
+    template<typename T, typename Allocator>
+    void cow_vector<T, Allocator>::swap(cow_vector& other) noexcept {
+      if constexpr (alloc_traits::propagate_on_container_swap::value) {
+        using std::swap;
+        swap(allocator(), other.allocator());
+      }
+      std::swap(buffer_, other.buffer_);
+    }
+
+    template<typename T, typename Allocator>
+    typename cow_vector<T, Allocator>::allocator_type cow_vector<T, Allocator>::get_allocator() const noexcept {
+      return allocator();
+    }
+
+} // namespace my_vector
@@ -0,0 +1,448 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_DEVECTOR_H
+#define VECTOR_DEVECTOR_H
+
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+
+#include "iterator.h"
+#include "relocation.h"
+#include "vector.h"
+
+namespace my_vector {
+
+/**
+ * @brief A double-ended vector.
+ *
+ * Like vector, the elements are stored contiguously and data() points at the first one.
+ * Unlike vector, spare capacity is kept on both sides of the elements, so push_front and
+ * pop_front are amortized O(1) just like push_back and pop_back. When one side runs out,
+ * the elements are re-centered in the existing buffer if it is at most half full, or moved
+ * to the middle of a buffer twice the size otherwise.
+ *
+ * @tparam T The type of elements stored in the devector.
+ * @tparam Allocator The allocator used to obtain storage.
+ */
+    template<typename T, typename Allocator = std::allocator<T>>
+    class devector : private detail::allocator_holder<Allocator> {
+        using alloc_traits = std::allocator_traits<Allocator>;
+        using detail::allocator_holder<Allocator>::allocator;
+
+        T* storage_; /// Pointer to the allocated storage
+        size_t capacity_; /// Number of elements the storage can hold
+        size_t front_; /// Index of the first element within the storage
+        size_t size_; /// Number of elements in the devector
+
+      /**
+       * @brief Makes room for the given number of elements at each end.
+       *
+       * Re-centers the elements when the storage is at most half full: in place if they can
+       * be moved without throwing, otherwise into new storage of the same capacity. Otherwise
+       * it reallocates to the larger of the required size and twice the current capacity. In
+       * every case the free space is split evenly between the two ends.
+       *
+       * @param front_count The number of free slots needed before the first element.
+       * @param back_count The number of free slots needed after the last element.
+       */
+        void make_room(size_t front_count, size_t back_count);
+
+      /**
+       * @brief Moves the elements into new storage of the given capacity.
+       *
+       * @param new_capacity The capacity of the new storage, at least size_.
+       * @param new_front The index of the first element within the new storage.
+       */
+        void reallocate(size_t new_capacity, size_t new_front);
+
+      /**
+       * @brief Checks if the devector is empty.
+       *
+       * @return True if the devector is empty, false otherwise.
+       */
+        bool is_empty() const noexcept;
+
+      /**
+       * @brief Destroys all elements and returns the storage to the allocator, leaving the devector empty.
+       */
+        void destroy_and_deallocate() noexcept;
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using iterator = detail::contiguous_iterator<T, devector>;
+        using const_iterator = detail::contiguous_iterator<const T, devector>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        /**
+         * @brief Default constructor.
+         *
+         * Creates an empty devector without allocating.
+         */
+        devector() noexcept(std::is_nothrow_default_constructible<Allocator>::value);
+
+        /**
+         * @brief Constructs an empty devector that obtains its storage from the given allocator.
+         *
+         * @param alloc The allocator to use.
+         */
+        explicit devector(const Allocator& alloc) noexcept;
+
+        /**
+         * @brief Constructor with size and value.
+         *
+         * @param size The number of elements to initialize.
+         * @param value The value to initialize each element with.
+         * @param alloc The allocator to use.
+         */
+        devector(size_t size, T value, const Allocator& alloc = Allocator());
+
+        /**
+         * @brief Copy constructor.
+         *
+         * The copy is tightly packed, so it has no spare capacity on either side.
+         *
+         * @param other The devector to copy from.
+         */
+        devector(const devector<T, Allocator>& other);
+
+        /**
+         * @brief Copy constructor with an explicit allocator.
+         *
+         * @param other The devector to copy from.
+         * @param alloc The allocator to use for the copy.
+         */
+        devector(const devector<T, Allocator>& other, const Allocator& alloc);
+
+        /**
+         * @brief Copy assignment operator.
+         *
+         * @param other The devector to copy from.
+         * @return A reference to the assigned devector.
+         */
+        devector<T, Allocator>& operator=(const devector<T, Allocator>& other);
+
+        /**
+         * @brief Move constructor.
+         *
+         * @param other The devector to move from.
+         */
+        devector(devector<T, Allocator>&& other) noexcept;
+
+        /**
+         * @brief Move assignment operator.
+         *
+         * If the allocator does not propagate and the two allocators differ, the elements are
+         * moved one by one.
+         *
+         * @param other The devector to move from.
+         * @return A reference to the assigned devector.
+         */
+        devector<T, Allocator>& operator=(devector<T, Allocator>&& other)
+            noexcept(alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value);
+
+        /**
+         * @brief Destructor.
+         */
+        ~devector();
+
+        /**
+         * @brief Accesses the element at the specified position.
+         *
+         * @param index The position of the element to access.
+         * @return A reference to the element at the specified position.
+         */
+        T& operator[] (size_t index);
+
+        /**
+         * @brief Accesses the element at the specified position (const version).
+         *
+         * @param index The position of the element to access.
+         * @return A const reference to the element at the specified position.
+         */
+        const T& operator[] (size_t index) const;
+
+        /**
+         * @brief Returns an iterator to the first element.
+         *
+         * @return An iterator to the first element.
+         */
+        iterator begin() noexcept;
+
+        /**
+         * @brief Returns a const iterator to the first element.
+         *
+         * @return A const iterator to the first element.
+         */
+        const_iterator begin() const noexcept;
+
+        /**
+         * @brief Returns an iterator past the last element.
+         *
+         * @return An iterator past the last element.
+         */
+        iterator end() noexcept;
+
+        /**
+         * @brief Returns a const iterator past the last element.
+         *
+         * @return A const iterator past the last element.
+         */
+        const_iterator end() const noexcept;
+
+        /**
+         * @brief Returns a const iterator to the first element.
+         *
+         * @return A const iterator to the first element.
+         */
+        const_iterator cbegin() const noexcept;
+
+        /**
+         * @brief Returns a const iterator past the last element.
+         *
+         * @return A const iterator past the last element.
+         */
+        const_iterator cend() const noexcept;
+
+        /**
+         * @brief Returns a reverse iterator to the last element.
+         *
+         * @return A reverse iterator to the last element.
+         */
+        reverse_iterator rbegin() noexcept;
+
+        /**
+         * @brief Returns a const reverse iterator to the last element.
+         *
+         * @return A const reverse iterator to the last element.
+         */
+        const_reverse_iterator rbegin() const noexcept;
+
+        /**
+         * @brief Returns a reverse iterator before the first element.
+         *
+         * @return A reverse iterator before the first element.
+         */
+        reverse_iterator rend() noexcept;
+
+        /**
+         * @brief Returns a const reverse iterator before the first element.
+         *
+         * @return A const reverse iterator before the first element.
+         */
+        const_reverse_iterator rend() const noexcept;
+
+        /**
+         * @brief Adds an element to the end of the devector.
+         *
+         * @param value The value to add.
+         */
+        void push_back(const T& value);
+
+        /**
+         * @brief Adds an element to the end of the devector using move semantics.
+         *
+         * @param value The value to add.
+         */
+        void push_back(T&& value);
+
+        /**
+         * @brief Adds an element to the front of the devector in amortized O(1).
+         *
+         * @param value The value to add.
+         */
+        void push_front(const T& value);
+
+        /**
+         * @brief Adds an element to the front of the devector using move semantics, in amortized O(1).
+         *
+         * @param value The value to add.
+         */
+        void push_front(T&& value);
+
+        /**
+         * @brief Removes the last element of the devector.
+         *
+         * @throws std::out_of_range if the devector is empty.
+         */
+        void pop_back();
+
+        /**
+         * @brief Removes the first element of the devector in O(1).
+         *
+         * @throws std::out_of_range if the devector is empty.
+         */
+        void pop_front();
+
+        /**
+         * @brief Destroys all elements, keeping the storage.
+         *
+         * The free space is re-centered, so both ends can grow afterwards.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Swaps the contents of this devector with another devector.
+         *
+         * @param other The devector to swap with.
+         */
+        void swap(devector& other) noexcept;
+
+        /**
+         * @brief Returns the number of elements in the devector.
+         *
+         * @return The number of elements in the devector.
+         */
+        [[nodiscard]] size_t size() const noexcept;
+
+        /**
+         * @brief Returns the total capacity of the storage, counting spare room at both ends.
+         *
+         * @return The capacity of the devector.
+         */
+        [[nodiscard]] size_t capacity() const noexcept;
+
+        /**
+         * @brief Returns the number of elements that can be pushed to the front without moving anything.
+         *
+         * @return The free space before the first element.
+         */
+        [[nodiscard]] size_t front_free_capacity() const noexcept;
+
+        /**
+         * @brief Returns the number of elements that can be pushed to the back without moving anything.
+         *
+         * @return The free space after the last element.
+         */
+        [[nodiscard]] size_t back_free_capacity() const noexcept;
+
+        /**
+         * @brief Accesses the element at the specified position.
+         *
+         * @param index The position of the element to access.
+         * @return A reference to the element at the specified position.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        T& at(size_t index);
+
+        /**
+         * @brief Accesses the element at the specified position (const version).
+         *
+         * @param index The position of the element to access.
+         * @return A const reference to the element at the specified position.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        const T& at(size_t index) const;
+
+        /**
+         * @brief Accesses the first element.
+         *
+         * @return A reference to the first element.
+         * @throws std::out_of_range if the devector is empty.
+         */
+        T& front();
+
+        /**
+         * @brief Accesses the first element (const version).
+         *
+         * @return A const reference to the first element.
+         * @throws std::out_of_range if the devector is empty.
+         */
+        const T& front() const;
+
+        /**
+         * @brief Accesses the last element.
+         *
+         * @return A reference to the last element.
+         * @throws std::out_of_range if the devector is empty.
+         */
+        T& back();
+
+        /**
+         * @brief Accesses the last element (const version).
+         *
+         * @return A const reference to the last element.
+         * @throws std::out_of_range if the devector is empty.
+         */
+        const T& back() const;
+
+        /**
+         * @brief Resizes the devector, adding or removing elements at the back.
+         *
+         * @param new_size The new size of the devector.
+         */
+        void resize(size_t new_size);
+
+        /**
+         * @brief Resizes the devector, initializing new elements at the back with the specified value.
+         *
+         * @param new_size The new size of the devector.
+         * @param value The value to initialize new elements with.
+         */
+        void resize(size_t new_size, const T& value);
+
+        /**
+         * @brief Shrinks the storage to fit the elements, dropping the spare room at both ends.
+         */
+        void shrink_to_fit();
+
+        /**
+         * @brief Trims the capacity of the devector to match its size.
+         */
+        void trim_to_size();
+
+        /**
+         * @brief Ensures the devector has at least the specified total capacity.
+         *
+         * @param min_capacity The minimum capacity to ensure.
+         */
+        void ensure_capacity(size_t min_capacity);
+
+        /**
+         * @brief Returns a pointer to the first element.
+         *
+         * @return A pointer to the contiguous elements.
+         */
+        T* data() noexcept;
+
+        /**
+         * @brief Returns a const pointer to the first element.
+         *
+         * @return A const pointer to the contiguous elements.
+         */
+        const T* data() const noexcept;
+
+        /**
+         * @brief Returns a copy of the allocator associated with the devector.
+         *
+         * @return The allocator.
+         */
+        allocator_type get_allocator() const noexcept;
+    };
+
+    namespace pmr {
+
+    /**
+     * @brief A devector that obtains its storage from a std::pmr::memory_resource.
+     *
+     * @tparam T The type of elements stored in the devector.
+     */
+    template<typename T>
+    using devector = my_vector::devector<T, std::pmr::polymorphic_allocator<T>>;
+
+    } // namespace pmr
+
+} // namespace my_vector
+
+#include "devector_impl.h"
+
+#endif //VECTOR_DEVECTOR_H
@@ -0,0 +1,477 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace my_vector {
+
+    template<typename T, typename Allocator>
+    devector<T, Allocator>::devector() noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+        : storage_(nullptr), capacity_(0), front_(0), size_(0) {
+    }
+
+    template<typename T, typename Allocator>
+    devector<T, Allocator>::devector(const Allocator& alloc) noexcept
+        : detail::allocator_holder<Allocator>(alloc), storage_(nullptr), capacity_(0), front_(0), size_(0) {
+    }
+
+    template<typename T, typename Allocator>
+    devector<T, Allocator>::devector(size_t size, T value, const Allocator& alloc) : devector(alloc) {
+      if (size) {
+        storage_ = alloc_traits::allocate(allocator(), size);
+        capacity_ = size;
+      }
+      try {
+        for (; size_ < size; ++size_) {
+          alloc_traits::construct(allocator(), &storage_[size_], value);
+        }
+      } catch (...) {
+        destroy_and_deallocate();
+        throw;
+      }
+    }
+
+    template<typename T, typename Allocator>
+    devector<T, Allocator>::devector(const devector<T, Allocator>& other)
+        : devector(other, alloc_traits::select_on_container_copy_construction(other.allocator())) {
+    }
+
+    template<typename T, typename Allocator>
+    devector<T, Allocator>::devector(const devector<T, Allocator>& other, const Allocator& alloc) : devector(alloc) {
+      if (other.size_) {
+        storage_ = alloc_traits::allocate(allocator(), other.size_);
+        capacity_ = other.size_;
+      }
+      try {
+        for (; size_ < other.size_; ++size_) {
+          alloc_traits::construct(allocator(), &storage_[size_], other[size_]);
+        }
+      } catch (...) {
+        destroy_and_deallocate();
+        throw;
+      }
+    }
+
+    template<typename T, typename Allocator>
+    devector<T, Allocator>& devector<T, Allocator>::operator=(const devector<T, Allocator>& other) {
+      if (this != &other) {
+        destroy_and_deallocate();
+
+        if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+          allocator() = other.allocator();
+        }
+        if (other.size_) {
+          storage_ = alloc_traits::allocate(allocator(), other.size_);
+          capacity_ = other.size_;
+        }
+        for (; size_ < other.size_; ++size_) {
+          alloc_traits::construct(allocator(), &storage_[size_], other[size_]);
+        }
+      }
+      return *this;
+    }
+
+    template<typename T, typename Allocator>
+    devector<T, Allocator>::devector(devector<T, Allocator>&& other) noexcept
+        : detail::allocator_holder<Allocator>(std::move(other.allocator())),
+          storage_(other.storage_), capacity_(other.capacity_), front_(other.front_), size_(other.size_) {
+      other.storage_ = nullptr;
+      other.capacity_ = 0;
+      other.front_ = 0;
+      other.size_ = 0;
+    }
+
+    template<typename T, typename Allocator>
+    devector<T, Allocator>& devector<T, Allocator>::operator=(devector<T, Allocator>&& other)
+        noexcept(alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value) {
+      if (this != &other) {
+        destroy_and_deallocate();
+
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+          allocator() = std::move(other.allocator());
+        } else if (allocator() != other.allocator()) {
+          if (other.size_) {
+            storage_ = alloc_traits::allocate(allocator(), other.size_);
+            capacity_ = other.size_;
+          }
+          for (; size_ < other.size_; ++size_) {
+            alloc_traits::construct(allocator(), &storage_[size_], std::move(other[size_]));
+          }
+          return *this;
+        }
+
+        storage_ = other.storage_;
+        capacity_ = other.capacity_;
+        front_ = other.front_;
+        size_ = other.size_;
+        other.storage_ = nullptr;
+        other.capacity_ = 0;
+        other.front_ = 0;
+        other.size_ = 0;
+      }
+      return *this;
+    }
+
+    template<typename T, typename Allocator>
+    devector<T, Allocator>::~devector() {
+      destroy_and_deallocate();
+    }
+
+    template<typename T, typename Allocator>
+    void devector<T, Allocator>::destroy_and_deallocate() noexcept {
+      for (size_t i = 0; i < size_; ++i) {
+        alloc_traits::destroy(allocator(), &storage_[front_ + i]);
+      }
+      if (storage_) {
+        alloc_traits::deallocate(allocator(), storage_, capacity_);
+      }
+      storage_ = nullptr;
+      capacity_ = 0;
+      front_ = 0;
+      size_ = 0;
+    }
+
+    template<typename T, typename Allocator>
+    bool devector<T, Allocator>::is_empty() const noexcept {
+      return size_ == 0;
+    }
+
+    template<typename T, typename Allocator>
+    void devector<T, Allocator>::reallocate(size_t new_capacity, size_t new_front) {
+      T* new_storage = alloc_traits::allocate(allocator(), new_capacity);
+      try {
+        detail::relocate(allocator(), storage_ + front_, size_, new_storage + new_front);
+      } catch (...) {
+        alloc_traits::deallocate(allocator(), new_storage, new_capacity);
+        throw;
+      }
+      if (storage_) {
+        alloc_traits::deallocate(allocator(), storage_, capacity_);
+      }
+      storage_ = new_storage;
+      capacity_ = new_capacity;
+      front_ = new_front;
+    }
+
+    template<typename T, typename Allocator>
+    void devector<T, Allocator>::make_room(size_t front_count, size_t back_count) {
+      if (front_ >= front_count && capacity_ - front_ - size_ >= back_count) {
+        return;
+      }
+      const size_t required = size_ + front_count + back_count;
+      // At most half full: re-centering buys at least size_ / 2 pushes on either end.
+      const bool recenter = required <= capacity_ && size_ * 2 <= capacity_;
+      if constexpr (detail::is_nothrow_relocatable_v<T>) {
+        if (recenter) {
+          const size_t new_front = front_count + (capacity_ - required) / 2;
+          detail::relocate_within(allocator(), storage_ + front_, size_, storage_ + new_front);
+          front_ = new_front;
+          return;
+        }
+      }
+      // A move that may throw cannot shift the elements in place, so they are re-centered
+      // into fresh storage of the same capacity instead.
+      const size_t new_capacity = recenter ? capacity_ : std::max(required, capacity_ * 2);
+      reallocate(new_capacity, front_count + (new_capacity - required) / 2);
+    }
+
+    template<typename T, typename Allocator>
+    T& devector<T, Allocator>::operator[] (size_t index) {
+      return storage_[front_ + index];
+    }
+
+    template<typename T, typename Allocator>
+    const T& devector<T, Allocator>::operator[] (size_t index) const {
+      return storage_[front_ + index];
+    }
+
+    template<typename T, typename Allocator>
+    typename devector<T, Allocator>::iterator devector<T, Allocator>::begin() noexcept {
+      return iterator(storage_ + front_);
+    }
+
+    template<typename T, typename Allocator>
+    typename devector<T, Allocator>::const_iterator devector<T, Allocator>::begin() const noexcept {
+      return const_iterator(storage_ + front_);
+    }
+
+    template<typename T, typename Allocator>
+    typename devector<T, Allocator>::iterator devector<T, Allocator>::end() noexcept {
+      return iterator(storage_ + front_ + size_);
+    }
+
+    template<typename T, typename Allocator>
+    typename devector<T, Allocator>::const_iterator devector<T, Allocator>::end() const noexcept {
+      return const_iterator(storage_ + front_ + size_);
+    }
+
+    template<typename T, typename Allocator>
+    typename devector<T, Allocator>::const_iterator devector<T, Allocator>::cbegin() const noexcept {
+      return const_iterator(storage_ + front_);
+    }
+
+    template<typename T, typename Allocator>
+    typename devector<T, Allocator>::const_iterator devector<T, Allocator>::cend() const noexcept {
+      return const_iterator(storage_ + front_ + size_);
+    }
+
+    template<typename T, typename Allocator>
+    typename devector<T, Allocator>::reverse_iterator devector<T, Allocator>::rbegin() noexcept {
+      return reverse_iterator(end());
+    }
+
+    template<typename T, typename Allocator>
+    typename devector<T, Allocator>::const_reverse_iterator devector<T, Allocator>::rbegin() const noexcept {
+      return const_reverse_iterator(end());
+    }
+
+    template<typename T, typename Allocator>
+    typename devector<T, Allocator>::reverse_iterator devector<T, Allocator>::rend() noexcept {
+      return reverse_iterator(begin());
+    }
+
+    template<typename T, typename Allocator>
+    typename devector<T, Allocator>::const_reverse_iterator devector<T, Allocator>::rend() const noexcept {
+      return const_reverse_iterator(begin());
+    }
+
+    template<typename T, typename Allocator>
+    void devector<T, Allocator>::push_back(const T& value) {
+      if (front_ + size_ == capacity_) {
+        // value may live in this devector, so take a copy before the elements move.
+        T copy(value);
+        make_room(0, 1);
+        alloc_traits::construct(allocator(), &storage_[front_ + size_], std::move(copy));
+      } else {
+        alloc_traits::construct(allocator(), &storage_[front_ + size_], value);
+      }
+      ++size_;
+    }
+
+    template<typename T, typename Allocator>
+    void devector<T, Allocator>::push_back(T&& value) {
+      if (front_ + size_ == capacity_) {
+        T copy(std::move(value));
+        make_room(0, 1);
+        alloc_traits::construct(allocator(), &storage_[front_ + size_], std::move(copy));
+      } else {
+        alloc_traits::construct(allocator(), &storage_[front_ + size_], std::move(value));
+      }
+      ++size_;
+    }
+
+    template<typename T, typename Allocator>
+    void devector<T, Allocator>::push_front(const T& value) {
+      if (front_ == 0) {
+        T copy(value);
+        make_room(1, 0);
+        alloc_traits::construct(allocator(), &storage_[front_ - 1], std::move(copy));
+      } else {
+        alloc_traits::construct(allocator(), &storage_[front_ - 1], value);
+      }
+      --front_;
+      ++size_;
+    }
+
+    template<typename T, typename Allocator>
+    void devector<T, Allocator>::push_front(T&& value) {
+      if (front_ == 0) {
+        T copy(std::move(value));
+        make_room(1, 0);
+        alloc_traits::construct(allocator(), &storage_[front_ - 1], std::move(copy));
+      } else {
+        alloc_traits::construct(allocator(), &storage_[front_ - 1], std::move(value));
+      }
+      --front_;
+      ++size_;
+    }
+
+    template<typename T, typename Allocator>
+    void devector<T, Allocator>::pop_back() {
+      if (is_empty()) {
+        throw std::out_of_range("Devector is empty");
+      }
+      alloc_traits::destroy(allocator(), &storage_[front_ + --size_]);
+      if (size_ == 0) {
+        front_ = capacity_ / 2;
+      }
+    }
+
+    template<typename T, typename Allocator>
+    void devector<T, Allocator>::pop_front() {
+      if (is_empty()) {
+        throw std::out_of_range("Devector is empty");
+      }
+      alloc_traits::destroy(allocator(), &storage_[front_]);
+      ++front_;
+      --size_;
+      if (size_ == 0) {
+        front_ = capacity_ / 2;
+      }
+    }
+
+    template<typename T, typename Allocator>
+    void devector<T, Allocator>::clear() noexcept {
+      for (size_t i = 0; i < size_; ++i) {
+        alloc_traits::destroy(allocator(), &storage_[front_ + i]);
+      }
+      size_ = 0;
+      front_ = capacity_ / 2;
+    }
+
+    template<typename T, typename Allocator>
+    void devector<T, Allocator>::swap(devector& other) noexcept {
+      if constexpr (alloc_traits::propagate_on_container_swap::value) {
+        using std::swap;
+        swap(allocator(), other.allocator());
+      }
+      std::swap(storage_, other.storage_);
+      std::swap(capacity_, other.capacity_);
+      std::swap(front_, other.front_);
+      std::swap(size_, other.size_);
+    }
+
+    template<typename T, typename Allocator>
+    size_t devector<T, Allocator>::size() const noexcept {
+      return size_;
+    }
+
+    template<typename T, typename Allocator>
+    size_t devector<T, Allocator>::capacity() const noexcept {
+      return capacity_;
+    }
+
+    template<typename T, typename Allocator>
+    size_t devector<T, Allocator>::front_free_capacity() const noexcept {
+      return front_;
+    }
+
+    template<typename T, typename Allocator>
+    size_t devector<T, Allocator>::back_free_capacity() const noexcept {
+      return capacity_ - front_ - size_;
+    }
+
+    template<typename T, typename Allocator>
+    T& devector<T, Allocator>::at(size_t index) {
+      if (index >= size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      return storage_[front_ + index];
+    }
+
+    template<typename T, typename Allocator>
+    const T& devector<T, Allocator>::at(size_t index) const {
+      if (index >= size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      return storage_[front_ + index];
+    }
+
+    template<typename T, typename Allocator>
+    T& devector<T, Allocator>::front() {
+      if (is_empty()) {
+        throw std::out_of_range("Devector is empty");
+      }
+      return storage_[front_];
+    }
+
+    template<typename T, typename Allocator>
+    const T& devector<T, Allocator>::front() const {
+      if (is_empty()) {
+        throw std::out_of_range("Devector is empty");
+      }
+      return storage_[front_];
+    }
+
+    template<typename T, typename Allocator>
+    T& devector<T, Allocator>::back() {
+      if (is_empty()) {
+        throw std::out_of_range("Devector is empty");
+      }
+      return storage_[front_ + size_ - 1];
+    }
+
+    template<typename T, typename Allocator>
+    const T& devector<T, Allocator>::back() const {
+      if (is_empty()) {
+        throw std::out_of_range("Devector is empty");
+      }
+      return storage_[front_ + size_ - 1];
+    }
+
+    template<typename T, typename Allocator>
+    void devector<T, Allocator>::resize(size_t new_size) {
+      if (new_size > size_) {
+        make_room(0, new_size - size_);
+      }
+      for (; size_ < new_size; ++size_) {
+        alloc_traits::construct(allocator(), &storage_[front_ + size_]);
+      }
+      for (; size_ > new_size; --size_) {
+        alloc_traits::destroy(allocator(), &storage_[front_ + size_ - 1]);
+      }
+    }
+
+    template<typename T, typename Allocator>
+    void devector<T, Allocator>::resize(size_t new_size, const T& value) {
+      if (new_size > size_ && front_ + new_size > capacity_) {
+        T copy(value);
+        make_room(0, new_size - size_);
+        for (; size_ < new_size; ++size_) {
+          alloc_traits::construct(allocator(), &storage_[front_ + size_], copy);
+        }
+      }
+      for (; size_ < new_size; ++size_) {
+        alloc_traits::construct(allocator(), &storage_[front_ + size_], value);
+      }
+      for (; size_ > new_size; --size_) {
+        alloc_traits::destroy(allocator(), &storage_[front_ + size_ - 1]);
+      }
+    }
+
+    template<typename T, typename Allocator>
+    void devector<T, Allocator>::shrink_to_fit() {
+      if (size_ < capacity_) {
+        if (size_ == 0) {
+          alloc_traits::deallocate(allocator(), storage_, capacity_);
+          storage_ = nullptr;
+          capacity_ = 0;
+          front_ = 0;
+        } else {
+          reallocate(size_, 0);
+        }
+      }
+    }
+
+    template<typename T, typename Allocator>
+    void devector<T, Allocator>::trim_to_size() {
+      if (capacity_ > size_) {
+        shrink_to_fit();
+      }
+    }
+
+    template<typename T, typename Allocator>
+    void devector<T, Allocator>::ensure_capacity(size_t min_capacity) {
+      if (capacity_ < min_capacity) {
+        reallocate(min_capacity, (min_capacity - size_) / 2);
+      }
+    }
+
+    template<typename T, typename Allocator>
+    T* devector<T, Allocator>::data() noexcept {
+      return storage_ + front_;
+    }
+
+    template<typename T, typename Allocator>
+    const T* devector<T, Allocator>::data() const noexcept {
+      return storage_ + front_;
+    }
+
+    template<typename T, typename Allocator>
+    typename devector<T, Allocator>::allocator_type devector<T, Allocator>::get_allocator() const noexcept {
+      return allocator();
+    }
+
+} //namespace my_vector
@@ -0,0 +1,120 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_GROWTH_POLICY_H
+#define VECTOR_GROWTH_POLICY_H
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace my_vector {
+
+/**
+ * @brief Growth policy that doubles the capacity: 0, 1, 2, 4, 8, ...
+ *
+ * A growth policy is a class with a static next_capacity(capacity, required, element_size)
+ * that returns the capacity to grow to. The result must be at least required.
+ */
+    struct double_growth {
+        static size_t next_capacity(size_t capacity, size_t required, size_t /*element_size*/) noexcept {
+          return std::max(required, capacity == 0 ? size_t(1) : capacity * 2);
+        }
+    };
+
+/**
+ * @brief Growth policy that grows the capacity by half: 0, 1, 2, 3, 4, 6, 9, ...
+ *
+ * Wastes less memory on large vectors than doubling. The sum of all earlier blocks eventually
+ * exceeds the next request, so an allocator can reuse freed blocks for later growth.
+ */
+    struct one_and_half_growth {
+        static size_t next_capacity(size_t capacity, size_t required, size_t /*element_size*/) noexcept {
+          return std::max(required, capacity < 2 ? capacity + 1 : capacity + capacity / 2);
+        }
+    };
+
+/**
+ * @brief Growth policy that rounds large buffers up to whole pages.
+ *
+ * Below PageSize bytes it behaves like Base. From then on, the size chosen by Base is rounded
+ * up to a multiple of PageSize, and the rounded-up bytes count toward the capacity.
+ *
+ * @tparam PageSize The granularity in bytes, normally the system page size.
+ * @tparam Base The policy that decides how far to grow before rounding.
+ */
+    template<size_t PageSize = 4096, typename Base = double_growth>
+    struct page_growth {
+        static_assert((PageSize & (PageSize - 1)) == 0, "PageSize must be a power of two");
+
+        static size_t next_capacity(size_t capacity, size_t required, size_t element_size) noexcept {
+          const size_t next = Base::next_capacity(capacity, required, element_size);
+          const size_t bytes = next * element_size;
+          if (bytes < PageSize) {
+            return next;
+          }
+          return ((bytes + PageSize - 1) & ~(PageSize - 1)) / element_size;
+        }
+    };
+
+/**
+ * @brief Growth policy that counts the allocator's size-class slack toward the capacity.
+ *
+ * Grows like Base. After each allocation, the vector asks the allocator how many bytes the
+ * block can really hold and raises capacity() to match. For malloc-based allocators this
+ * is malloc_usable_size. The allocator must provide usable_size(p, n), as realloc_allocator
+ * does. With other allocators, this policy behaves exactly like Base.
+ *
+ * @tparam Base The policy that decides how far to grow.
+ */
+    template<typename Base = double_growth>
+    struct size_class_growth {
+        static constexpr bool use_usable_size = true;
+
+        static size_t next_capacity(size_t capacity, size_t required, size_t element_size) noexcept {
+          return Base::next_capacity(capacity, required, element_size);
+        }
+    };
+
+    namespace detail {
+
+    template<typename GrowthPolicy, typename = void>
+    struct uses_usable_size : std::false_type {};
+
+    template<typename GrowthPolicy>
+    struct uses_usable_size<GrowthPolicy, std::void_t<decltype(GrowthPolicy::use_usable_size)>>
+        : std::bool_constant<GrowthPolicy::use_usable_size> {};
+
+    template<typename Allocator, typename T, typename = void>
+    struct has_usable_size : std::false_type {};
+
+    template<typename Allocator, typename T>
+    struct has_usable_size<Allocator, T, std::void_t<decltype(std::declval<Allocator&>().usable_size(
+        std::declval<T*>(), std::declval<size_t>()))>> : std::true_type {};
+
+    /**
+     * @brief Returns the number of elements a freshly allocated block can really hold.
+     *
+     * @param alloc The allocator the block came from.
+     * @param p The block.
+     * @param n The number of elements the block was requested for.
+     * @return n, or more if the policy uses size classes and the allocator reports slack.
+     */
+    template<typename GrowthPolicy, typename Allocator, typename T>
+    size_t usable_capacity(Allocator& alloc, T* p, size_t n) noexcept {
+      if constexpr (uses_usable_size<GrowthPolicy>::value && has_usable_size<Allocator, T>::value) {
+        return std::max(n, static_cast<size_t>(alloc.usable_size(p, n)));
+      } else {
+        (void) alloc;
+        (void) p;
+        return n;
+      }
+    }
+
+    } // namespace detail
+
+} // namespace my_vector
+
+#endif //VECTOR_GROWTH_POLICY_H
@@ -0,0 +1,261 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_HUGE_PAGE_ALLOCATOR_H
+#define VECTOR_HUGE_PAGE_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace my_vector {
+
+    /**
+     * @brief How the storage of a block is backed.
+     */
+    enum class page_backing {
+        regular, /// Ordinary pages, either below the threshold or because no huge pages were granted
+        transparent, /// At least part of the block sits on transparent huge pages
+        explicit_huge /// The block was mapped from the hugetlbfs pool
+    };
+
+/**
+ * @brief Allocator that places large blocks on 2 MiB huge pages.
+ *
+ * Blocks of at least Threshold bytes are mapped with mmap. The allocator first asks for
+ * explicit huge pages with MAP_HUGETLB, which only works when the administrator has reserved
+ * a hugetlbfs pool. Otherwise it maps a 2 MiB-aligned region and marks it with
+ * madvise(MADV_HUGEPAGE), so transparent huge pages back it when the kernel allows. If the
+ * kernel grants neither, the block simply stays on regular pages. Smaller blocks, and all
+ * blocks on other systems, come from operator new aligned to a cache line, or to 2 MiB
+ * above the threshold.
+ *
+ * Whether a block really got huge pages is only known after it has been touched; ask
+ * backing() or huge_page_bytes() once the data is written.
+ *
+ * @tparam T The type of elements to allocate.
+ * @tparam Threshold Block size in bytes from which huge pages are requested.
+ */
+    template<typename T, size_t Threshold = size_t(32) << 20>
+    class huge_page_allocator {
+    public:
+        using value_type = T;
+        using is_always_equal = std::true_type;
+
+        /**
+         * @brief Size and alignment of the huge pages requested.
+         */
+        static constexpr size_t huge_page_size = size_t(2) << 20;
+
+        template<typename U>
+        struct rebind {
+            using other = huge_page_allocator<U, Threshold>;
+        };
+
+        huge_page_allocator() noexcept = default;
+
+        template<typename U>
+        huge_page_allocator(const huge_page_allocator<U, Threshold>&) noexcept {}
+
+        /**
+         * @brief Allocates uninitialized storage for n elements.
+         *
+         * @param n The number of elements.
+         * @return A pointer to the storage.
+         * @throws std::bad_alloc if the storage cannot be obtained.
+         */
+        T* allocate(size_t n) {
+          if (n > std::numeric_limits<size_t>::max() / sizeof(T) - huge_page_size) {
+            throw std::bad_alloc();
+          }
+          const size_t bytes = n * sizeof(T);
+#if defined(__linux__)
+          if (is_huge(bytes)) {
+            const size_t length = huge_round(bytes);
+            void* p = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (p != MAP_FAILED) {
+              return static_cast<T*>(p);
+            }
+            // No hugetlbfs pool: over-map by one huge page and trim to a 2 MiB boundary, so
+            // every huge page in the block can be backed by a single TLB entry.
+            p = ::mmap(nullptr, length + huge_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p == MAP_FAILED) {
+              throw std::bad_alloc();
+            }
+            const uintptr_t start = reinterpret_cast<uintptr_t>(p);
+            const uintptr_t aligned = (start + huge_page_size - 1) & ~uintptr_t(huge_page_size - 1);
+            if (aligned != start) {
+              ::munmap(p, aligned - start);
+            }
+            if (const size_t tail = start + length + huge_page_size - (aligned + length)) {
+              ::munmap(reinterpret_cast<void*>(aligned + length), tail);
+            }
+#if defined(MADV_HUGEPAGE)
+            ::madvise(reinterpret_cast<void*>(aligned), length, MADV_HUGEPAGE);
+#endif
+            return reinterpret_cast<T*>(aligned);
+          }
+#endif
+          return static_cast<T*>(::operator new(bytes ? bytes : 1, std::align_val_t(alignment(bytes))));
+        }
+
+        /**
+         * @brief Releases storage obtained from allocate().
+         *
+         * @param p The storage to release.
+         * @param n The number of elements it was allocated for.
+         */
+        void deallocate(T* p, size_t n) noexcept {
+          const size_t bytes = n * sizeof(T);
+#if defined(__linux__)
+          if (is_huge(bytes)) {
+            ::munmap(p, huge_round(bytes));
+            return;
+          }
+#endif
+          ::operator delete(p, std::align_val_t(alignment(bytes)));
+        }
+
+        /**
+         * @brief Returns how many elements a block can really hold.
+         *
+         * Mapped blocks are rounded up to whole huge pages, and size_class_growth counts
+         * that slack toward the capacity.
+         *
+         * @param p A block obtained from this allocator.
+         * @param n The number of elements the block was requested for.
+         * @return The number of elements that fit in the block, at least n.
+         */
+        size_t usable_size(T* /*p*/, size_t n) const noexcept {
+#if defined(__linux__)
+          if (is_huge(n * sizeof(T))) {
+            return huge_round(n * sizeof(T)) / sizeof(T);
+          }
+#endif
+          return n;
+        }
+
+        /**
+         * @brief Returns how many bytes of a block are currently backed by huge pages.
+         *
+         * Reads the block's entry in /proc/self/smaps. Transparent huge pages are assigned
+         * when memory is first touched, so the count grows as the block is written, and the
+         * kernel may split them again later.
+         *
+         * @param p A block obtained from this allocator.
+         * @param n The number of elements the block was allocated for.
+         * @return The number of bytes on huge pages, or 0 if unknown or not on Linux.
+         */
+        static size_t huge_page_bytes(const T* p, size_t n) noexcept {
+          return smaps_entry(p, n).huge_bytes;
+        }
+
+        /**
+         * @brief Reports how a block is backed.
+         *
+         * @param p A block obtained from this allocator.
+         * @param n The number of elements the block was allocated for.
+         * @return explicit_huge for hugetlbfs blocks, transparent if any part of the block is
+         *         on transparent huge pages, regular otherwise.
+         */
+        static page_backing backing(const T* p, size_t n) noexcept {
+          const smaps_info info = smaps_entry(p, n);
+          if (info.hugetlb) {
+            return page_backing::explicit_huge;
+          }
+          return info.huge_bytes ? page_backing::transparent : page_backing::regular;
+        }
+
+        template<typename U>
+        bool operator==(const huge_page_allocator<U, Threshold>&) const noexcept { return true; }
+
+        template<typename U>
+        bool operator!=(const huge_page_allocator<U, Threshold>&) const noexcept { return false; }
+
+    private:
+        struct smaps_info {
+            size_t huge_bytes = 0; /// Bytes on huge pages of either kind
+            bool hugetlb = false; /// Whether the mapping comes from hugetlbfs
+        };
+
+        static bool is_huge(size_t bytes) noexcept {
+          return bytes >= Threshold;
+        }
+
+        static size_t huge_round(size_t bytes) noexcept {
+          return (bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+        }
+
+        static size_t alignment(size_t bytes) noexcept {
+          const size_t line = alignof(T) > 64 ? alignof(T) : 64;
+          return bytes >= Threshold ? huge_page_size : line;
+        }
+
+      /**
+       * @brief Finds the mapping that holds p in /proc/self/smaps and reads its page sizes.
+       */
+        static smaps_info smaps_entry(const T* p, size_t n) noexcept {
+          smaps_info info;
+#if defined(__linux__)
+          if (!p || !is_huge(n * sizeof(T))) {
+            return info;
+          }
+          std::FILE* smaps = std::fopen("/proc/self/smaps", "r");
+          if (!smaps) {
+            return info;
+          }
+          const uintptr_t address = reinterpret_cast<uintptr_t>(p);
+          bool inside = false;
+          char line[256];
+          while (std::fgets(line, sizeof(line), smaps)) {
+            unsigned long long start = 0;
+            unsigned long long end = 0;
+            size_t kilobytes = 0;
+            if (std::sscanf(line, "%llx-%llx ", &start, &end) == 2 && std::strchr(line, ':') > std::strchr(line, ' ')) {
+              if (inside) {
+                break;
+              }
+              inside = address >= start && address < end;
+            } else if (!inside) {
+              continue;
+            } else if (std::sscanf(line, "AnonHugePages: %zu kB", &kilobytes) == 1) {
+              info.huge_bytes += kilobytes << 10;
+            } else if (std::sscanf(line, "KernelPageSize: %zu kB", &kilobytes) == 1) {
+              info.hugetlb = kilobytes << 10 >= huge_page_size;
+            } else if (info.hugetlb && (std::sscanf(line, "Private_Hugetlb: %zu kB", &kilobytes) == 1
+                                        || std::sscanf(line, "Shared_Hugetlb: %zu kB", &kilobytes) == 1)) {
+              info.huge_bytes += kilobytes << 10;
+            }
+          }
+          std::fclose(smaps);
+#else
+          (void) p;
+          (void) n;
+#endif
+          return info;
+        }
+    };
+
+    /**
+     * @brief Returns how many bytes of a container's storage sit on huge pages.
+     *
+     * @param c A container whose allocator is a huge_page_allocator.
+     * @return The number of bytes on huge pages, see huge_page_allocator::huge_page_bytes.
+     */
+    template<typename Container>
+    size_t huge_page_bytes(const Container& c) noexcept {
+      return Container::allocator_type::huge_page_bytes(c.data(), c.capacity());
+    }
+
+} // namespace my_vector
+
+#endif //VECTOR_HUGE_PAGE_ALLOCATOR_H
@@ -0,0 +1,207 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_ITERATOR_H
+#define VECTOR_ITERATOR_H
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#if __has_include(<version>)
+#include <version>
+#endif
+
+namespace my_vector {
+
+    namespace detail {
+
+/**
+ * @brief Random-access iterator over contiguous storage.
+ *
+ * A thin wrapper around T*, so algorithms compile down to pointer arithmetic. With C++20 it
+ * also advertises std::contiguous_iterator_tag, which lets ranges algorithms and
+ * std::to_address work on raw pointers. The Container parameter only keeps iterators of
+ * different containers from mixing.
+ *
+ * @tparam T The element type, const-qualified for const iterators.
+ * @tparam Container The container the iterator belongs to.
+ */
+    template<typename T, typename Container>
+    class contiguous_iterator {
+        T* ptr;
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+#if defined(__cpp_lib_concepts)
+        using iterator_concept = std::contiguous_iterator_tag;
+#endif
+        using value_type = std::remove_cv_t<T>;
+        using element_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        contiguous_iterator() noexcept : ptr(nullptr) {}
+        explicit contiguous_iterator(T* ptr) noexcept : ptr(ptr) {}
+
+        /**
+         * @brief Converts an iterator into a const_iterator.
+         */
+        template<typename U, typename = std::enable_if_t<std::is_convertible<U*, T*>::value>>
+        contiguous_iterator(const contiguous_iterator<U, Container>& other) noexcept : ptr(other.base()) {}
+
+        /**
+         * @brief Returns the underlying pointer.
+         */
+        T* base() const noexcept { return ptr; }
+
+        reference operator*() const noexcept { return *ptr; }
+        pointer operator->() const noexcept { return ptr; }
+        reference operator[](difference_type n) const noexcept { return ptr[n]; }
+
+        contiguous_iterator& operator++() noexcept { ++ptr; return *this; }
+        contiguous_iterator operator++(int) noexcept { contiguous_iterator tmp = *this; ++ptr; return tmp; }
+        contiguous_iterator& operator--() noexcept { --ptr; return *this; }
+        contiguous_iterator operator--(int) noexcept { contiguous_iterator tmp = *this; --ptr; return tmp; }
+        contiguous_iterator& operator+=(difference_type n) noexcept { ptr += n; return *this; }
+        contiguous_iterator& operator-=(difference_type n) noexcept { ptr -= n; return *this; }
+
+        friend contiguous_iterator operator+(contiguous_iterator it, difference_type n) noexcept { return it += n; }
+        friend contiguous_iterator operator+(difference_type n, contiguous_iterator it) noexcept { return it += n; }
+        friend contiguous_iterator operator-(contiguous_iterator it, difference_type n) noexcept { return it -= n; }
+
+        template<typename U>
+        difference_type operator-(const contiguous_iterator<U, Container>& other) const noexcept { return ptr - other.base(); }
+
+        template<typename U>
+        bool operator==(const contiguous_iterator<U, Container>& other) const noexcept { return ptr == other.base(); }
+        template<typename U>
+        bool operator!=(const contiguous_iterator<U, Container>& other) const noexcept { return ptr != other.base(); }
+        template<typename U>
+        bool operator<(const contiguous_iterator<U, Container>& other) const noexcept { return ptr < other.base(); }
+        template<typename U>
+        bool operator>(const contiguous_iterator<U, Container>& other) const noexcept { return ptr > other.base(); }
+        template<typename U>
+        bool operator<=(const contiguous_iterator<U, Container>& other) const noexcept { return ptr <= other.base(); }
+        template<typename U>
+        bool operator>=(const contiguous_iterator<U, Container>& other) const noexcept { return ptr >= other.base(); }
+    };
+
+/**
+ * @brief Random-access iterator over a container whose elements are not contiguous.
+ *
+ * Holds the container and a position and dereferences through the container's operator[],
+ * so it stays valid as long as the element it refers to does.
+ *
+ * @tparam T The element type, const-qualified for const iterators.
+ * @tparam Container The container, const-qualified for const iterators.
+ */
+    template<typename T, typename Container>
+    class index_iterator {
+        Container* container;
+        size_t index;
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::remove_cv_t<T>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        index_iterator() noexcept : container(nullptr), index(0) {}
+        index_iterator(Container* container, size_t index) noexcept : container(container), index(index) {}
+
+        /**
+         * @brief Converts an iterator into a const_iterator.
+         */
+        template<typename U, typename C, typename = std::enable_if_t<std::is_convertible<U*, T*>::value
+                                                                     && std::is_convertible<C*, Container*>::value>>
+        index_iterator(const index_iterator<U, C>& other) noexcept : container(other.owner()), index(other.position()) {}
+
+        /**
+         * @brief Returns the container the iterator refers into.
+         */
+        Container* owner() const noexcept { return container; }
+
+        /**
+         * @brief Returns the index of the element the iterator refers to.
+         */
+        size_t position() const noexcept { return index; }
+
+        reference operator*() const { return (*container)[index]; }
+        pointer operator->() const { return &(*container)[index]; }
+        reference operator[](difference_type n) const { return (*container)[index + n]; }
+
+        index_iterator& operator++() noexcept { ++index; return *this; }
+        index_iterator operator++(int) noexcept { index_iterator tmp = *this; ++index; return tmp; }
+        index_iterator& operator--() noexcept { --index; return *this; }
+        index_iterator operator--(int) noexcept { index_iterator tmp = *this; --index; return tmp; }
+        index_iterator& operator+=(difference_type n) noexcept { index += n; return *this; }
+        index_iterator& operator-=(difference_type n) noexcept { index -= n; return *this; }
+
+        friend index_iterator operator+(index_iterator it, difference_type n) noexcept { return it += n; }
+        friend index_iterator operator+(difference_type n, index_iterator it) noexcept { return it += n; }
+        friend index_iterator operator-(index_iterator it, difference_type n) noexcept { return it -= n; }
+
+        template<typename U, typename C>
+        difference_type operator-(const index_iterator<U, C>& other) const noexcept {
+          return static_cast<difference_type>(index) - static_cast<difference_type>(other.position());
+        }
+
+        template<typename U, typename C>
+        bool operator==(const index_iterator<U, C>& other) const noexcept { return index == other.position(); }
+        template<typename U, typename C>
+        bool operator!=(const index_iterator<U, C>& other) const noexcept { return index != other.position(); }
+        template<typename U, typename C>
+        bool operator<(const index_iterator<U, C>& other) const noexcept { return index < other.position(); }
+        template<typename U, typename C>
+        bool operator>(const index_iterator<U, C>& other) const noexcept { return index > other.position(); }
+        template<typename U, typename C>
+        bool operator<=(const index_iterator<U, C>& other) const noexcept { return index <= other.position(); }
+        template<typename U, typename C>
+        bool operator>=(const index_iterator<U, C>& other) const noexcept { return index >= other.position(); }
+    };
+
+    /**
+     * @brief True for iterators over contiguous storage, whose ranges can be copied with memcpy.
+     *
+     * With C++20 this is any std::contiguous_iterator, such as those of std::vector, std::array
+     * and std::string. Before that only pointers and contiguous_iterator are recognised.
+     */
+#if defined(__cpp_lib_concepts)
+    template<typename It>
+    struct is_contiguous_iterator : std::bool_constant<std::contiguous_iterator<It>> {};
+#else
+    template<typename It>
+    struct is_contiguous_iterator : std::is_pointer<It> {};
+#endif
+
+    template<typename T, typename Container>
+    struct is_contiguous_iterator<contiguous_iterator<T, Container>> : std::true_type {};
+
+    /**
+     * @brief Returns the address an iterator refers to, for every iterator is_contiguous_iterator accepts.
+     */
+    template<typename T>
+    T* to_address(T* ptr) noexcept {
+      return ptr;
+    }
+
+    template<typename T, typename Container>
+    T* to_address(const contiguous_iterator<T, Container>& it) noexcept {
+      return it.base();
+    }
+
+#if defined(__cpp_lib_concepts)
+    template<typename It, typename = std::enable_if_t<std::contiguous_iterator<It>>>
+    auto to_address(const It& it) noexcept {
+      return std::to_address(it);
+    }
+#endif
+
+    } // namespace detail
+
+} // namespace my_vector
+
+#endif //VECTOR_ITERATOR_H
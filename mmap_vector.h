@@ -0,0 +1,503 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_MMAP_VECTOR_H
+#define VECTOR_MMAP_VECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <string>
+#include <type_traits>
+
+#include "growth_policy.h"
+#include "iterator.h"
+#include "vector.h"
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#error "mmap_vector needs a POSIX system"
+#endif
+
+namespace my_vector {
+
+    /**
+     * @brief How mmap_vector treats the file it is given.
+     */
+    enum class open_mode {
+        open_or_create, /// Reopen the file if it exists, create an empty one otherwise
+        open_existing, /// Reopen the file, failing if it does not exist
+        create /// Start empty, discarding any existing contents
+    };
+
+    /**
+     * @brief Expected access pattern, forwarded to the kernel with madvise.
+     */
+    enum class access_hint {
+        normal, /// No particular pattern
+        sequential, /// Mostly front-to-back scans, read ahead aggressively
+        random, /// Scattered lookups, do not read ahead
+        populate /// Fault the whole file in up front with MAP_POPULATE and MADV_WILLNEED
+    };
+
+    namespace detail {
+
+    /**
+     * @brief The first 64 bytes of an mmap_vector file. The elements follow it.
+     */
+    struct mmap_header {
+        char magic[8]; /// "MYVECMAP"
+        uint32_t version; /// Layout version, currently 1
+        uint32_t element_size; /// sizeof(T) of the writer
+        uint32_t element_align; /// alignof(T) of the writer
+        uint32_t reserved; /// Zero
+        uint64_t size; /// Number of elements in use
+        unsigned char padding[32]; /// Zero, keeps the elements 64-byte aligned
+    };
+
+    static_assert(sizeof(mmap_header) == 64, "mmap_header must stay 64 bytes");
+
+    } // namespace detail
+
+/**
+ * @brief A vector whose elements live in a memory-mapped file.
+ *
+ * The file holds a 64-byte header followed by the elements, so reopening it maps the data
+ * back in without parsing anything; pages are read on first access. The file is mapped
+ * shared and grows with ftruncate plus mremap, so writes reach the page cache directly and
+ * the file may be larger than RAM. Nothing is forced to disk until sync() is called or the
+ * kernel writes back on its own.
+ *
+ * Only trivially copyable types with an alignment of at most 64 bytes can be stored, since
+ * the bytes in the file are the objects.
+ *
+ * @tparam T The type of elements stored in the file.
+ * @tparam GrowthPolicy Decides how far the file grows when it runs out of room.
+ */
+    template<typename T, typename GrowthPolicy = page_growth<>>
+    class mmap_vector {
+        static_assert(std::is_trivially_copyable<T>::value, "mmap_vector stores objects as raw bytes");
+        static_assert(alignof(T) <= sizeof(detail::mmap_header), "mmap_vector aligns elements to at most 64 bytes");
+
+        int fd_; /// The open file, or -1 after being moved from
+        unsigned char* map_; /// Start of the mapping, which begins with the header
+        size_t capacity_; /// Number of elements the file has room for
+        access_hint hint_; /// The access pattern passed to madvise after each remap
+
+      /**
+       * @brief Returns the header at the start of the mapping.
+       */
+        detail::mmap_header& header() const noexcept;
+
+      /**
+       * @brief Returns the number of bytes mapped for the given capacity.
+       */
+        static size_t mapped_bytes(size_t capacity) noexcept;
+
+      /**
+       * @brief Extends or truncates the file to the given capacity and remaps it.
+       *
+       * @param new_capacity The new capacity, at least size().
+       * @throws std::system_error if the file cannot be resized or remapped.
+       */
+        void remap(size_t new_capacity);
+
+      /**
+       * @brief Grows the file according to GrowthPolicy so that it holds at least min_capacity elements.
+       *
+       * @param min_capacity The number of elements the file must hold.
+       */
+        void grow(size_t min_capacity);
+
+      /**
+       * @brief Unmaps and closes the file.
+       */
+        void close() noexcept;
+
+      /**
+       * @brief Throws if the vector was moved from and so has no file to modify.
+       *
+       * @throws std::logic_error if the vector no longer refers to a file.
+       */
+        void check_open() const;
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using iterator = detail::contiguous_iterator<T, mmap_vector>;
+        using const_iterator = detail::contiguous_iterator<const T, mmap_vector>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        /**
+         * @brief Opens or creates the file at path and maps it.
+         *
+         * An existing file is checked against the header: magic, version, sizeof(T) and
+         * alignof(T) must match.
+         *
+         * @param path The file backing the vector.
+         * @param mode Whether to reopen, create or truncate the file.
+         * @param hint The expected access pattern.
+         * @throws std::system_error if the file cannot be opened or mapped.
+         * @throws std::runtime_error if an existing file was not written by an mmap_vector<T>.
+         */
+        explicit mmap_vector(const std::string& path, open_mode mode = open_mode::open_or_create,
+                             access_hint hint = access_hint::normal);
+
+        mmap_vector(const mmap_vector&) = delete;
+        mmap_vector& operator=(const mmap_vector&) = delete;
+
+        /**
+         * @brief Move constructor. The moved-from vector no longer refers to a file.
+         *
+         * A moved-from vector is empty. Functions that would add elements or touch the file
+         * throw std::logic_error until a vector is move-assigned to it.
+         *
+         * @param other The vector to move from.
+         */
+        mmap_vector(mmap_vector&& other) noexcept;
+
+        /**
+         * @brief Move assignment operator. Closes the current file first.
+         *
+         * @param other The vector to move from.
+         * @return A reference to the assigned vector.
+         */
+        mmap_vector& operator=(mmap_vector&& other) noexcept;
+
+        /**
+         * @brief Destructor.
+         *
+         * Unmaps and closes the file. The data stays in the page cache and reaches the disk
+         * eventually; call sync() first if it must be durable now.
+         */
+        ~mmap_vector();
+
+        /**
+         * @brief Accesses the element at the specified position.
+         *
+         * @param index The position of the element to access.
+         * @return A reference to the element at the specified position.
+         */
+        T& operator[] (size_t index);
+
+        /**
+         * @brief Accesses the element at the specified position (const version).
+         *
+         * @param index The position of the element to access.
+         * @return A const reference to the element at the specified position.
+         */
+        const T& operator[] (size_t index) const;
+
+        /**
+         * @brief Accesses the element at the specified position.
+         *
+         * @param index The position of the element to access.
+         * @return A reference to the element at the specified position.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        T& at(size_t index);
+
+        /**
+         * @brief Accesses the element at the specified position (const version).
+         *
+         * @param index The position of the element to access.
+         * @return A const reference to the element at the specified position.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        const T& at(size_t index) const;
+
+        /**
+         * @brief Accesses the first element.
+         *
+         * @return A reference to the first element.
+         * @throws std::out_of_range if the vector is empty.
+         */
+        T& front();
+
+        /**
+         * @brief Accesses the first element (const version).
+         *
+         * @return A const reference to the first element.
+         * @throws std::out_of_range if the vector is empty.
+         */
+        const T& front() const;
+
+        /**
+         * @brief Accesses the last element.
+         *
+         * @return A reference to the last element.
+         * @throws std::out_of_range if the vector is empty.
+         */
+        T& back();
+
+        /**
+         * @brief Accesses the last element (const version).
+         *
+         * @return A const reference to the last element.
+         * @throws std::out_of_range if the vector is empty.
+         */
+        const T& back() const;
+
+        /**
+         * @brief Returns an iterator to the first element.
+         *
+         * Growing the file may move the mapping, which invalidates iterators, pointers and references.
+         *
+         * @return An iterator to the first element.
+         */
+        iterator begin() noexcept;
+
+        /**
+         * @brief Returns a const iterator to the first element.
+         *
+         * @return A const iterator to the first element.
+         */
+        const_iterator begin() const noexcept;
+
+        /**
+         * @brief Returns an iterator past the last element.
+         *
+         * @return An iterator past the last element.
+         */
+        iterator end() noexcept;
+
+        /**
+         * @brief Returns a const iterator past the last element.
+         *
+         * @return A const iterator past the last element.
+         */
+        const_iterator end() const noexcept;
+
+        /**
+         * @brief Returns a const iterator to the first element.
+         *
+         * @return A const iterator to the first element.
+         */
+        const_iterator cbegin() const noexcept;
+
+        /**
+         * @brief Returns a const iterator past the last element.
+         *
+         * @return A const iterator past the last element.
+         */
+        const_iterator cend() const noexcept;
+
+        /**
+         * @brief Returns a reverse iterator to the last element.
+         *
+         * @return A reverse iterator to the last element.
+         */
+        reverse_iterator rbegin() noexcept;
+
+        /**
+         * @brief Returns a const reverse iterator to the last element.
+         *
+         * @return A const reverse iterator to the last element.
+         */
+        const_reverse_iterator rbegin() const noexcept;
+
+        /**
+         * @brief Returns a reverse iterator before the first element.
+         *
+         * @return A reverse iterator before the first element.
+         */
+        reverse_iterator rend() noexcept;
+
+        /**
+         * @brief Returns a const reverse iterator before the first element.
+         *
+         * @return A const reverse iterator before the first element.
+         */
+        const_reverse_iterator rend() const noexcept;
+
+        /**
+         * @brief Adds an element to the end of the vector.
+         *
+         * @param value The value to add.
+         */
+        void push_back(const T& value);
+
+        /**
+         * @brief Constructs an element in place at the end of the vector.
+         *
+         * @param args The arguments to construct the element from.
+         * @return A reference to the new element.
+         */
+        template<typename... Args>
+        T& emplace_back(Args&&... args);
+
+        /**
+         * @brief Appends the elements of [first, last) to the end of the vector.
+         *
+         * @param first The beginning of the range.
+         * @param last The end of the range.
+         */
+        template<typename InputIt, typename = detail::require_input_iterator<InputIt>>
+        void append(InputIt first, InputIt last);
+
+        /**
+         * @brief Appends the elements of an initializer list to the end of the vector.
+         *
+         * @param init The elements to append.
+         */
+        void append(std::initializer_list<T> init);
+
+        /**
+         * @brief Inserts an element before the specified position, shifting the rest back.
+         *
+         * @param index The position to insert at, at most size().
+         * @param value The value to insert.
+         * @throws std::out_of_range if the index is greater than size().
+         */
+        void insert(size_t index, const T& value);
+
+        /**
+         * @brief Removes the last element of the vector.
+         *
+         * @throws std::out_of_range if the vector is empty.
+         */
+        void pop_back();
+
+        /**
+         * @brief Removes the element at the specified position, shifting the rest forward.
+         *
+         * @param index The position of the element to remove.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        void erase(size_t index);
+
+        /**
+         * @brief Removes the elements in [first, last), shifting the rest forward.
+         *
+         * @param first The position of the first element to remove.
+         * @param last The position past the last element to remove.
+         * @throws std::out_of_range if the range is invalid.
+         */
+        void erase(size_t first, size_t last);
+
+        /**
+         * @brief Removes all elements, keeping the file at its current length.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Resizes the vector, value-initializing new elements.
+         *
+         * @param new_size The new size of the vector.
+         */
+        void resize(size_t new_size);
+
+        /**
+         * @brief Resizes the vector, initializing new elements with the specified value.
+         *
+         * @param new_size The new size of the vector.
+         * @param value The value to initialize new elements with.
+         */
+        void resize(size_t new_size, const T& value);
+
+        /**
+         * @brief Resizes the vector without writing the new elements.
+         *
+         * Space that ftruncate added to the file reads as zero bytes until written.
+         *
+         * @param new_size The new size of the vector.
+         */
+        void resize_for_overwrite(size_t new_size);
+
+        /**
+         * @brief Ensures the file has room for at least the specified number of elements.
+         *
+         * Extends the file with ftruncate and grows the mapping with mremap, which may move
+         * it. The new capacity is chosen by GrowthPolicy, so it may exceed min_capacity. The
+         * new space is sparse until written.
+         *
+         * @param min_capacity The minimum capacity to ensure.
+         * @throws std::system_error if the file cannot be extended or remapped.
+         */
+        void ensure_capacity(size_t min_capacity);
+
+        /**
+         * @brief Truncates the file so that it holds exactly size() elements.
+         */
+        void shrink_to_fit();
+
+        /**
+         * @brief Trims the capacity of the vector to match its size.
+         */
+        void trim_to_size();
+
+        /**
+         * @brief Swaps the files of two vectors.
+         *
+         * @param other The vector to swap with.
+         */
+        void swap(mmap_vector& other) noexcept;
+
+        /**
+         * @brief Writes all modified pages and the header to disk and waits for completion.
+         *
+         * @throws std::system_error if msync fails.
+         */
+        void sync();
+
+        /**
+         * @brief Writes the pages holding [first, first + count) and the header to disk.
+         *
+         * Cheaper than sync() when only a few elements changed.
+         *
+         * @param first The position of the first element to write back.
+         * @param count The number of elements to write back.
+         * @throws std::out_of_range if the range is invalid.
+         * @throws std::system_error if msync fails.
+         */
+        void sync(size_t first, size_t count);
+
+        /**
+         * @brief Changes the expected access pattern of the mapping.
+         *
+         * access_hint::populate reads the whole file in right away.
+         *
+         * @param hint The new access pattern.
+         */
+        void advise(access_hint hint) noexcept;
+
+        /**
+         * @brief Returns the number of elements in the vector.
+         *
+         * @return The number of elements in the vector.
+         */
+        [[nodiscard]] size_t size() const noexcept;
+
+        /**
+         * @brief Returns the number of elements the file has room for.
+         *
+         * @return The capacity of the vector.
+         */
+        [[nodiscard]] size_t capacity() const noexcept;
+
+        /**
+         * @brief Returns a pointer to the first element inside the mapping.
+         *
+         * @return A pointer to the contiguous elements, or nullptr for a moved-from vector.
+         */
+        T* data() noexcept;
+
+        /**
+         * @brief Returns a const pointer to the first element inside the mapping.
+         *
+         * @return A const pointer to the contiguous elements, or nullptr for a moved-from vector.
+         */
+        const T* data() const noexcept;
+    };
+
+} // namespace my_vector
+
+#include "mmap_vector_impl.h"
+
+#endif //VECTOR_MMAP_VECTOR_H
@@ -0,0 +1,505 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "posix_io.h"
+
+namespace my_vector {
+
+    namespace detail {
+
+    inline constexpr char mmap_magic[8] = {'M', 'Y', 'V', 'E', 'C', 'M', 'A', 'P'};
+
+    inline void apply_hint(void* p, size_t bytes, access_hint hint) noexcept {
+      int advice = MADV_NORMAL;
+      switch (hint) {
+        case access_hint::normal: advice = MADV_NORMAL; break;
+        case access_hint::sequential: advice = MADV_SEQUENTIAL; break;
+        case access_hint::random: advice = MADV_RANDOM; break;
+        case access_hint::populate: advice = MADV_WILLNEED; break;
+      }
+      ::madvise(p, bytes, advice);
+    }
+
+    } // namespace detail
+
+    template<typename T, typename GrowthPolicy>
+    mmap_vector<T, GrowthPolicy>::mmap_vector(const std::string& path, open_mode mode, access_hint hint)
+        : fd_(-1), map_(nullptr), capacity_(0), hint_(hint) {
+      int flags = O_RDWR | O_CLOEXEC;
+      if (mode == open_mode::open_or_create) {
+        flags |= O_CREAT;
+      } else if (mode == open_mode::create) {
+        flags |= O_CREAT | O_TRUNC;
+      }
+      fd_ = ::open(path.c_str(), flags, 0644);
+      if (fd_ < 0) {
+        detail::throw_errno("mmap_vector: open");
+      }
+      try {
+        struct stat st {};
+        if (::fstat(fd_, &st) != 0) {
+          detail::throw_errno("mmap_vector: fstat");
+        }
+        const size_t file_bytes = static_cast<size_t>(st.st_size);
+        const bool fresh = file_bytes == 0;
+        if (fresh) {
+          if (::ftruncate(fd_, sizeof(detail::mmap_header)) != 0) {
+            detail::throw_errno("mmap_vector: ftruncate");
+          }
+        } else if (file_bytes < sizeof(detail::mmap_header)) {
+          throw std::runtime_error("mmap_vector: file is too short to hold a header");
+        } else {
+          capacity_ = (file_bytes - sizeof(detail::mmap_header)) / sizeof(T);
+        }
+
+        int map_flags = MAP_SHARED;
+#if defined(MAP_POPULATE)
+        if (hint == access_hint::populate) {
+          map_flags |= MAP_POPULATE;
+        }
+#endif
+        void* p = ::mmap(nullptr, mapped_bytes(capacity_), PROT_READ | PROT_WRITE, map_flags, fd_, 0);
+        if (p == MAP_FAILED) {
+          detail::throw_errno("mmap_vector: mmap");
+        }
+        map_ = static_cast<unsigned char*>(p);
+
+        detail::mmap_header& h = header();
+        if (fresh) {
+          std::memcpy(h.magic, detail::mmap_magic, sizeof(h.magic));
+          h.version = 1;
+          h.element_size = sizeof(T);
+          h.element_align = alignof(T);
+          h.size = 0;
+        } else if (std::memcmp(h.magic, detail::mmap_magic, sizeof(h.magic)) != 0 || h.version != 1) {
+          throw std::runtime_error("mmap_vector: not an mmap_vector file");
+        } else if (h.element_size != sizeof(T) || h.element_align != alignof(T)) {
+          throw std::runtime_error("mmap_vector: file was written for a different element type");
+        } else if (h.size > capacity_) {
+          throw std::runtime_error("mmap_vector: file is shorter than its recorded size");
+        }
+        detail::apply_hint(map_, mapped_bytes(capacity_), hint_);
+      } catch (...) {
+        close();
+        throw;
+      }
+    }
+
+    template<typename T, typename GrowthPolicy>
+    mmap_vector<T, GrowthPolicy>::mmap_vector(mmap_vector&& other) noexcept
+        : fd_(other.fd_), map_(other.map_), capacity_(other.capacity_), hint_(other.hint_) {
+      other.fd_ = -1;
+      other.map_ = nullptr;
+      other.capacity_ = 0;
+    }
+
+    template<typename T, typename GrowthPolicy>
+    mmap_vector<T, GrowthPolicy>& mmap_vector<T, GrowthPolicy>::operator=(mmap_vector&& other) noexcept {
+      if (this != &other) {
+        close();
+        fd_ = other.fd_;
+        map_ = other.map_;
+        capacity_ = other.capacity_;
+        hint_ = other.hint_;
+        other.fd_ = -1;
+        other.map_ = nullptr;
+        other.capacity_ = 0;
+      }
+      return *this;
+    }
+
+    template<typename T, typename GrowthPolicy>
+    mmap_vector<T, GrowthPolicy>::~mmap_vector() {
+      close();
+    }
+
+    template<typename T, typename GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::close() noexcept {
+      if (map_) {
+        ::munmap(map_, mapped_bytes(capacity_));
+        map_ = nullptr;
+      }
+      if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+      }
+      capacity_ = 0;
+    }
+
+    template<typename T, typename GrowthPolicy>
+    detail::mmap_header& mmap_vector<T, GrowthPolicy>::header() const noexcept {
+      return *reinterpret_cast<detail::mmap_header*>(map_);
+    }
+
+    template<typename T, typename GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::check_open() const {
+      if (!map_) {
+        throw std::logic_error("mmap_vector: used after being moved from");
+      }
+    }
+
+    template<typename T, typename GrowthPolicy>
+    size_t mmap_vector<T, GrowthPolicy>::mapped_bytes(size_t capacity) noexcept {
+      return sizeof(detail::mmap_header) + capacity * sizeof(T);
+    }
+
+    template<typename T, typename GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::remap(size_t new_capacity) {
+      const size_t old_bytes = mapped_bytes(capacity_);
+      const size_t new_bytes = mapped_bytes(new_capacity);
+      if (new_capacity > capacity_ && ::ftruncate(fd_, static_cast<off_t>(new_bytes)) != 0) {
+        detail::throw_errno("mmap_vector: ftruncate");
+      }
+#if defined(__linux__)
+      void* p = ::mremap(map_, old_bytes, new_bytes, MREMAP_MAYMOVE);
+      if (p == MAP_FAILED) {
+        detail::throw_errno("mmap_vector: mremap");
+      }
+#else
+      void* p = ::mmap(nullptr, new_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+      if (p == MAP_FAILED) {
+        detail::throw_errno("mmap_vector: mmap");
+      }
+      ::munmap(map_, old_bytes);
+#endif
+      map_ = static_cast<unsigned char*>(p);
+      capacity_ = new_capacity;
+      if (new_bytes < old_bytes && ::ftruncate(fd_, static_cast<off_t>(new_bytes)) != 0) {
+        detail::throw_errno("mmap_vector: ftruncate");
+      }
+      detail::apply_hint(map_, new_bytes, hint_ == access_hint::populate ? access_hint::normal : hint_);
+    }
+
+    template<typename T, typename GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::grow(size_t min_capacity) {
+      remap(GrowthPolicy::next_capacity(capacity_, min_capacity, sizeof(T)));
+    }
+
+    template<typename T, typename GrowthPolicy>
+    T& mmap_vector<T, GrowthPolicy>::operator[] (size_t index) {
+      return data()[index];
+    }
+
+    template<typename T, typename GrowthPolicy>
+    const T& mmap_vector<T, GrowthPolicy>::operator[] (size_t index) const {
+      return data()[index];
+    }
+
+    template<typename T, typename GrowthPolicy>
+    T& mmap_vector<T, GrowthPolicy>::at(size_t index) {
+      if (index >= size()) {
+        throw std::out_of_range("Index out of range");
+      }
+      return data()[index];
+    }
+
+    template<typename T, typename GrowthPolicy>
+    const T& mmap_vector<T, GrowthPolicy>::at(size_t index) const {
+      if (index >= size()) {
+        throw std::out_of_range("Index out of range");
+      }
+      return data()[index];
+    }
+
+    template<typename T, typename GrowthPolicy>
+    T& mmap_vector<T, GrowthPolicy>::front() {
+      if (size() == 0) {
+        throw std::out_of_range("Vector is empty");
+      }
+      return data()[0];
+    }
+
+    template<typename T, typename GrowthPolicy>
+    const T& mmap_vector<T, GrowthPolicy>::front() const {
+      if (size() == 0) {
+        throw std::out_of_range("Vector is empty");
+      }
+      return data()[0];
+    }
+
+    template<typename T, typename GrowthPolicy>
+    T& mmap_vector<T, GrowthPolicy>::back() {
+      if (size() == 0) {
+        throw std::out_of_range("Vector is empty");
+      }
+      return data()[size() - 1];
+    }
+
+    template<typename T, typename GrowthPolicy>
+    const T& mmap_vector<T, GrowthPolicy>::back() const {
+      if (size() == 0) {
+        throw std::out_of_range("Vector is empty");
+      }
+      return data()[size() - 1];
+    }
+
+    template<typename T, typename GrowthPolicy>
+    typename mmap_vector<T, GrowthPolicy>::iterator mmap_vector<T, GrowthPolicy>::begin() noexcept {
+      return iterator(data());
+    }
+
+    template<typename T, typename GrowthPolicy>
+    typename mmap_vector<T, GrowthPolicy>::const_iterator mmap_vector<T, GrowthPolicy>::begin() const noexcept {
+      return const_iterator(data());
+    }
+
+    template<typename T, typename GrowthPolicy>
+    typename mmap_vector<T, GrowthPolicy>::iterator mmap_vector<T, GrowthPolicy>::end() noexcept {
+      return iterator(data() + size());
+    }
+
+    template<typename T, typename GrowthPolicy>
+    typename mmap_vector<T, GrowthPolicy>::const_iterator mmap_vector<T, GrowthPolicy>::end() const noexcept {
+      return const_iterator(data() + size());
+    }
+
+    template<typename T, typename GrowthPolicy>
+    typename mmap_vector<T, GrowthPolicy>::const_iterator mmap_vector<T, GrowthPolicy>::cbegin() const noexcept {
+      return begin();
+    }
+
+    template<typename T, typename GrowthPolicy>
+    typename mmap_vector<T, GrowthPolicy>::const_iterator mmap_vector<T, GrowthPolicy>::cend() const noexcept {
+      return end();
+    }
+
+    template<typename T, typename GrowthPolicy>
+    typename mmap_vector<T, GrowthPolicy>::reverse_iterator mmap_vector<T, GrowthPolicy>::rbegin() noexcept {
+      return reverse_iterator(end());
+    }
+
+    template<typename T, typename GrowthPolicy>
+    typename mmap_vector<T, GrowthPolicy>::const_reverse_iterator mmap_vector<T, GrowthPolicy>::rbegin() const noexcept {
+      return const_reverse_iterator(end());
+    }
+
+    template<typename T, typename GrowthPolicy>
+    typename mmap_vector<T, GrowthPolicy>::reverse_iterator mmap_vector<T, GrowthPolicy>::rend() noexcept {
+      return reverse_iterator(begin());
+    }
+
+    template<typename T, typename GrowthPolicy>
+    typename mmap_vector<T, GrowthPolicy>::const_reverse_iterator mmap_vector<T, GrowthPolicy>::rend() const noexcept {
+      return const_reverse_iterator(begin());
+    }
+
+    template<typename T, typename GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::push_back(const T& value) {
+      emplace_back(value);
+    }
+
+    template<typename T, typename GrowthPolicy>
+    template<typename... Args>
+    T& mmap_vector<T, GrowthPolicy>::emplace_back(Args&&... args) {
+      check_open();
+      // Build the element first: args may refer into the mapping, which growing can move.
+      const T value(std::forward<Args>(args)...);
+      const size_t size = header().size;
+      if (size == capacity_) {
+        grow(size + 1);
+      }
+      T* slot = data() + size;
+      std::memcpy(static_cast<void*>(slot), &value, sizeof(T));
+      header().size = size + 1;
+      return *slot;
+    }
+
+    template<typename T, typename GrowthPolicy>
+    template<typename InputIt, typename>
+    void mmap_vector<T, GrowthPolicy>::append(InputIt first, InputIt last) {
+      check_open();
+      if constexpr (detail::is_forward_iterator_v<InputIt>) {
+        const size_t count = static_cast<size_t>(std::distance(first, last));
+        const size_t size = header().size;
+        if (count > capacity_ - size) {
+          // The source may live in this mapping, so copy it out before remapping.
+          if constexpr (detail::is_contiguous_iterator<InputIt>::value) {
+            const T* source = detail::to_address(first);
+            if (source >= data() && source < data() + capacity_) {
+              vector<T> copy(first, last);
+              append(copy.data(), copy.data() + copy.size());
+              return;
+            }
+          }
+          grow(size + count);
+        }
+        std::copy(first, last, data() + size);
+        header().size = size + count;
+      } else {
+        for (; first != last; ++first) {
+          emplace_back(*first);
+        }
+      }
+    }
+
+    template<typename T, typename GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::append(std::initializer_list<T> init) {
+      append(init.begin(), init.end());
+    }
+
+    template<typename T, typename GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::insert(size_t index, const T& value) {
+      check_open();
+      const size_t size = header().size;
+      if (index > size) {
+        throw std::out_of_range("Index out of range");
+      }
+      const T copy(value);
+      if (size == capacity_) {
+        grow(size + 1);
+      }
+      std::memmove(static_cast<void*>(data() + index + 1), data() + index, (size - index) * sizeof(T));
+      std::memcpy(static_cast<void*>(data() + index), &copy, sizeof(T));
+      header().size = size + 1;
+    }
+
+    template<typename T, typename GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::pop_back() {
+      if (size() == 0) {
+        throw std::out_of_range("Vector is empty");
+      }
+      --header().size;
+    }
+
+    template<typename T, typename GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::erase(size_t index) {
+      erase(index, index + 1);
+    }
+
+    template<typename T, typename GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::erase(size_t first, size_t last) {
+      check_open();
+      const size_t size = this->size();
+      if (first > last || last > size) {
+        throw std::out_of_range("Index out of range");
+      }
+      std::memmove(static_cast<void*>(data() + first), data() + last, (size - last) * sizeof(T));
+      header().size = size - (last - first);
+    }
+
+    template<typename T, typename GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::clear() noexcept {
+      if (map_) {
+        header().size = 0;
+      }
+    }
+
+    template<typename T, typename GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::resize(size_t new_size) {
+      resize(new_size, T());
+    }
+
+    template<typename T, typename GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::resize(size_t new_size, const T& value) {
+      check_open();
+      const size_t size = header().size;
+      const T copy(value);
+      resize_for_overwrite(new_size);
+      if (new_size > size) {
+        std::fill(data() + size, data() + new_size, copy);
+      }
+    }
+
+    template<typename T, typename GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::resize_for_overwrite(size_t new_size) {
+      check_open();
+      if (new_size > capacity_) {
+        grow(new_size);
+      }
+      header().size = new_size;
+    }
+
+    template<typename T, typename GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::ensure_capacity(size_t min_capacity) {
+      check_open();
+      if (min_capacity > capacity_) {
+        grow(min_capacity);
+      }
+    }
+
+    template<typename T, typename GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::shrink_to_fit() {
+      if (size() < capacity_) {
+        remap(size());
+      }
+    }
+
+    template<typename T, typename GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::trim_to_size() {
+      shrink_to_fit();
+    }
+
+    template<typename T, typename GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::swap(mmap_vector& other) noexcept {
+      std::swap(fd_, other.fd_);
+      std::swap(map_, other.map_);
+      std::swap(capacity_, other.capacity_);
+      std::swap(hint_, other.hint_);
+    }
+
+    template<typename T, typename GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::sync() {
+      if (map_ && ::msync(map_, mapped_bytes(capacity_), MS_SYNC) != 0) {
+        detail::throw_errno("mmap_vector: msync");
+      }
+    }
+
+    template<typename T, typename GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::sync(size_t first, size_t count) {
+      check_open();
+      if (first > size() || count > size() - first) {
+        throw std::out_of_range("Index out of range");
+      }
+      // msync wants a page-aligned start; the header page carries the size.
+      static const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+      const size_t begin = (sizeof(detail::mmap_header) + first * sizeof(T)) & ~(page - 1);
+      const size_t end = sizeof(detail::mmap_header) + (first + count) * sizeof(T);
+      if (begin != 0 && ::msync(map_, sizeof(detail::mmap_header), MS_SYNC) != 0) {
+        detail::throw_errno("mmap_vector: msync");
+      }
+      if (::msync(map_ + begin, end - begin, MS_SYNC) != 0) {
+        detail::throw_errno("mmap_vector: msync");
+      }
+    }
+
+    template<typename T, typename GrowthPolicy>
+    void mmap_vector<T, GrowthPolicy>::advise(access_hint hint) noexcept {
+      hint_ = hint;
+      if (map_) {
+        detail::apply_hint(map_, mapped_bytes(capacity_), hint);
+      }
+    }
+
+    template<typename T, typename GrowthPolicy>
+    size_t mmap_vector<T, GrowthPolicy>::size() const noexcept {
+      return map_ ? static_cast<size_t>(header().size) : 0;
+    }
+
+    template<typename T, typename GrowthPolicy>
+    size_t mmap_vector<T, GrowthPolicy>::capacity() const noexcept {
+      return capacity_;
+    }
+
+    template<typename T, typename GrowthPolicy>
+    T* mmap_vector<T, GrowthPolicy>::data() noexcept {
+      return map_ ? reinterpret_cast<T*>(map_ + sizeof(detail::mmap_header)) : nullptr;
+    }
+
+    template<typename T, typename GrowthPolicy>
+    const T* mmap_vector<T, GrowthPolicy>::data() const noexcept {
+      return map_ ? reinterpret_cast<const T*>(map_ + sizeof(detail::mmap_header)) : nullptr;
+    }
+
+} // namespace my_vector
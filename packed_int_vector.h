@@ -0,0 +1,257 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_PACKED_INT_VECTOR_H
+#define VECTOR_PACKED_INT_VECTOR_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+
+#include "bitpack.h"
+#include "vector.h"
+
+namespace my_vector {
+
+/**
+ * @brief A compressed, append-only vector of unsigned integers for ID lists and sorted columns.
+ *
+ * Values are stored in blocks of 128. Each sealed block is encoded on its own in whichever of
+ * two forms is smaller: frame of reference, which stores every value minus the block's
+ * minimum, or delta, which stores the differences between neighbours of a non-decreasing
+ * block. The residuals are bit-packed at the narrowest width that holds them, with SSE2
+ * when the CPU has it, so a block of sorted IDs that are close together takes a few bits per
+ * value. A block whose residuals need more than 32 bits is kept raw. The last, partial
+ * block stays uncompressed until it fills up.
+ *
+ * Random access finds the block from the index in constant time and then extracts one field
+ * (frame of reference) or unpacks the block and sums its deltas (delta). Iteration unpacks
+ * one block at a time into a buffer.
+ *
+ * @tparam T uint32_t or uint64_t.
+ */
+    template<typename T>
+    class packed_int_vector {
+        static_assert(std::is_same<T, uint32_t>::value || std::is_same<T, uint64_t>::value,
+                      "packed_int_vector stores uint32_t or uint64_t");
+    public:
+        /**
+         * @brief The number of values per block.
+         */
+        static constexpr size_t block_size = detail::simd::bitpack_values;
+    private:
+        /**
+         * @brief How a sealed block stores its values.
+         */
+        enum class encoding : uint8_t {
+            frame, /// value - base, where base is the smallest value
+            delta, /// value - previous value, where the first value is base
+            raw /// The values themselves
+        };
+
+        struct block_header {
+            T base; /// The smallest value for frame, the first value for delta
+            uint64_t offset; /// The first payload word of the block
+            uint8_t width; /// Bits per residual
+            encoding mode; /// How the block is encoded
+        };
+
+        vector<block_header> blocks_; /// One header per sealed block
+        vector<uint32_t> payload_; /// The packed residuals of all sealed blocks
+        vector<T> tail_; /// The values after the last sealed block, fewer than block_size
+
+      /**
+       * @brief Encodes 128 values as a new sealed block.
+       */
+        void seal(const T* values);
+
+      /**
+       * @brief Decodes all 128 values of a sealed block.
+       */
+        void decode(const block_header& header, T* out) const noexcept;
+
+      /**
+       * @brief Returns one value of a sealed block.
+       */
+        T decode_one(const block_header& header, size_t index) const noexcept;
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T;
+        using const_reference = T;
+
+        /**
+         * @brief Input iterator that decodes one block at a time into a buffer it carries.
+         *
+         * Copying the iterator copies the buffer, so prefer iterating over copying iterators.
+         */
+        class const_iterator {
+            const packed_int_vector* owner_; /// The vector being iterated
+            size_t index_; /// The position of the current value
+            std::array<T, block_size> buffer_; /// The decoded block that holds the current value
+
+          /**
+           * @brief Decodes the block that holds the current value, if there is one.
+           */
+            void load() noexcept;
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T*;
+            using reference = const T&;
+
+            const_iterator() noexcept : owner_(nullptr), index_(0), buffer_() {}
+            const_iterator(const packed_int_vector* owner, size_t index) noexcept;
+
+            /**
+             * @brief Returns the index of the value the iterator refers to.
+             */
+            size_t position() const noexcept { return index_; }
+
+            reference operator*() const noexcept { return buffer_[index_ % block_size]; }
+            pointer operator->() const noexcept { return &buffer_[index_ % block_size]; }
+
+            const_iterator& operator++() noexcept;
+            const_iterator operator++(int) noexcept { const_iterator tmp = *this; ++*this; return tmp; }
+
+            bool operator==(const const_iterator& other) const noexcept { return index_ == other.index_; }
+            bool operator!=(const const_iterator& other) const noexcept { return index_ != other.index_; }
+        };
+
+        using iterator = const_iterator;
+
+        /**
+         * @brief Default constructor.
+         *
+         * Creates an empty vector without allocating.
+         */
+        packed_int_vector() noexcept;
+
+        /**
+         * @brief Compresses the values of a vector.
+         *
+         * @param values The values to store.
+         */
+        template<typename Allocator, typename GrowthPolicy>
+        explicit packed_int_vector(const vector<T, Allocator, GrowthPolicy>& values);
+
+        /**
+         * @brief Constructor with initializer list.
+         *
+         * @param init The values to store.
+         */
+        packed_int_vector(std::initializer_list<T> init);
+
+        /**
+         * @brief Appends a value. Every 128th append encodes a block.
+         *
+         * @param value The value to append.
+         */
+        void push_back(T value);
+
+        /**
+         * @brief Appends count values, encoding full blocks straight from the input.
+         *
+         * @param values The values to append.
+         * @param count The number of values.
+         */
+        void append(const T* values, size_t count);
+
+        /**
+         * @brief Returns the value at the specified position.
+         *
+         * @param index The position of the value.
+         */
+        T operator[] (size_t index) const noexcept;
+
+        /**
+         * @brief Returns the value at the specified position with bounds checking.
+         *
+         * @param index The position of the value.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        T at(size_t index) const;
+
+        /**
+         * @brief Decodes one block, including the partial last one.
+         *
+         * @param block The block, below block_count().
+         * @param out Room for block_size values.
+         * @return The number of values written: block_size, or fewer for the last block.
+         */
+        size_t decode_block(size_t block, T* out) const noexcept;
+
+        /**
+         * @brief Decompresses all values into a vector.
+         */
+        vector<T> to_vector() const;
+
+        /**
+         * @brief Returns an iterator to the first value.
+         */
+        const_iterator begin() const noexcept;
+
+        /**
+         * @brief Returns an iterator past the last value.
+         */
+        const_iterator end() const noexcept;
+
+        /**
+         * @brief Returns an iterator to the first value.
+         */
+        const_iterator cbegin() const noexcept;
+
+        /**
+         * @brief Returns an iterator past the last value.
+         */
+        const_iterator cend() const noexcept;
+
+        /**
+         * @brief Returns the number of values.
+         */
+        [[nodiscard]] size_t size() const noexcept;
+
+        /**
+         * @brief Returns the number of blocks, counting a partial last block.
+         */
+        [[nodiscard]] size_t block_count() const noexcept;
+
+        /**
+         * @brief Returns the number of bytes the values take, including the block headers.
+         */
+        [[nodiscard]] size_t bytes_used() const noexcept;
+
+        /**
+         * @brief Frees the capacity no value uses.
+         */
+        void shrink_to_fit();
+
+        /**
+         * @brief Removes all values but keeps the storage.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Removes all values and frees the storage.
+         */
+        void clear_and_free() noexcept;
+
+        /**
+         * @brief Exchanges the contents with another vector.
+         *
+         * @param other The vector to swap with.
+         */
+        void swap(packed_int_vector& other) noexcept;
+    };
+
+} // namespace my_vector
+
+#include "packed_int_vector_impl.h"
+
+#endif //VECTOR_PACKED_INT_VECTOR_H
@@ -0,0 +1,272 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace my_vector {
+
+    template<typename T>
+    void packed_int_vector<T>::seal(const T* values) {
+      T low = values[0];
+      T high = values[0];
+      T largest_step = 0;
+      bool sorted = true;
+      for (size_t i = 1; i < block_size; ++i) {
+        low = std::min(low, values[i]);
+        high = std::max(high, values[i]);
+        sorted &= values[i - 1] <= values[i];
+        largest_step = std::max<T>(largest_step, values[i] - values[i - 1]);
+      }
+      const unsigned frame_width = detail::simd::bit_width(high - low);
+      const unsigned delta_width = sorted ? detail::simd::bit_width(largest_step) : 64;
+
+      block_header header{};
+      header.offset = payload_.size();
+      if (std::min(frame_width, delta_width) > 32) {
+        header.base = 0;
+        header.width = 8 * sizeof(T);
+        header.mode = encoding::raw;
+        std::memcpy(payload_.append_uninitialized(block_size * sizeof(T) / sizeof(uint32_t)), values,
+                    block_size * sizeof(T));
+      } else {
+        // Frame of reference wins ties: it can extract one value without unpacking the block.
+        uint32_t residuals[block_size];
+        if (delta_width < frame_width) {
+          header.base = values[0];
+          header.width = static_cast<uint8_t>(delta_width);
+          header.mode = encoding::delta;
+          residuals[0] = 0;
+          for (size_t i = 1; i < block_size; ++i) {
+            residuals[i] = static_cast<uint32_t>(values[i] - values[i - 1]);
+          }
+        } else {
+          header.base = low;
+          header.width = static_cast<uint8_t>(frame_width);
+          header.mode = encoding::frame;
+          for (size_t i = 0; i < block_size; ++i) {
+            residuals[i] = static_cast<uint32_t>(values[i] - low);
+          }
+        }
+        detail::simd::bitpack(residuals, payload_.append_uninitialized(detail::simd::bitpack_words(header.width)),
+                              header.width);
+      }
+      try {
+        blocks_.push_back(header);
+      } catch (...) {
+        payload_.resize(header.offset);
+        throw;
+      }
+    }
+
+    template<typename T>
+    void packed_int_vector<T>::decode(const block_header& header, T* out) const noexcept {
+      const uint32_t* words = payload_.data() + header.offset;
+      if (header.mode == encoding::raw) {
+        std::memcpy(out, words, block_size * sizeof(T));
+        return;
+      }
+      uint32_t residuals[block_size];
+      detail::simd::bitunpack(words, residuals, header.width);
+      if (header.mode == encoding::frame) {
+        for (size_t i = 0; i < block_size; ++i) {
+          out[i] = header.base + residuals[i];
+        }
+      } else {
+        T value = header.base;
+        for (size_t i = 0; i < block_size; ++i) {
+          value += residuals[i];
+          out[i] = value;
+        }
+      }
+    }
+
+    template<typename T>
+    T packed_int_vector<T>::decode_one(const block_header& header, size_t index) const noexcept {
+      const uint32_t* words = payload_.data() + header.offset;
+      if (header.mode == encoding::raw) {
+        T value;
+        std::memcpy(&value, words + index * (sizeof(T) / sizeof(uint32_t)), sizeof(T));
+        return value;
+      }
+      if (header.mode == encoding::frame) {
+        return header.base + detail::simd::bitunpack_one(words, index, header.width);
+      }
+      uint32_t residuals[block_size];
+      detail::simd::bitunpack(words, residuals, header.width);
+      T value = header.base;
+      for (size_t i = 1; i <= index; ++i) {
+        value += residuals[i];
+      }
+      return value;
+    }
+
+    template<typename T>
+    packed_int_vector<T>::const_iterator::const_iterator(const packed_int_vector* owner, size_t index) noexcept
+        : owner_(owner), index_(index) {
+      load();
+    }
+
+    template<typename T>
+    void packed_int_vector<T>::const_iterator::load() noexcept {
+      if (index_ < owner_->size()) {
+        owner_->decode_block(index_ / block_size, buffer_.data());
+      }
+    }
+
+    template<typename T>
+    typename packed_int_vector<T>::const_iterator& packed_int_vector<T>::const_iterator::operator++() noexcept {
+      if (++index_ % block_size == 0) {
+        load();
+      }
+      return *this;
+    }
+
+    template<typename T>
+    packed_int_vector<T>::packed_int_vector() noexcept : blocks_(), payload_(), tail_() {
+    }
+
+    template<typename T>
+    template<typename Allocator, typename GrowthPolicy>
+    packed_int_vector<T>::packed_int_vector(const vector<T, Allocator, GrowthPolicy>& values) : packed_int_vector() {
+      append(values.data(), values.size());
+    }
+
+    template<typename T>
+    packed_int_vector<T>::packed_int_vector(std::initializer_list<T> init) : packed_int_vector() {
+      append(init.begin(), init.size());
+    }
+
+    template<typename T>
+    void packed_int_vector<T>::push_back(T value) {
+      if (tail_.capacity() == 0) {
+        tail_.ensure_capacity(block_size);
+      }
+      tail_.push_back(value);
+      if (tail_.size() == block_size) {
+        try {
+          seal(tail_.data());
+        } catch (...) {
+          tail_.pop_back();
+          throw;
+        }
+        tail_.clear();
+      }
+    }
+
+    template<typename T>
+    void packed_int_vector<T>::append(const T* values, size_t count) {
+      for (; count > 0 && tail_.size() != 0; ++values, --count) {
+        push_back(*values);
+      }
+      for (; count >= block_size; values += block_size, count -= block_size) {
+        seal(values);
+      }
+      for (; count > 0; ++values, --count) {
+        push_back(*values);
+      }
+    }
+
+    template<typename T>
+    T packed_int_vector<T>::operator[](size_t index) const noexcept {
+      const size_t block = index / block_size;
+      if (block < blocks_.size()) {
+        return decode_one(blocks_[block], index % block_size);
+      }
+      return tail_[index % block_size];
+    }
+
+    template<typename T>
+    T packed_int_vector<T>::at(size_t index) const {
+      if (index >= size()) {
+        throw std::out_of_range("Index out of range");
+      }
+      return (*this)[index];
+    }
+
+    template<typename T>
+    size_t packed_int_vector<T>::decode_block(size_t block, T* out) const noexcept {
+      if (block < blocks_.size()) {
+        decode(blocks_[block], out);
+        return block_size;
+      }
+      std::copy(tail_.data(), tail_.data() + tail_.size(), out);
+      return tail_.size();
+    }
+
+    template<typename T>
+    vector<T> packed_int_vector<T>::to_vector() const {
+      vector<T> values;
+      values.resize_for_overwrite(size());
+      for (size_t block = 0; block < block_count(); ++block) {
+        decode_block(block, values.data() + block * block_size);
+      }
+      return values;
+    }
+
+    template<typename T>
+    typename packed_int_vector<T>::const_iterator packed_int_vector<T>::begin() const noexcept {
+      return const_iterator(this, 0);
+    }
+
+    template<typename T>
+    typename packed_int_vector<T>::const_iterator packed_int_vector<T>::end() const noexcept {
+      return const_iterator(this, size());
+    }
+
+    template<typename T>
+    typename packed_int_vector<T>::const_iterator packed_int_vector<T>::cbegin() const noexcept {
+      return begin();
+    }
+
+    template<typename T>
+    typename packed_int_vector<T>::const_iterator packed_int_vector<T>::cend() const noexcept {
+      return end();
+    }
+
+    template<typename T>
+    size_t packed_int_vector<T>::size() const noexcept {
+      return blocks_.size() * block_size + tail_.size();
+    }
+
+    template<typename T>
+    size_t packed_int_vector<T>::block_count() const noexcept {
+      return blocks_.size() + (tail_.size() != 0);
+    }
+
+    template<typename T>
+    size_t packed_int_vector<T>::bytes_used() const noexcept {
+      return blocks_.size() * sizeof(block_header) + payload_.size() * sizeof(uint32_t) + tail_.size() * sizeof(T);
+    }
+
+    template<typename T>
+    void packed_int_vector<T>::shrink_to_fit() {
+      blocks_.shrink_to_fit();
+      payload_.shrink_to_fit();
+      tail_.shrink_to_fit();
+    }
+
+    template<typename T>
+    void packed_int_vector<T>::clear() noexcept {
+      blocks_.clear();
+      payload_.clear();
+      tail_.clear();
+    }
+
+    template<typename T>
+    void packed_int_vector<T>::clear_and_free() noexcept {
+      blocks_.clear_and_free();
+      payload_.clear_and_free();
+      tail_.clear_and_free();
+    }
+
+    template<typename T>
+    void packed_int_vector<T>::swap(packed_int_vector& other) noexcept {
+      blocks_.swap(other.blocks_);
+      payload_.swap(other.payload_);
+      tail_.swap(other.tail_);
+    }
+
+} // namespace my_vector
@@ -0,0 +1,198 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_PARALLEL_H
+#define VECTOR_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "thread_pool.h"
+
+namespace my_vector {
+
+    /**
+     * @brief Threshold value that keeps bulk construction serial. This is the default.
+     */
+    inline constexpr size_t parallel_disabled = std::numeric_limits<size_t>::max();
+
+    namespace detail {
+
+    inline std::atomic<size_t> parallel_threshold_bytes{parallel_disabled};
+
+    /**
+     * @brief Granularity of the chunks handed to the workers.
+     *
+     * Chunk boundaries fall on page boundaries, so no two threads first-touch the same page
+     * and the kernel can place each page on the node of the thread that faulted it in.
+     */
+    inline constexpr size_t parallel_chunk_alignment = 4096;
+
+    } // namespace detail
+
+    /**
+     * @brief Sets the size from which bulk construction, copying and filling use the thread pool.
+     *
+     * Applies to the size-and-value constructor, the copy constructor, copy assignment and
+     * resize(n, value) of vector. Only containers whose allocator is always equal take part,
+     * because the elements are then constructed through the same allocator from several
+     * threads at once. The element constructors must be safe to run concurrently.
+     *
+     * @param bytes The number of bytes to construct from which the work is split across threads,
+     *              or parallel_disabled to always construct on the calling thread.
+     */
+    inline void set_parallel_threshold(size_t bytes) noexcept {
+      detail::parallel_threshold_bytes.store(bytes, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the size in bytes from which bulk construction runs on the thread pool.
+     */
+    inline size_t parallel_threshold() noexcept {
+      return detail::parallel_threshold_bytes.load(std::memory_order_relaxed);
+    }
+
+    namespace detail {
+
+    /**
+     * @brief Calls body(i) for every i in [0, count), spread over the shared thread pool.
+     *
+     * The calling thread claims indices as well, so the call completes even when every worker
+     * is busy, and nested calls from inside body cannot deadlock. Returns once every call has
+     * finished. body must not throw.
+     *
+     * @param count The number of indices.
+     * @param body The function to call for each index.
+     */
+    template<typename Body>
+    void parallel_for(size_t count, Body& body) {
+      struct job_state {
+          std::atomic<size_t> next{0};
+          size_t count = 0;
+          Body* body = nullptr;
+          std::mutex mutex;
+          std::condition_variable done;
+          size_t finished = 0;
+      };
+      const auto drain = [](job_state& job) {
+        size_t ran = 0;
+        for (size_t i; (i = job.next.fetch_add(1, std::memory_order_relaxed)) < job.count; ++ran) {
+          (*job.body)(i);
+        }
+        if (ran) {
+          std::lock_guard<std::mutex> lock(job.mutex);
+          job.finished += ran;
+          if (job.finished == job.count) {
+            job.done.notify_all();
+          }
+        }
+      };
+
+      // Workers that pick up their task late only touch the shared state, never body.
+      auto job = std::make_shared<job_state>();
+      job->count = count;
+      job->body = &body;
+      thread_pool& pool = thread_pool::instance();
+      const size_t helpers = std::min(pool.size(), count - 1);
+      for (size_t i = 0; i < helpers; ++i) {
+        pool.submit([job, drain] { drain(*job); });
+      }
+      drain(*job);
+      std::unique_lock<std::mutex> lock(job->mutex);
+      job->done.wait(lock, [&job] { return job->finished == job->count; });
+    }
+
+    /**
+     * @brief Constructs n elements at dest, on the thread pool when they are large enough.
+     *
+     * The range is cut into chunks whose boundaries fall on page boundaries, a few per thread
+     * so that uneven progress evens out. If any element constructor throws, the elements of
+     * every chunk are destroyed again before the first exception is rethrown, so on exit
+     * either all n elements exist or none do.
+     *
+     * @param alloc The allocator used to destroy elements after a failure.
+     * @param dest The uninitialized storage for the elements.
+     * @param n The number of elements to construct.
+     * @param construct Called as construct(p, i) to construct element i at p.
+     */
+    template<typename T, typename Allocator, typename Construct>
+    void construct_n(Allocator& alloc, T* dest, size_t n, Construct&& construct) {
+      using alloc_traits = std::allocator_traits<Allocator>;
+      const auto construct_range = [&alloc, &construct, dest](size_t first, size_t last) {
+        size_t i = first;
+        try {
+          for (; i < last; ++i) {
+            construct(dest + i, i);
+          }
+        } catch (...) {
+          for (size_t j = first; j < i; ++j) {
+            alloc_traits::destroy(alloc, dest + j);
+          }
+          throw;
+        }
+      };
+
+      // Decide before touching the pool, so the serial default never starts its threads.
+      if (!alloc_traits::is_always_equal::value || n < 2 || n * sizeof(T) < parallel_threshold()) {
+        construct_range(0, n);
+        return;
+      }
+      const size_t workers = thread_pool::instance().size();
+      if (workers == 0) {
+        construct_range(0, n);
+        return;
+      }
+
+      const size_t pages = (n * sizeof(T) + parallel_chunk_alignment - 1) / parallel_chunk_alignment;
+      const size_t chunks = std::max<size_t>(1, std::min(pages, 4 * (workers + 1)));
+      std::vector<size_t> bounds(chunks + 1);
+      const uintptr_t base = reinterpret_cast<uintptr_t>(dest);
+      for (size_t c = 1; c < chunks; ++c) {
+        const uintptr_t split = (base + n * sizeof(T) / chunks * c) & ~uintptr_t(parallel_chunk_alignment - 1);
+        const size_t index = split > base ? static_cast<size_t>((split - base + sizeof(T) - 1) / sizeof(T)) : 0;
+        bounds[c] = std::max(bounds[c - 1], std::min(n, index));
+      }
+      bounds[chunks] = n;
+
+      std::unique_ptr<bool[]> built(new bool[chunks]());
+      std::exception_ptr error;
+      std::mutex error_mutex;
+      auto body = [&](size_t c) {
+        try {
+          construct_range(bounds[c], bounds[c + 1]);
+          built[c] = true;
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(error_mutex);
+          if (!error) {
+            error = std::current_exception();
+          }
+        }
+      };
+      parallel_for(chunks, body);
+
+      if (error) {
+        for (size_t c = 0; c < chunks; ++c) {
+          if (built[c]) {
+            for (size_t i = bounds[c]; i < bounds[c + 1]; ++i) {
+              alloc_traits::destroy(alloc, dest + i);
+            }
+          }
+        }
+        std::rethrow_exception(error);
+      }
+    }
+
+    } // namespace detail
+
+} // namespace my_vector
+
+#endif //VECTOR_PARALLEL_H
@@ -0,0 +1,576 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_PERSISTENT_VECTOR_H
+#define VECTOR_PERSISTENT_VECTOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include "span.h"
+#include "vector.h"
+
+namespace my_vector {
+
+    namespace detail {
+
+    /**
+     * @brief Returns an editor id that no persistent_vector builder has used before.
+     */
+    inline uint64_t next_persistent_editor() noexcept {
+      static std::atomic<uint64_t> last{0};
+      return last.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    } // namespace detail
+
+/**
+ * @brief An immutable vector whose modified versions share structure with the original.
+ *
+ * The elements live in leaves of chunk_size (32) elements. Full leaves hang off a trie with 32
+ * children per inner node, and the last 1 to 32 elements sit in a separate tail leaf. Finding
+ * an element takes log32(n) steps, at most seven for 2^32 elements. Appending usually only
+ * copies the tail.
+ *
+ * push_back, set and pop_back never change the vector. They return a new version that copies
+ * the O(log32 n) nodes on the path to the changed element and shares every other node with
+ * the original through atomic reference counts. So keeping thousands of versions of a large
+ * array costs a few hundred bytes per version rather than a full copy. Versions may be read
+ * and released from different threads at once.
+ *
+ * For batch edits, transient() returns a builder. It marks the nodes it copies as its own and
+ * modifies them in place afterwards, so a run of edits copies each node at most once.
+ *
+ * Iteration walks one leaf at a time: iterators cache the current leaf, and chunk() and
+ * for_each_chunk() hand out whole leaves as contiguous spans.
+ *
+ * Nodes are shared between versions, so copies keep the allocator they were copied from.
+ *
+ * @tparam T The type of elements stored in the vector.
+ * @tparam Allocator The allocator, rebound to the node types.
+ */
+    template<typename T, typename Allocator = std::allocator<T>>
+    class persistent_vector : private detail::allocator_holder<Allocator> {
+        using alloc_traits = std::allocator_traits<Allocator>;
+        using detail::allocator_holder<Allocator>::allocator;
+
+        static constexpr unsigned bits = 5;
+    public:
+        /**
+         * @brief The number of elements per leaf and of children per inner node.
+         */
+        static constexpr size_t chunk_size = size_t(1) << bits;
+    private:
+        static constexpr size_t mask = chunk_size - 1;
+
+        /**
+         * @brief The editor id of persistent operations, which never modify a node in place.
+         */
+        static constexpr uint64_t no_editor = 0;
+
+        struct node {
+            std::atomic<size_t> refs; /// Number of versions, builders and parent nodes that refer to the node
+            uint64_t editor; /// The builder that may modify the node in place, or no_editor
+        };
+
+        struct inner_node : node {
+            node* children[chunk_size]; /// The subtrees, nullptr after the last one
+        };
+
+        struct leaf_node : node {
+            size_t count; /// Number of constructed elements
+            alignas(T) unsigned char storage[chunk_size * sizeof(T)]; /// Room for chunk_size elements
+
+            T* values() noexcept { return reinterpret_cast<T*>(storage); }
+            const T* values() const noexcept { return reinterpret_cast<const T*>(storage); }
+        };
+
+        using inner_allocator = typename alloc_traits::template rebind_alloc<inner_node>;
+        using inner_traits = std::allocator_traits<inner_allocator>;
+        using leaf_allocator = typename alloc_traits::template rebind_alloc<leaf_node>;
+        using leaf_traits = std::allocator_traits<leaf_allocator>;
+
+        size_t size_; /// Number of elements
+        unsigned shift_; /// The index shift that selects a child of the root; bits when the root's children are leaves
+        inner_node* root_; /// The trie of full leaves, nullptr while there are none
+        leaf_node* tail_; /// The leaf with the last elements, nullptr if the vector is empty
+
+      /**
+       * @brief Checks whether the given builder may modify the node in place.
+       */
+        static bool owns(const node* n, uint64_t editor) noexcept;
+
+      /**
+       * @brief Adds a reference to a node, if there is one.
+       */
+        static void retain(node* n) noexcept;
+
+      /**
+       * @brief Allocates an inner node without children and with one reference.
+       */
+        inner_node* new_inner(uint64_t editor);
+
+      /**
+       * @brief Allocates a leaf without elements and with one reference.
+       */
+        leaf_node* new_leaf(uint64_t editor);
+
+      /**
+       * @brief Copies an inner node, adding a reference to each child.
+       */
+        inner_node* copy_inner(const inner_node* source, uint64_t editor);
+
+      /**
+       * @brief Copies the first count elements of a leaf into a new leaf.
+       */
+        leaf_node* copy_leaf(const leaf_node* source, size_t count, uint64_t editor);
+
+      /**
+       * @brief Drops a reference to a node at the given level, freeing the subtree on the last one.
+       *
+       * Leaves are at level 0, and the children of a node at level L are at level L - bits.
+       */
+        void release(node* n, unsigned level) noexcept;
+
+      /**
+       * @brief Returns the index of the first element in the tail.
+       */
+        size_t tail_offset() const noexcept;
+
+      /**
+       * @brief Returns the leaf that holds the element at the given index.
+       */
+        const leaf_node* leaf_for(size_t index) const noexcept;
+
+      /**
+       * @brief Appends an element, copying the nodes the given builder does not own.
+       */
+        template<typename... Args>
+        void append_element(uint64_t editor, Args&&... args);
+
+      /**
+       * @brief Adds a reference to the full tail to the trie, growing it by a level if it is full.
+       */
+        void push_tail(uint64_t editor);
+
+      /**
+       * @brief Returns a chain of new inner nodes from the given level down to the leaf.
+       */
+        node* new_path(unsigned level, leaf_node* leaf, uint64_t editor);
+
+      /**
+       * @brief Adds the leaf at the given index below parent, returning parent or its copy.
+       */
+        inner_node* push_tail_at(inner_node* parent, unsigned level, size_t index, leaf_node* leaf, uint64_t editor);
+
+      /**
+       * @brief Replaces an element, copying the nodes the given builder does not own.
+       */
+        void assign_element(size_t index, const T& value, uint64_t editor);
+
+      /**
+       * @brief Replaces the element at the given index below n, returning n or its copy.
+       */
+        node* assign_at(node* n, unsigned level, size_t index, const T& value, uint64_t editor);
+
+      /**
+       * @brief Removes the last element, copying the nodes the given builder does not own.
+       */
+        void remove_last(uint64_t editor);
+
+      /**
+       * @brief Removes the leaf at the given index below parent.
+       *
+       * @return parent or its copy, or nullptr if the subtree held nothing else.
+       */
+        inner_node* pop_tail_at(inner_node* parent, unsigned level, size_t index, uint64_t editor);
+
+      /**
+       * @brief Shares the nodes of another vector, which must use an equal allocator.
+       */
+        void share(const persistent_vector& other) noexcept;
+
+      /**
+       * @brief Drops the references to all nodes and leaves the vector empty.
+       */
+        void reset() noexcept;
+
+      /**
+       * @brief Replaces the contents with copies of the elements of a vector with an unequal allocator.
+       */
+        void copy_elements(const persistent_vector& other);
+
+      /**
+       * @brief Calls f with the span of every leaf below n, in order.
+       */
+        template<typename F>
+        static void visit_leaves(const node* n, unsigned level, F& f);
+
+      /**
+       * @brief Checks if the vector is empty.
+       *
+       * @return True if the vector is empty, false otherwise.
+       */
+        bool is_empty() const noexcept;
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using const_reference = const T&;
+
+        /**
+         * @brief Random access iterator that caches the leaf of the current element.
+         *
+         * Stepping within a leaf is a pointer increment; crossing into the next leaf walks the
+         * trie once. The iterator stays valid as long as the version it came from.
+         */
+        class const_iterator {
+            const persistent_vector* owner_; /// The version being iterated
+            size_t index_; /// The position of the current element
+            const T* chunk_; /// The elements of the current leaf, nullptr at the end
+
+          /**
+           * @brief Looks up the leaf of the current element, if there is one.
+           */
+            void load() noexcept;
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T*;
+            using reference = const T&;
+
+            const_iterator() noexcept : owner_(nullptr), index_(0), chunk_(nullptr) {}
+            const_iterator(const persistent_vector* owner, size_t index) noexcept;
+
+            /**
+             * @brief Returns the index of the element the iterator refers to.
+             */
+            size_t position() const noexcept { return index_; }
+
+            reference operator*() const noexcept { return chunk_[index_ & mask]; }
+            pointer operator->() const noexcept { return &chunk_[index_ & mask]; }
+            reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+            const_iterator& operator++() noexcept;
+            const_iterator operator++(int) noexcept { const_iterator tmp = *this; ++*this; return tmp; }
+            const_iterator& operator--() noexcept;
+            const_iterator operator--(int) noexcept { const_iterator tmp = *this; --*this; return tmp; }
+            const_iterator& operator+=(difference_type n) noexcept { index_ += n; load(); return *this; }
+            const_iterator& operator-=(difference_type n) noexcept { index_ -= n; load(); return *this; }
+
+            friend const_iterator operator+(const_iterator it, difference_type n) noexcept { return it += n; }
+            friend const_iterator operator+(difference_type n, const_iterator it) noexcept { return it += n; }
+            friend const_iterator operator-(const_iterator it, difference_type n) noexcept { return it -= n; }
+
+            difference_type operator-(const const_iterator& other) const noexcept {
+              return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+            }
+
+            bool operator==(const const_iterator& other) const noexcept { return index_ == other.index_; }
+            bool operator!=(const const_iterator& other) const noexcept { return index_ != other.index_; }
+            bool operator<(const const_iterator& other) const noexcept { return index_ < other.index_; }
+            bool operator>(const const_iterator& other) const noexcept { return index_ > other.index_; }
+            bool operator<=(const const_iterator& other) const noexcept { return index_ <= other.index_; }
+            bool operator>=(const const_iterator& other) const noexcept { return index_ >= other.index_; }
+        };
+
+        using iterator = const_iterator;
+
+        /**
+         * @brief A mutable working copy for batch edits, made by transient().
+         *
+         * The builder tags every node it copies or creates with an editor id and modifies
+         * tagged nodes in place, so n appends cost amortized O(1) each and repeated sets in one
+         * leaf copy its path once. persistent() returns the current contents as a version in
+         * O(1) and retires the id, so the builder copies again before touching shared nodes.
+         * A builder must not be used from several threads at once.
+         */
+        class builder {
+            persistent_vector elements_; /// The current contents
+            uint64_t editor_; /// The id of the nodes this builder may modify in place
+        public:
+            /**
+             * @brief Starts a builder from a version. Takes O(1).
+             *
+             * @param source The version to start from.
+             */
+            explicit builder(const persistent_vector& source);
+
+            builder(const builder&) = delete;
+            builder& operator=(const builder&) = delete;
+
+            /**
+             * @brief Move constructor. The moved-from builder is left empty.
+             *
+             * @param other The builder to move from.
+             */
+            builder(builder&& other) noexcept;
+
+            /**
+             * @brief Appends a copy of the value.
+             *
+             * @param value The value to append.
+             */
+            void push_back(const T& value);
+
+            /**
+             * @brief Appends the value by moving it.
+             *
+             * @param value The value to append.
+             */
+            void push_back(T&& value);
+
+            /**
+             * @brief Constructs an element in place at the end.
+             *
+             * @param args The arguments for the constructor of T.
+             */
+            template<typename... Args>
+            void emplace_back(Args&&... args);
+
+            /**
+             * @brief Replaces the element at the specified position.
+             *
+             * @param index The position of the element.
+             * @param value The new value.
+             * @throws std::out_of_range if the index is out of range.
+             */
+            void set(size_t index, const T& value);
+
+            /**
+             * @brief Removes the last element.
+             *
+             * @throws std::out_of_range if the builder is empty.
+             */
+            void pop_back();
+
+            /**
+             * @brief Accesses the element at the specified position.
+             *
+             * @param index The position of the element to access.
+             */
+            const T& operator[] (size_t index) const noexcept { return elements_[index]; }
+
+            /**
+             * @brief Returns the number of elements.
+             */
+            [[nodiscard]] size_t size() const noexcept { return elements_.size(); }
+
+            /**
+             * @brief Returns the current contents as a version that later edits do not affect.
+             */
+            persistent_vector persistent();
+        };
+
+        /**
+         * @brief Default constructor.
+         *
+         * Creates an empty vector without allocating.
+         */
+        persistent_vector() noexcept(std::is_nothrow_default_constructible<Allocator>::value);
+
+        /**
+         * @brief Constructs an empty vector that uses the given allocator.
+         *
+         * @param alloc The allocator to use.
+         */
+        explicit persistent_vector(const Allocator& alloc) noexcept;
+
+        /**
+         * @brief Constructor with initializer list.
+         *
+         * @param init The initializer list to initialize the elements.
+         * @param alloc The allocator to use.
+         */
+        persistent_vector(std::initializer_list<T> init, const Allocator& alloc = Allocator());
+
+        /**
+         * @brief Constructor from an iterator range.
+         *
+         * @param first The beginning of the range.
+         * @param last The end of the range.
+         * @param alloc The allocator to use.
+         */
+        template<typename InputIt, typename = detail::require_input_iterator<InputIt>>
+        persistent_vector(InputIt first, InputIt last, const Allocator& alloc = Allocator());
+
+        /**
+         * @brief Copy constructor. Shares all nodes, so it takes O(1).
+         *
+         * @param other The vector to copy from.
+         */
+        persistent_vector(const persistent_vector& other) noexcept;
+
+        /**
+         * @brief Copy assignment operator.
+         *
+         * Shares the nodes if the allocators propagate or compare equal, and copies the
+         * elements otherwise.
+         *
+         * @param other The vector to copy from.
+         * @return A reference to the assigned vector.
+         */
+        persistent_vector& operator=(const persistent_vector& other);
+
+        /**
+         * @brief Move constructor.
+         *
+         * @param other The vector to move from.
+         */
+        persistent_vector(persistent_vector&& other) noexcept;
+
+        /**
+         * @brief Move assignment operator.
+         *
+         * Takes over the nodes if the allocators propagate or compare equal, and copies the
+         * elements otherwise.
+         *
+         * @param other The vector to move from.
+         * @return A reference to the assigned vector.
+         */
+        persistent_vector& operator=(persistent_vector&& other)
+            noexcept(alloc_traits::propagate_on_container_move_assignment::value
+                     || alloc_traits::is_always_equal::value);
+
+        /**
+         * @brief Destructor. Frees the nodes no other version shares.
+         */
+        ~persistent_vector();
+
+        /**
+         * @brief Returns a version with a copy of the value appended.
+         *
+         * @param value The value to append.
+         */
+        [[nodiscard]] persistent_vector push_back(const T& value) const;
+
+        /**
+         * @brief Returns a version with the value appended by moving it.
+         *
+         * @param value The value to append.
+         */
+        [[nodiscard]] persistent_vector push_back(T&& value) const;
+
+        /**
+         * @brief Returns a version with the element at the specified position replaced.
+         *
+         * @param index The position of the element.
+         * @param value The new value.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        [[nodiscard]] persistent_vector set(size_t index, const T& value) const;
+
+        /**
+         * @brief Returns a version without the last element.
+         *
+         * @throws std::out_of_range if the vector is empty.
+         */
+        [[nodiscard]] persistent_vector pop_back() const;
+
+        /**
+         * @brief Returns a builder that starts from this version.
+         */
+        builder transient() const;
+
+        /**
+         * @brief Accesses the element at the specified position.
+         *
+         * @param index The position of the element to access.
+         * @return A const reference to the element.
+         */
+        const T& operator[] (size_t index) const noexcept;
+
+        /**
+         * @brief Accesses the element at the specified position with bounds checking.
+         *
+         * @param index The position of the element to access.
+         * @return A const reference to the element.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        const T& at(size_t index) const;
+
+        /**
+         * @brief Accesses the first element.
+         *
+         * @throws std::out_of_range if the vector is empty.
+         */
+        const T& front() const;
+
+        /**
+         * @brief Accesses the last element.
+         *
+         * @throws std::out_of_range if the vector is empty.
+         */
+        const T& back() const;
+
+        /**
+         * @brief Returns the number of leaves, counting the tail.
+         */
+        [[nodiscard]] size_t chunk_count() const noexcept;
+
+        /**
+         * @brief Returns the elements of one leaf: chunk_size of them, or fewer for the last one.
+         *
+         * @param chunk The leaf, below chunk_count().
+         */
+        span<const T> chunk(size_t chunk) const noexcept;
+
+        /**
+         * @brief Calls f with the span of every leaf, in order, walking the trie once.
+         *
+         * @param f A callable that takes span<const T>.
+         */
+        template<typename F>
+        void for_each_chunk(F f) const;
+
+        /**
+         * @brief Returns an iterator to the first element.
+         */
+        const_iterator begin() const noexcept;
+
+        /**
+         * @brief Returns an iterator past the last element.
+         */
+        const_iterator end() const noexcept;
+
+        /**
+         * @brief Returns an iterator to the first element.
+         */
+        const_iterator cbegin() const noexcept;
+
+        /**
+         * @brief Returns an iterator past the last element.
+         */
+        const_iterator cend() const noexcept;
+
+        /**
+         * @brief Returns the number of elements.
+         */
+        [[nodiscard]] size_t size() const noexcept;
+
+        /**
+         * @brief Exchanges the contents with another vector.
+         *
+         * @param other The vector to swap with.
+         */
+        void swap(persistent_vector& other) noexcept;
+
+        /**
+         * @brief Returns the allocator associated with the vector.
+         */
+        allocator_type get_allocator() const noexcept;
+    };
+
+} // namespace my_vector
+
+#include "persistent_vector_impl.h"
+
+#endif //VECTOR_PERSISTENT_VECTOR_H
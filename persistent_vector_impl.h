@@ -0,0 +1,723 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace my_vector {
+
+    template<typename T, typename Allocator>
+    bool persistent_vector<T, Allocator>::owns(const node* n, uint64_t editor) noexcept {
+      return editor != no_editor && n->editor == editor;
+    }
+
+    template<typename T, typename Allocator>
+    void persistent_vector<T, Allocator>::retain(node* n) noexcept {
+      if (n) {
+        n->refs.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+
+    template<typename T, typename Allocator>
+    typename persistent_vector<T, Allocator>::inner_node* persistent_vector<T, Allocator>::new_inner(uint64_t editor) {
+      inner_allocator inners(allocator());
+      inner_node* result = ::new (static_cast<void*>(inner_traits::allocate(inners, 1))) inner_node;
+      result->refs.store(1, std::memory_order_relaxed);
+      result->editor = editor;
+      std::fill(result->children, result->children + chunk_size, nullptr);
+      return result;
+    }
+
+    template<typename T, typename Allocator>
+    typename persistent_vector<T, Allocator>::leaf_node* persistent_vector<T, Allocator>::new_leaf(uint64_t editor) {
+      leaf_allocator leaves(allocator());
+      leaf_node* result = ::new (static_cast<void*>(leaf_traits::allocate(leaves, 1))) leaf_node;
+      result->refs.store(1, std::memory_order_relaxed);
+      result->editor = editor;
+      result->count = 0;
+      return result;
+    }
+
+    template<typename T, typename Allocator>
+    typename persistent_vector<T, Allocator>::inner_node*
+    persistent_vector<T, Allocator>::copy_inner(const inner_node* source, uint64_t editor) {
+      inner_node* result = new_inner(editor);
+      for (size_t i = 0; i < chunk_size && source->children[i]; ++i) {
+        retain(source->children[i]);
+        result->children[i] = source->children[i];
+      }
+      return result;
+    }
+
+    template<typename T, typename Allocator>
+    typename persistent_vector<T, Allocator>::leaf_node*
+    persistent_vector<T, Allocator>::copy_leaf(const leaf_node* source, size_t count, uint64_t editor) {
+      leaf_node* result = new_leaf(editor);
+      try {
+        for (; result->count < count; ++result->count) {
+          alloc_traits::construct(allocator(), result->values() + result->count, source->values()[result->count]);
+        }
+      } catch (...) {
+        release(result, 0);
+        throw;
+      }
+      return result;
+    }
+
+    template<typename T, typename Allocator>
+    void persistent_vector<T, Allocator>::release(node* n, unsigned level) noexcept {
+      // The last owner's acquire pairs with every other owner's release, so their reads of
+      // the subtree happen before it is destroyed.
+      if (!n || n->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+      }
+      if (level == 0) {
+        auto* leaf = static_cast<leaf_node*>(n);
+        for (size_t i = 0; i < leaf->count; ++i) {
+          alloc_traits::destroy(allocator(), leaf->values() + i);
+        }
+        leaf->~leaf_node();
+        leaf_allocator leaves(allocator());
+        leaf_traits::deallocate(leaves, leaf, 1);
+      } else {
+        auto* inner = static_cast<inner_node*>(n);
+        for (size_t i = 0; i < chunk_size && inner->children[i]; ++i) {
+          release(inner->children[i], level - bits);
+        }
+        inner->~inner_node();
+        inner_allocator inners(allocator());
+        inner_traits::deallocate(inners, inner, 1);
+      }
+    }
+
+    template<typename T, typename Allocator>
+    size_t persistent_vector<T, Allocator>::tail_offset() const noexcept {
+      return size_ == 0 ? 0 : (size_ - 1) & ~mask;
+    }
+
+    template<typename T, typename Allocator>
+    const typename persistent_vector<T, Allocator>::leaf_node*
+    persistent_vector<T, Allocator>::leaf_for(size_t index) const noexcept {
+      if (index >= tail_offset()) {
+        return tail_;
+      }
+      const node* n = root_;
+      for (unsigned level = shift_; level > 0; level -= bits) {
+        n = static_cast<const inner_node*>(n)->children[(index >> level) & mask];
+      }
+      return static_cast<const leaf_node*>(n);
+    }
+
+    template<typename T, typename Allocator>
+    template<typename... Args>
+    void persistent_vector<T, Allocator>::append_element(uint64_t editor, Args&&... args) {
+      const size_t tail_count = size_ - tail_offset();
+      if (tail_ && tail_count < chunk_size && owns(tail_, editor)) {
+        alloc_traits::construct(allocator(), tail_->values() + tail_count, std::forward<Args>(args)...);
+        ++tail_->count;
+        ++size_;
+        return;
+      }
+      // The arguments may refer into the tail that is released below.
+      T value(std::forward<Args>(args)...);
+      leaf_node* fresh;
+      if (tail_ && tail_count < chunk_size) {
+        fresh = copy_leaf(tail_, tail_count, editor);
+        try {
+          alloc_traits::construct(allocator(), fresh->values() + tail_count, std::move(value));
+        } catch (...) {
+          release(fresh, 0);
+          throw;
+        }
+      } else {
+        fresh = new_leaf(editor);
+        try {
+          alloc_traits::construct(allocator(), fresh->values(), std::move(value));
+        } catch (...) {
+          release(fresh, 0);
+          throw;
+        }
+      }
+      ++fresh->count;
+      if (tail_ && tail_count == chunk_size) {
+        try {
+          push_tail(editor);
+        } catch (...) {
+          release(fresh, 0);
+          throw;
+        }
+      }
+      release(tail_, 0);
+      tail_ = fresh;
+      ++size_;
+    }
+
+    template<typename T, typename Allocator>
+    void persistent_vector<T, Allocator>::push_tail(uint64_t editor) {
+      if (!root_) {
+        root_ = new_inner(editor);
+        retain(tail_);
+        root_->children[0] = tail_;
+        shift_ = bits;
+        return;
+      }
+      if ((size_ >> bits) > (size_t(1) << shift_)) {
+        // The root is full: it becomes the first child of a new root one level up.
+        inner_node* top = new_inner(editor);
+        try {
+          top->children[1] = new_path(shift_, tail_, editor);
+        } catch (...) {
+          release(top, shift_ + bits);
+          throw;
+        }
+        top->children[0] = root_;
+        root_ = top;
+        shift_ += bits;
+        return;
+      }
+      inner_node* result = push_tail_at(root_, shift_, size_ - chunk_size, tail_, editor);
+      if (result != root_) {
+        release(root_, shift_);
+        root_ = result;
+      }
+    }
+
+    template<typename T, typename Allocator>
+    typename persistent_vector<T, Allocator>::node*
+    persistent_vector<T, Allocator>::new_path(unsigned level, leaf_node* leaf, uint64_t editor) {
+      retain(leaf);
+      node* path = leaf;
+      unsigned built = 0;
+      try {
+        for (; built < level; built += bits) {
+          inner_node* parent = new_inner(editor);
+          parent->children[0] = path;
+          path = parent;
+        }
+      } catch (...) {
+        release(path, built);
+        throw;
+      }
+      return path;
+    }
+
+    template<typename T, typename Allocator>
+    typename persistent_vector<T, Allocator>::inner_node*
+    persistent_vector<T, Allocator>::push_tail_at(inner_node* parent, unsigned level, size_t index, leaf_node* leaf,
+                                                  uint64_t editor) {
+      const bool in_place = owns(parent, editor);
+      inner_node* result = in_place ? parent : copy_inner(parent, editor);
+      const size_t slot = (index >> level) & mask;
+      node* child;
+      try {
+        if (level == bits) {
+          retain(leaf);
+          child = leaf;
+        } else if (result->children[slot]) {
+          child = push_tail_at(static_cast<inner_node*>(result->children[slot]), level - bits, index, leaf, editor);
+        } else {
+          child = new_path(level - bits, leaf, editor);
+        }
+      } catch (...) {
+        if (!in_place) {
+          release(result, level);
+        }
+        throw;
+      }
+      if (child != result->children[slot]) {
+        release(result->children[slot], level - bits);
+        result->children[slot] = child;
+      }
+      return result;
+    }
+
+    template<typename T, typename Allocator>
+    void persistent_vector<T, Allocator>::assign_element(size_t index, const T& value, uint64_t editor) {
+      if (index >= tail_offset()) {
+        node* result = assign_at(tail_, 0, index, value, editor);
+        if (result != tail_) {
+          release(tail_, 0);
+          tail_ = static_cast<leaf_node*>(result);
+        }
+      } else {
+        node* result = assign_at(root_, shift_, index, value, editor);
+        if (result != root_) {
+          release(root_, shift_);
+          root_ = static_cast<inner_node*>(result);
+        }
+      }
+    }
+
+    template<typename T, typename Allocator>
+    typename persistent_vector<T, Allocator>::node*
+    persistent_vector<T, Allocator>::assign_at(node* n, unsigned level, size_t index, const T& value, uint64_t editor) {
+      if (level == 0) {
+        auto* leaf = static_cast<leaf_node*>(n);
+        if (owns(leaf, editor)) {
+          leaf->values()[index & mask] = value;
+          return leaf;
+        }
+        leaf_node* result = copy_leaf(leaf, leaf->count, editor);
+        try {
+          result->values()[index & mask] = value;
+        } catch (...) {
+          release(result, 0);
+          throw;
+        }
+        return result;
+      }
+      auto* parent = static_cast<inner_node*>(n);
+      const bool in_place = owns(parent, editor);
+      inner_node* result = in_place ? parent : copy_inner(parent, editor);
+      const size_t slot = (index >> level) & mask;
+      node* child;
+      try {
+        child = assign_at(result->children[slot], level - bits, index, value, editor);
+      } catch (...) {
+        if (!in_place) {
+          release(result, level);
+        }
+        throw;
+      }
+      if (child != result->children[slot]) {
+        release(result->children[slot], level - bits);
+        result->children[slot] = child;
+      }
+      return result;
+    }
+
+    template<typename T, typename Allocator>
+    void persistent_vector<T, Allocator>::remove_last(uint64_t editor) {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      const size_t tail_count = size_ - tail_offset();
+      if (tail_count > 1) {
+        if (owns(tail_, editor)) {
+          alloc_traits::destroy(allocator(), tail_->values() + --tail_->count);
+        } else {
+          leaf_node* fresh = copy_leaf(tail_, tail_count - 1, editor);
+          release(tail_, 0);
+          tail_ = fresh;
+        }
+        --size_;
+        return;
+      }
+      if (!root_) {
+        release(tail_, 0);
+        tail_ = nullptr;
+        --size_;
+        return;
+      }
+      // The tail empties, so the last leaf of the trie becomes the tail.
+      auto* last = const_cast<leaf_node*>(leaf_for(size_ - 2));
+      retain(last);
+      inner_node* result;
+      try {
+        result = pop_tail_at(root_, shift_, size_ - 2, editor);
+      } catch (...) {
+        release(last, 0);
+        throw;
+      }
+      if (result != root_) {
+        release(root_, shift_);
+        root_ = result;
+      }
+      if (root_ && shift_ > bits && !root_->children[1]) {
+        node* only = root_->children[0];
+        retain(only);
+        release(root_, shift_);
+        root_ = static_cast<inner_node*>(only);
+        shift_ -= bits;
+      }
+      release(tail_, 0);
+      tail_ = last;
+      --size_;
+    }
+
+    template<typename T, typename Allocator>
+    typename persistent_vector<T, Allocator>::inner_node*
+    persistent_vector<T, Allocator>::pop_tail_at(inner_node* parent, unsigned level, size_t index, uint64_t editor) {
+      const size_t slot = (index >> level) & mask;
+      if (level == bits && slot == 0) {
+        return nullptr;
+      }
+      const bool in_place = owns(parent, editor);
+      inner_node* result = in_place ? parent : copy_inner(parent, editor);
+      node* child = nullptr;
+      if (level > bits) {
+        try {
+          child = pop_tail_at(static_cast<inner_node*>(result->children[slot]), level - bits, index, editor);
+        } catch (...) {
+          if (!in_place) {
+            release(result, level);
+          }
+          throw;
+        }
+        if (!child && slot == 0) {
+          if (!in_place) {
+            release(result, level);
+          }
+          return nullptr;
+        }
+      }
+      if (child != result->children[slot]) {
+        release(result->children[slot], level - bits);
+        result->children[slot] = child;
+      }
+      return result;
+    }
+
+    template<typename T, typename Allocator>
+    void persistent_vector<T, Allocator>::share(const persistent_vector& other) noexcept {
+      retain(other.root_);
+      retain(other.tail_);
+      size_ = other.size_;
+      shift_ = other.shift_;
+      root_ = other.root_;
+      tail_ = other.tail_;
+    }
+
+    template<typename T, typename Allocator>
+    void persistent_vector<T, Allocator>::reset() noexcept {
+      release(root_, shift_);
+      release(tail_, 0);
+      size_ = 0;
+      shift_ = bits;
+      root_ = nullptr;
+      tail_ = nullptr;
+    }
+
+    template<typename T, typename Allocator>
+    void persistent_vector<T, Allocator>::copy_elements(const persistent_vector& other) {
+      const persistent_vector empty(allocator());
+      builder edits(empty);
+      for (const T& value : other) {
+        edits.push_back(value);
+      }
+      persistent_vector copy = edits.persistent();
+      reset();
+      share(copy);
+    }
+
+    template<typename T, typename Allocator>
+    template<typename F>
+    void persistent_vector<T, Allocator>::visit_leaves(const node* n, unsigned level, F& f) {
+      if (level == 0) {
+        const auto* leaf = static_cast<const leaf_node*>(n);
+        f(span<const T>(leaf->values(), leaf->count));
+        return;
+      }
+      const auto* inner = static_cast<const inner_node*>(n);
+      for (size_t i = 0; i < chunk_size && inner->children[i]; ++i) {
+        visit_leaves(inner->children[i], level - bits, f);
+      }
+    }
+
+    template<typename T, typename Allocator>
+    bool persistent_vector<T, Allocator>::is_empty() const noexcept {
+      return size_ == 0;
+    }
+
+    template<typename T, typename Allocator>
+    persistent_vector<T, Allocator>::const_iterator::const_iterator(const persistent_vector* owner, size_t index) noexcept
+        : owner_(owner), index_(index), chunk_(nullptr) {
+      load();
+    }
+
+    template<typename T, typename Allocator>
+    void persistent_vector<T, Allocator>::const_iterator::load() noexcept {
+      chunk_ = index_ < owner_->size() ? owner_->leaf_for(index_)->values() : nullptr;
+    }
+
+    template<typename T, typename Allocator>
+    typename persistent_vector<T, Allocator>::const_iterator&
+    persistent_vector<T, Allocator>::const_iterator::operator++() noexcept {
+      if ((++index_ & mask) == 0) {
+        load();
+      }
+      return *this;
+    }
+
+    template<typename T, typename Allocator>
+    typename persistent_vector<T, Allocator>::const_iterator&
+    persistent_vector<T, Allocator>::const_iterator::operator--() noexcept {
+      // The end iterator has no leaf, even when the last element shares a leaf with it.
+      if ((index_-- & mask) == 0 || !chunk_) {
+        load();
+      }
+      return *this;
+    }
+
+    template<typename T, typename Allocator>
+    persistent_vector<T, Allocator>::builder::builder(const persistent_vector& source)
+        : elements_(source), editor_(detail::next_persistent_editor()) {
+    }
+
+    template<typename T, typename Allocator>
+    persistent_vector<T, Allocator>::builder::builder(builder&& other) noexcept
+        : elements_(std::move(other.elements_)),
+          editor_(std::exchange(other.editor_, detail::next_persistent_editor())) {
+    }
+
+    template<typename T, typename Allocator>
+    void persistent_vector<T, Allocator>::builder::push_back(const T& value) {
+      elements_.append_element(editor_, value);
+    }
+
+    template<typename T, typename Allocator>
+    void persistent_vector<T, Allocator>::builder::push_back(T&& value) {
+      elements_.append_element(editor_, std::move(value));
+    }
+
+    template<typename T, typename Allocator>
+    template<typename... Args>
+    void persistent_vector<T, Allocator>::builder::emplace_back(Args&&... args) {
+      elements_.append_element(editor_, std::forward<Args>(args)...);
+    }
+
+    template<typename T, typename Allocator>
+    void persistent_vector<T, Allocator>::builder::set(size_t index, const T& value) {
+      if (index >= size()) {
+        throw std::out_of_range("Index out of range");
+      }
+      elements_.assign_element(index, value, editor_);
+    }
+
+    template<typename T, typename Allocator>
+    void persistent_vector<T, Allocator>::builder::pop_back() {
+      elements_.remove_last(editor_);
+    }
+
+    template<typename T, typename Allocator>
+    persistent_vector<T, Allocator> persistent_vector<T, Allocator>::builder::persistent() {
+      // Retiring the id makes the nodes the version shares read-only to this builder.
+      editor_ = detail::next_persistent_editor();
+      return elements_;
+    }
+
+    template<typename T, typename Allocator>
+    persistent_vector<T, Allocator>::persistent_vector()
+        noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+        : size_(0), shift_(bits), root_(nullptr), tail_(nullptr) {
+    }
+
+    template<typename T, typename Allocator>
+    persistent_vector<T, Allocator>::persistent_vector(const Allocator& alloc) noexcept
+        : detail::allocator_holder<Allocator>(alloc), size_(0), shift_(bits), root_(nullptr), tail_(nullptr) {
+    }
+
+    template<typename T, typename Allocator>
+    persistent_vector<T, Allocator>::persistent_vector(std::initializer_list<T> init, const Allocator& alloc)
+        : persistent_vector(init.begin(), init.end(), alloc) {
+    }
+
+    template<typename T, typename Allocator>
+    template<typename InputIt, typename>
+    persistent_vector<T, Allocator>::persistent_vector(InputIt first, InputIt last, const Allocator& alloc)
+        : persistent_vector(alloc) {
+      builder edits(*this);
+      for (; first != last; ++first) {
+        edits.emplace_back(*first);
+      }
+      share(edits.persistent());
+    }
+
+    template<typename T, typename Allocator>
+    persistent_vector<T, Allocator>::persistent_vector(const persistent_vector& other) noexcept
+        : detail::allocator_holder<Allocator>(other.allocator()), size_(0), shift_(bits), root_(nullptr), tail_(nullptr) {
+      share(other);
+    }
+
+    template<typename T, typename Allocator>
+    persistent_vector<T, Allocator>& persistent_vector<T, Allocator>::operator=(const persistent_vector& other) {
+      if (this == &other) {
+        return *this;
+      }
+      if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+        reset();
+        allocator() = other.allocator();
+      } else if (allocator() != other.allocator()) {
+        // Nodes cannot be shared between unequal allocators, copy element-wise instead.
+        copy_elements(other);
+        return *this;
+      }
+      retain(other.root_);
+      retain(other.tail_);
+      reset();
+      size_ = other.size_;
+      shift_ = other.shift_;
+      root_ = other.root_;
+      tail_ = other.tail_;
+      return *this;
+    }
+
+    template<typename T, typename Allocator>
+    persistent_vector<T, Allocator>::persistent_vector(persistent_vector&& other) noexcept
+        : detail::allocator_holder<Allocator>(std::move(other.allocator())),
+          size_(std::exchange(other.size_, 0)),
+          shift_(std::exchange(other.shift_, bits)),
+          root_(std::exchange(other.root_, nullptr)),
+          tail_(std::exchange(other.tail_, nullptr)) {
+    }
+
+    template<typename T, typename Allocator>
+    persistent_vector<T, Allocator>& persistent_vector<T, Allocator>::operator=(persistent_vector&& other)
+        noexcept(alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value) {
+      if (this == &other) {
+        return *this;
+      }
+      if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+        reset();
+        allocator() = std::move(other.allocator());
+      } else if (allocator() != other.allocator()) {
+        // Nodes cannot change hands between unequal allocators, copy element-wise instead.
+        copy_elements(other);
+        return *this;
+      }
+      reset();
+      size_ = std::exchange(other.size_, 0);
+      shift_ = std::exchange(other.shift_, bits);
+      root_ = std::exchange(other.root_, nullptr);
+      tail_ = std::exchange(other.tail_, nullptr);
+      return *this;
+    }
+
+    template<typename T, typename Allocator>
+    persistent_vector<T, Allocator>::~persistent_vector() {
+      reset();
+    }
+
+    template<typename T, typename Allocator>
+    persistent_vector<T, Allocator> persistent_vector<T, Allocator>::push_back(const T& value) const {
+      persistent_vector result(*this);
+      result.append_element(no_editor, value);
+      return result;
+    }
+
+    template<typename T, typename Allocator>
+    persistent_vector<T, Allocator> persistent_vector<T, Allocator>::push_back(T&& value) const {
+      persistent_vector result(*this);
+      result.append_element(no_editor, std::move(value));
+      return result;
+    }
+
+    template<typename T, typename Allocator>
+    persistent_vector<T, Allocator> persistent_vector<T, Allocator>::set(size_t index, const T& value) const {
+      if (index >= size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      persistent_vector result(*this);
+      result.assign_element(index, value, no_editor);
+      return result;
+    }
+
+    template<typename T, typename Allocator>
+    persistent_vector<T, Allocator> persistent_vector<T, Allocator>::pop_back() const {
+      persistent_vector result(*this);
+      result.remove_last(no_editor);
+      return result;
+    }
+
+    template<typename T, typename Allocator>
+    typename persistent_vector<T, Allocator>::builder persistent_vector<T, Allocator>::transient() const {
+      return builder(*this);
+    }
+
+    template<typename T, typename Allocator>
+    const T& persistent_vector<T, Allocator>::operator[](size_t index) const noexcept {
+      return leaf_for(index)->values()[index & mask];
+    }
+
+    template<typename T, typename Allocator>
+    const T& persistent_vector<T, Allocator>::at(size_t index) const {
+      if (index >= size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      return (*this)[index];
+    }
+
+    template<typename T, typename Allocator>
+    const T& persistent_vector<T, Allocator>::front() const {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      return (*this)[0];
+    }
+
+    template<typename T, typename Allocator>
+    const T& persistent_vector<T, Allocator>::back() const {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      return tail_->values()[tail_->count - 1];
+    }
+
+    template<typename T, typename Allocator>
+    size_t persistent_vector<T, Allocator>::chunk_count() const noexcept {
+      return (size_ + mask) >> bits;
+    }
+
+    template<typename T, typename Allocator>
+    span<const T> persistent_vector<T, Allocator>::chunk(size_t chunk) const noexcept {
+      const leaf_node* leaf = leaf_for(chunk << bits);
+      return span<const T>(leaf->values(), leaf->count);
+    }
+
+    template<typename T, typename Allocator>
+    template<typename F>
+    void persistent_vector<T, Allocator>::for_each_chunk(F f) const {
+      if (root_) {
+        visit_leaves(root_, shift_, f);
+      }
+      if (tail_) {
+        visit_leaves(tail_, 0, f);
+      }
+    }
+
+    template<typename T, typename Allocator>
+    typename persistent_vector<T, Allocator>::const_iterator persistent_vector<T, Allocator>::begin() const noexcept {
+      return const_iterator(this, 0);
+    }
+
+    template<typename T, typename Allocator>
+    typename persistent_vector<T, Allocator>::const_iterator persistent_vector<T, Allocator>::end() const noexcept {
+      return const_iterator(this, size_);
+    }
+
+    template<typename T, typename Allocator>
+    typename persistent_vector<T, Allocator>::const_iterator persistent_vector<T, Allocator>::cbegin() const noexcept {
+      return begin();
+    }
+
+    template<typename T, typename Allocator>
+    typename persistent_vector<T, Allocator>::const_iterator persistent_vector<T, Allocator>::cend() const noexcept {
+      return end();
+    }
+
+    template<typename T, typename Allocator>
+    size_t persistent_vector<T, Allocator>::size() const noexcept {
+      return size_;
+    }
+
+    template<typename T, typename Allocator>
+    void persistent_vector<T, Allocator>::swap(persistent_vector& other) noexcept {
+      if constexpr (alloc_traits::propagate_on_container_swap::value) {
+        using std::swap;
+        swap(allocator(), other.allocator());
+      }
+      std::swap(size_, other.size_);
+      std::swap(shift_, other.shift_);
+      std::swap(root_, other.root_);
+      std::swap(tail_, other.tail_);
+    }
+
+    template<typename T, typename Allocator>
+    typename persistent_vector<T, Allocator>::allocator_type persistent_vector<T, Allocator>::get_allocator() const noexcept {
+      return allocator();
+    }
+
+} // namespace my_vector
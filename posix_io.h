@@ -0,0 +1,121 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_POSIX_IO_H
+#define VECTOR_POSIX_IO_H
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace my_vector {
+
+    namespace detail {
+
+    /**
+     * @brief Throws std::system_error for the current errno.
+     *
+     * @param what The failing call, prefixed with the component, e.g. "mmap_vector: mmap".
+     */
+    [[noreturn]] inline void throw_errno(const char* what) {
+      throw std::system_error(errno, std::generic_category(), what);
+    }
+
+    /**
+     * @brief Writes every byte described by iov, repeating writev until the kernel took it all.
+     *
+     * Retries on EINTR and advances past partially written buffers. The entries of iov are
+     * modified.
+     *
+     * @param fd The file descriptor to write to.
+     * @param iov The buffers to write.
+     * @param count The number of buffers.
+     * @throws std::system_error if writev fails.
+     */
+    inline void write_all(int fd, iovec* iov, int count) {
+      while (count > 0) {
+        const ssize_t written = ::writev(fd, iov, count);
+        if (written < 0) {
+          if (errno == EINTR) {
+            continue;
+          }
+          throw_errno("writev");
+        }
+        size_t left = static_cast<size_t>(written);
+        while (count > 0 && left >= iov->iov_len) {
+          left -= iov->iov_len;
+          ++iov;
+          --count;
+        }
+        if (count > 0) {
+          iov->iov_base = static_cast<char*>(iov->iov_base) + left;
+          iov->iov_len -= left;
+        }
+      }
+    }
+
+    /**
+     * @brief Reads exactly length bytes, or fewer only at end of file.
+     *
+     * @param fd The file descriptor to read from.
+     * @param data The destination.
+     * @param length The number of bytes to read.
+     * @param offset The file offset to read at, or -1 to read at the current offset.
+     * @return The number of bytes read, less than length only if the file ended.
+     * @throws std::system_error if read fails.
+     */
+    inline size_t read_all(int fd, void* data, size_t length, off_t offset = -1) {
+      size_t done = 0;
+      while (done < length) {
+        void* dest = static_cast<char*>(data) + done;
+        const ssize_t got = offset < 0 ? ::read(fd, dest, length - done)
+                                       : ::pread(fd, dest, length - done, offset + static_cast<off_t>(done));
+        if (got < 0) {
+          if (errno == EINTR) {
+            continue;
+          }
+          throw_errno("read");
+        }
+        if (got == 0) {
+          break;
+        }
+        done += static_cast<size_t>(got);
+      }
+      return done;
+    }
+
+    /**
+     * @brief Writes length bytes at the given file offset, repeating pwrite until all are written.
+     *
+     * @param fd The file descriptor to write to.
+     * @param data The bytes to write.
+     * @param length The number of bytes.
+     * @param offset The file offset to write at.
+     * @throws std::system_error if pwrite fails.
+     */
+    inline void write_all_at(int fd, const void* data, size_t length, off_t offset) {
+      size_t done = 0;
+      while (done < length) {
+        const ssize_t written = ::pwrite(fd, static_cast<const char*>(data) + done, length - done,
+                                         offset + static_cast<off_t>(done));
+        if (written < 0) {
+          if (errno == EINTR) {
+            continue;
+          }
+          throw_errno("pwrite");
+        }
+        done += static_cast<size_t>(written);
+      }
+    }
+
+    } // namespace detail
+
+} // namespace my_vector
+
+#endif //VECTOR_POSIX_IO_H
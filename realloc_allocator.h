@@ -0,0 +1,196 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_REALLOC_ALLOCATOR_H
+#define VECTOR_REALLOC_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <malloc.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <malloc.h>
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#endif
+
+namespace my_vector {
+
+/**
+ * @brief Allocator that can grow a block in place.
+ *
+ * Small blocks come from malloc and are grown with realloc. On Linux, blocks of at least
+ * MmapThreshold bytes are mapped directly with mmap and grown with mremap(MREMAP_MAYMOVE).
+ * The kernel can then extend the mapping or move its pages instead of copying them. This
+ * avoids the temporary doubling of memory use that an allocate-copy-free cycle causes.
+ *
+ * vector uses reallocate() whenever it is available and the element type is trivially
+ * relocatable. Other element types still go through allocate/relocate/deallocate.
+ *
+ * @tparam T The type of elements to allocate.
+ * @tparam MmapThreshold Block size in bytes from which storage is mapped with mmap.
+ */
+    template<typename T, size_t MmapThreshold = size_t(1) << 20>
+    class realloc_allocator {
+    public:
+        using value_type = T;
+        using is_always_equal = std::true_type;
+
+        template<typename U>
+        struct rebind {
+            using other = realloc_allocator<U, MmapThreshold>;
+        };
+
+        realloc_allocator() noexcept = default;
+
+        template<typename U>
+        realloc_allocator(const realloc_allocator<U, MmapThreshold>&) noexcept {}
+
+        /**
+         * @brief Allocates uninitialized storage for n elements.
+         *
+         * @param n The number of elements.
+         * @return A pointer to the storage.
+         * @throws std::bad_alloc if the storage cannot be obtained.
+         */
+        T* allocate(size_t n) {
+          if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+            throw std::bad_alloc();
+          }
+          void* p = raw_allocate(n * sizeof(T));
+          if (!p) {
+            throw std::bad_alloc();
+          }
+          return static_cast<T*>(p);
+        }
+
+        /**
+         * @brief Releases storage obtained from allocate() or reallocate().
+         *
+         * @param p The storage to release.
+         * @param n The number of elements it was allocated for.
+         */
+        void deallocate(T* p, size_t n) noexcept {
+          raw_deallocate(p, n * sizeof(T));
+        }
+
+        /**
+         * @brief Resizes a block, preserving its first min(old_n, new_n) elements bytewise.
+         *
+         * Only meaningful for trivially relocatable T, since the block may move without
+         * running constructors. On failure the original block is left untouched.
+         *
+         * @param p The block to resize.
+         * @param old_n The number of elements the block was allocated for.
+         * @param new_n The number of elements to resize to.
+         * @return A pointer to the resized block, which may differ from p.
+         * @throws std::bad_alloc if the storage cannot be obtained.
+         */
+        T* reallocate(T* p, size_t old_n, size_t new_n) {
+          if (new_n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+            throw std::bad_alloc();
+          }
+          const size_t old_bytes = old_n * sizeof(T);
+          const size_t new_bytes = new_n * sizeof(T);
+          void* result;
+#if defined(__linux__)
+          if (is_mapped(old_bytes) && is_mapped(new_bytes)) {
+            result = ::mremap(p, page_round(old_bytes), page_round(new_bytes), MREMAP_MAYMOVE);
+            if (result == MAP_FAILED) {
+              result = nullptr;
+            }
+          } else if (is_mapped(old_bytes) || is_mapped(new_bytes)) {
+            // Crossing the threshold changes the backing, so this one transition copies.
+            result = raw_allocate(new_bytes);
+            if (result) {
+              std::memcpy(result, p, old_bytes < new_bytes ? old_bytes : new_bytes);
+              raw_deallocate(p, old_bytes);
+            }
+          } else
+#endif
+          {
+            result = std::realloc(p, new_bytes ? new_bytes : 1);
+          }
+          if (!result) {
+            throw std::bad_alloc();
+          }
+          return static_cast<T*>(result);
+        }
+
+        /**
+         * @brief Returns how many elements a block can really hold.
+         *
+         * Counts malloc's size-class slack (malloc_usable_size, _msize or malloc_size) and the
+         * page rounding of mapped blocks. size_class_growth uses this to raise capacity().
+         *
+         * @param p A block obtained from this allocator.
+         * @param n The number of elements the block was requested for.
+         * @return The number of elements that fit in the block, at least n.
+         */
+        size_t usable_size(T* p, size_t n) const noexcept {
+          size_t bytes = n * sizeof(T);
+#if defined(__linux__)
+          if (is_mapped(bytes)) {
+            return page_round(bytes) / sizeof(T);
+          }
+          bytes = ::malloc_usable_size(p);
+          // Stay below the threshold so that deallocate() still recognizes a malloc block.
+          bytes = bytes < MmapThreshold ? bytes : MmapThreshold - 1;
+#elif defined(_WIN32)
+          bytes = ::_msize(p);
+#elif defined(__APPLE__)
+          bytes = ::malloc_size(p);
+#endif
+          return bytes / sizeof(T) > n ? bytes / sizeof(T) : n;
+        }
+
+        template<typename U>
+        bool operator==(const realloc_allocator<U, MmapThreshold>&) const noexcept { return true; }
+
+        template<typename U>
+        bool operator!=(const realloc_allocator<U, MmapThreshold>&) const noexcept { return false; }
+
+    private:
+#if defined(__linux__)
+        static bool is_mapped(size_t bytes) noexcept {
+          return bytes >= MmapThreshold;
+        }
+
+        static size_t page_round(size_t bytes) noexcept {
+          static const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+          return (bytes + page - 1) & ~(page - 1);
+        }
+#endif
+
+        static void* raw_allocate(size_t bytes) noexcept {
+#if defined(__linux__)
+          if (is_mapped(bytes)) {
+            void* p = ::mmap(nullptr, page_round(bytes), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            return p == MAP_FAILED ? nullptr : p;
+          }
+#endif
+          return std::malloc(bytes ? bytes : 1);
+        }
+
+        static void raw_deallocate(void* p, size_t bytes) noexcept {
+#if defined(__linux__)
+          if (is_mapped(bytes)) {
+            ::munmap(p, page_round(bytes));
+            return;
+          }
+#endif
+          std::free(p);
+        }
+    };
+
+} // namespace my_vector
+
+#endif //VECTOR_REALLOC_ALLOCATOR_H
@@ -0,0 +1,160 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_RELOCATION_H
+#define VECTOR_RELOCATION_H
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace my_vector {
+
+/**
+ * @brief Trait telling the containers that objects of type T may be relocated with memcpy.
+ *
+ * Relocation means move-constructing an object at a new address and destroying the
+ * original. For a trivially relocatable type this pair is equivalent to copying its bytes
+ * and forgetting the source. Every trivially copyable type qualifies automatically.
+ * Other types can opt in with a specialization, as long as they hold no pointers into
+ * themselves:
+ *
+ * @code
+ * template<>
+ * struct my_vector::is_trivially_relocatable<handle> : std::true_type {};
+ * @endcode
+ *
+ * @tparam T The type to query.
+ */
+    template<typename T>
+    struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+    template<typename T>
+    inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+    namespace detail {
+
+    /**
+     * @brief True if relocating a T can never throw, so a half-done relocation never has to be undone.
+     */
+    template<typename T>
+    inline constexpr bool is_nothrow_relocatable_v =
+        is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible<T>::value;
+
+    /**
+     * @brief Detects allocators that can resize a block in place through reallocate(p, old_n, new_n).
+     *
+     * Such a resize moves bytes without running constructors, so it is only used for
+     * trivially relocatable element types.
+     */
+    template<typename Allocator, typename T, typename = void>
+    struct can_reallocate : std::false_type {};
+
+    template<typename Allocator, typename T>
+    struct can_reallocate<Allocator, T, std::void_t<decltype(std::declval<Allocator&>().reallocate(
+        std::declval<T*>(), std::declval<size_t>(), std::declval<size_t>()))>>
+        : std::bool_constant<is_trivially_relocatable_v<T>> {};
+
+    /**
+     * @brief Relocates count elements from first into the uninitialized storage at dest,
+     * leaving a gap of gap_size slots before the element with index gap_index.
+     *
+     * Trivially relocatable types are moved with at most two memcpy calls. Other types are
+     * moved with move_if_noexcept semantics. If a copy throws, the elements already built at
+     * dest are destroyed, the source is left intact, and the exception is rethrown. The gap
+     * is not touched, so the caller can construct new elements there before or after.
+     *
+     * @param alloc The allocator used to construct and destroy elements.
+     * @param first The first element to relocate.
+     * @param count The number of elements to relocate.
+     * @param dest Uninitialized storage for at least count + gap_size elements.
+     * @param gap_index The index of the first source element placed after the gap.
+     * @param gap_size The number of slots to leave free.
+     */
+    template<typename Allocator, typename T>
+    void relocate_with_gap(Allocator& alloc, T* first, size_t count, T* dest, size_t gap_index, size_t gap_size) {
+      using alloc_traits = std::allocator_traits<Allocator>;
+      if constexpr (is_trivially_relocatable_v<T>) {
+        if (gap_index) {
+          std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), gap_index * sizeof(T));
+        }
+        if (count > gap_index) {
+          std::memcpy(static_cast<void*>(dest + gap_index + gap_size), static_cast<const void*>(first + gap_index),
+                      (count - gap_index) * sizeof(T));
+        }
+      } else {
+        size_t built = 0;
+        try {
+          for (; built < count; ++built) {
+            T* target = &dest[built < gap_index ? built : built + gap_size];
+            alloc_traits::construct(alloc, target, std::move_if_noexcept(first[built]));
+          }
+        } catch (...) {
+          for (size_t i = 0; i < built; ++i) {
+            alloc_traits::destroy(alloc, &dest[i < gap_index ? i : i + gap_size]);
+          }
+          throw;
+        }
+        for (size_t i = 0; i < count; ++i) {
+          alloc_traits::destroy(alloc, &first[i]);
+        }
+      }
+    }
+
+    /**
+     * @brief Relocates count elements from first into the uninitialized storage at dest.
+     *
+     * Same as relocate_with_gap without a gap: a single memcpy for trivially relocatable
+     * types, move_if_noexcept with rollback for all others.
+     *
+     * @param alloc The allocator used to construct and destroy elements.
+     * @param first The first element to relocate.
+     * @param count The number of elements to relocate.
+     * @param dest Uninitialized storage for at least count elements.
+     */
+    template<typename Allocator, typename T>
+    void relocate(Allocator& alloc, T* first, size_t count, T* dest) {
+      relocate_with_gap(alloc, first, count, dest, count, 0);
+    }
+
+    /**
+     * @brief Relocates count elements to dest, where the source and destination ranges may overlap.
+     *
+     * Used to shift elements within a single buffer. Requires is_nothrow_relocatable_v<T>.
+     *
+     * @param alloc The allocator used to construct and destroy elements.
+     * @param first The first element to relocate.
+     * @param count The number of elements to relocate.
+     * @param dest The new position of the first element.
+     */
+    template<typename Allocator, typename T>
+    void relocate_within(Allocator& alloc, T* first, size_t count, T* dest) noexcept {
+      static_assert(is_nothrow_relocatable_v<T>, "relocate_within requires a nothrow relocatable type");
+      using alloc_traits = std::allocator_traits<Allocator>;
+      if (first == dest || count == 0) {
+        return;
+      }
+      if constexpr (is_trivially_relocatable_v<T>) {
+        std::memmove(static_cast<void*>(dest), static_cast<const void*>(first), count * sizeof(T));
+      } else if (dest < first) {
+        // Every target slot is either uninitialized or an already relocated source.
+        for (size_t i = 0; i < count; ++i) {
+          alloc_traits::construct(alloc, &dest[i], std::move(first[i]));
+          alloc_traits::destroy(alloc, &first[i]);
+        }
+      } else {
+        for (size_t i = count; i > 0; --i) {
+          alloc_traits::construct(alloc, &dest[i - 1], std::move(first[i - 1]));
+          alloc_traits::destroy(alloc, &first[i - 1]);
+        }
+      }
+    }
+
+    } // namespace detail
+
+} // namespace my_vector
+
+#endif //VECTOR_RELOCATION_H
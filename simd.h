@@ -0,0 +1,194 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_SIMD_H
+#define VECTOR_SIMD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * SIMD kernels are compiled with per-function target attributes and selected at run time,
+ * so the library itself needs no -mavx2 or similar flags. Define MY_VECTOR_DISABLE_SIMD to
+ * force the scalar fallbacks everywhere.
+ */
+#if !defined(MY_VECTOR_DISABLE_SIMD) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define MY_VECTOR_SIMD_X86 1
+#include <immintrin.h>
+#define MY_VECTOR_TARGET_SSE2 __attribute__((target("sse2")))
+#define MY_VECTOR_TARGET_AVX2 __attribute__((target("avx2")))
+#define MY_VECTOR_TARGET_AVX512 __attribute__((target("avx512f")))
+#endif
+
+namespace my_vector {
+
+    namespace detail {
+
+    namespace simd {
+
+    /**
+     * @brief Instruction set levels the kernels are specialized for.
+     */
+    enum class isa {
+        scalar,
+        sse2,
+        avx2,
+        avx512
+    };
+
+    /**
+     * @brief Queries CPUID for the best supported instruction set.
+     *
+     * @return The highest isa level the running CPU supports.
+     */
+    inline isa detect_isa() noexcept {
+#if defined(MY_VECTOR_SIMD_X86)
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx512f")) {
+        return isa::avx512;
+      }
+      if (__builtin_cpu_supports("avx2")) {
+        return isa::avx2;
+      }
+      if (__builtin_cpu_supports("sse2")) {
+        return isa::sse2;
+      }
+#endif
+      return isa::scalar;
+    }
+
+    /**
+     * @brief Returns the instruction set level detected on first use.
+     */
+    inline isa current_isa() noexcept {
+      static const isa level = detect_isa();
+      return level;
+    }
+
+    /**
+     * @brief Lane permutations for stream compaction.
+     *
+     * For every keep-mask, the indices of the kept lanes packed as nibbles, lowest lane first,
+     * in the form _mm256_permutevar8x32_epi32 expects. lanes32 covers eight 32-bit lanes;
+     * lanes64 covers four 64-bit lanes, each expressed as a pair of 32-bit lanes.
+     */
+    struct compaction_table {
+        uint32_t lanes32[256];
+        uint32_t lanes64[16];
+    };
+
+    constexpr compaction_table make_compaction_table() noexcept {
+      compaction_table table{};
+      for (uint32_t mask = 0; mask < 256; ++mask) {
+        uint32_t packed = 0;
+        uint32_t slot = 0;
+        for (uint32_t lane = 0; lane < 8; ++lane) {
+          if (mask & (1u << lane)) {
+            packed |= lane << (4 * slot++);
+          }
+        }
+        table.lanes32[mask] = packed;
+      }
+      for (uint32_t mask = 0; mask < 16; ++mask) {
+        uint32_t packed = 0;
+        uint32_t slot = 0;
+        for (uint32_t lane = 0; lane < 4; ++lane) {
+          if (mask & (1u << lane)) {
+            packed |= (2 * lane) << (4 * slot++);
+            packed |= (2 * lane + 1) << (4 * slot++);
+          }
+        }
+        table.lanes64[mask] = packed;
+      }
+      return table;
+    }
+
+    inline constexpr compaction_table compaction_lut = make_compaction_table();
+
+    /**
+     * @brief Removes the elements matching pred, keeping the order of the others. Scalar version.
+     *
+     * Branch-free: every element is written to the output slot and the slot only advances
+     * when the element is kept.
+     *
+     * @return The number of elements kept, which now occupy [data, data + kept).
+     */
+    template<typename T, typename Pred>
+    size_t compact_if_scalar(T* data, size_t n, Pred& pred) {
+      size_t out = 0;
+      for (size_t i = 0; i < n; ++i) {
+        const T value = data[i];
+        data[out] = value;
+        out += !pred(value);
+      }
+      return out;
+    }
+
+#if defined(MY_VECTOR_SIMD_X86)
+    /**
+     * @brief AVX2 version of compact_if_scalar for 4- and 8-byte elements.
+     *
+     * The predicate is evaluated per element into a keep-mask. Each block of 32 bytes is
+     * then packed with one permute and written with a single unaligned store. The output
+     * never passes the block being read, so the store only overwrites consumed elements.
+     */
+    template<typename T, typename Pred>
+    MY_VECTOR_TARGET_AVX2 size_t compact_if_avx2(T* data, size_t n, Pred& pred) {
+      constexpr size_t lanes = 32 / sizeof(T);
+      const __m256i shifts = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+      size_t out = 0;
+      size_t i = 0;
+      for (; i + lanes <= n; i += lanes) {
+        uint32_t keep = 0;
+        for (size_t lane = 0; lane < lanes; ++lane) {
+          keep |= static_cast<uint32_t>(!pred(data[i + lane])) << lane;
+        }
+        const uint32_t packed = sizeof(T) == 4 ? compaction_lut.lanes32[keep] : compaction_lut.lanes64[keep];
+        const __m256i index = _mm256_srlv_epi32(_mm256_set1_epi32(static_cast<int>(packed)), shifts);
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + out), _mm256_permutevar8x32_epi32(block, index));
+        out += static_cast<size_t>(__builtin_popcount(keep));
+      }
+      for (; i < n; ++i) {
+        const T value = data[i];
+        data[out] = value;
+        out += !pred(value);
+      }
+      return out;
+    }
+#endif
+
+    /**
+     * @brief Removes the elements matching pred in a single pass, keeping the order of the others.
+     *
+     * Uses the AVX2 kernel for 4- and 8-byte elements when the CPU has AVX2, and the
+     * branch-free scalar loop otherwise.
+     *
+     * @param data The elements to compact.
+     * @param n The number of elements.
+     * @param pred Returns true for the elements to remove.
+     * @return The number of elements kept, which now occupy [data, data + kept).
+     */
+    template<typename T, typename Pred>
+    size_t compact_if(T* data, size_t n, Pred& pred) {
+      static_assert(std::is_arithmetic<T>::value, "compact_if is meant for arithmetic elements");
+#if defined(MY_VECTOR_SIMD_X86)
+      if constexpr (sizeof(T) == 4 || sizeof(T) == 8) {
+        if (current_isa() >= isa::avx2) {
+          return compact_if_avx2(data, n, pred);
+        }
+      }
+#endif
+      return compact_if_scalar(data, n, pred);
+    }
+
+    } // namespace simd
+
+    } // namespace detail
+
+} // namespace my_vector
+
+#endif //VECTOR_SIMD_H
@@ -0,0 +1,503 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_SIMD_KERNELS_H
+#define VECTOR_SIMD_KERNELS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "simd.h"
+
+namespace my_vector {
+
+    namespace detail {
+
+    namespace simd {
+
+    /**
+     * @brief The type sum() accumulates in: 64-bit for integers, T itself for floating point.
+     */
+    template<typename T>
+    using sum_t = std::conditional_t<std::is_floating_point<T>::value, T,
+        std::conditional_t<std::is_signed<T>::value, int64_t, uint64_t>>;
+
+    /**
+     * @brief True for the element types that have vectorized kernels.
+     */
+    template<typename T>
+    inline constexpr bool has_kernels = std::is_same<T, int32_t>::value || std::is_same<T, int64_t>::value
+                                        || std::is_same<T, float>::value || std::is_same<T, double>::value;
+
+    namespace scalar {
+
+    template<typename T>
+    size_t find(const T* data, size_t n, const T& value) {
+      for (size_t i = 0; i < n; ++i) {
+        if (data[i] == value) {
+          return i;
+        }
+      }
+      return n;
+    }
+
+    template<typename T>
+    size_t count(const T* data, size_t n, const T& value) {
+      size_t total = 0;
+      for (size_t i = 0; i < n; ++i) {
+        total += data[i] == value;
+      }
+      return total;
+    }
+
+    template<typename T>
+    sum_t<T> sum(const T* data, size_t n) {
+      sum_t<T> total = 0;
+      for (size_t i = 0; i < n; ++i) {
+        total += data[i];
+      }
+      return total;
+    }
+
+    template<typename T>
+    T min(const T* data, size_t n) {
+      T best = data[0];
+      for (size_t i = 1; i < n; ++i) {
+        best = data[i] < best ? data[i] : best;
+      }
+      return best;
+    }
+
+    template<typename T>
+    T max(const T* data, size_t n) {
+      T best = data[0];
+      for (size_t i = 1; i < n; ++i) {
+        best = best < data[i] ? data[i] : best;
+      }
+      return best;
+    }
+
+    template<typename T>
+    std::pair<T, T> minmax(const T* data, size_t n) {
+      T low = data[0];
+      T high = data[0];
+      for (size_t i = 1; i < n; ++i) {
+        low = data[i] < low ? data[i] : low;
+        high = high < data[i] ? data[i] : high;
+      }
+      return {low, high};
+    }
+
+    template<typename T>
+    void fill(T* data, size_t n, const T& value) {
+      std::fill(data, data + n, value);
+    }
+
+    } // namespace scalar
+
+#if defined(MY_VECTOR_SIMD_X86)
+    /**
+     * Each instruction set below describes its registers with an ops<T> specialization per
+     * element type: lanes, aligned load and store, broadcast, an equality bitmask, lane-wise
+     * min and max, and a sum accumulator that may be wider than T. ordered is false where the
+     * set lacks a cheap 64-bit compare, and min/max then stay scalar.
+     */
+    namespace sse2 {
+
+    template<typename T>
+    struct ops;
+
+    template<>
+    struct ops<int32_t> {
+        using reg = __m128i;
+        using acc = __m128i;
+        static constexpr size_t lanes = 4;
+        static constexpr bool ordered = true;
+
+        static MY_VECTOR_TARGET_SSE2 reg load(const int32_t* p) { return _mm_load_si128(reinterpret_cast<const __m128i*>(p)); }
+        static MY_VECTOR_TARGET_SSE2 void store(int32_t* p, reg v) { _mm_store_si128(reinterpret_cast<__m128i*>(p), v); }
+        static MY_VECTOR_TARGET_SSE2 reg set1(int32_t value) { return _mm_set1_epi32(value); }
+        static MY_VECTOR_TARGET_SSE2 uint32_t eq_mask(reg a, reg b) {
+          return static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))));
+        }
+        static MY_VECTOR_TARGET_SSE2 reg min(reg a, reg b) {
+          const reg greater = _mm_cmpgt_epi32(a, b);
+          return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+        }
+        static MY_VECTOR_TARGET_SSE2 reg max(reg a, reg b) {
+          const reg greater = _mm_cmpgt_epi32(a, b);
+          return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+        }
+        static MY_VECTOR_TARGET_SSE2 acc acc_zero() { return _mm_setzero_si128(); }
+        static MY_VECTOR_TARGET_SSE2 acc acc_add(acc total, reg v) {
+          // Sign-extend to 64 bits so that large sums cannot overflow.
+          const reg sign = _mm_cmpgt_epi32(_mm_setzero_si128(), v);
+          return _mm_add_epi64(total, _mm_add_epi64(_mm_unpacklo_epi32(v, sign), _mm_unpackhi_epi32(v, sign)));
+        }
+        static MY_VECTOR_TARGET_SSE2 acc acc_merge(acc a, acc b) { return _mm_add_epi64(a, b); }
+        static MY_VECTOR_TARGET_SSE2 void acc_store(int64_t* p, acc v) { _mm_store_si128(reinterpret_cast<__m128i*>(p), v); }
+    };
+
+    template<>
+    struct ops<int64_t> {
+        using reg = __m128i;
+        using acc = __m128i;
+        static constexpr size_t lanes = 2;
+        static constexpr bool ordered = false;
+
+        static MY_VECTOR_TARGET_SSE2 reg load(const int64_t* p) { return _mm_load_si128(reinterpret_cast<const __m128i*>(p)); }
+        static MY_VECTOR_TARGET_SSE2 void store(int64_t* p, reg v) { _mm_store_si128(reinterpret_cast<__m128i*>(p), v); }
+        static MY_VECTOR_TARGET_SSE2 reg set1(int64_t value) { return _mm_set1_epi64x(value); }
+        static MY_VECTOR_TARGET_SSE2 uint32_t eq_mask(reg a, reg b) {
+          // A 64-bit lane is equal when both of its 32-bit halves are.
+          const reg halves = _mm_cmpeq_epi32(a, b);
+          const reg both = _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+          return static_cast<uint32_t>(_mm_movemask_pd(_mm_castsi128_pd(both)));
+        }
+        static MY_VECTOR_TARGET_SSE2 acc acc_zero() { return _mm_setzero_si128(); }
+        static MY_VECTOR_TARGET_SSE2 acc acc_add(acc total, reg v) { return _mm_add_epi64(total, v); }
+        static MY_VECTOR_TARGET_SSE2 acc acc_merge(acc a, acc b) { return _mm_add_epi64(a, b); }
+        static MY_VECTOR_TARGET_SSE2 void acc_store(int64_t* p, acc v) { _mm_store_si128(reinterpret_cast<__m128i*>(p), v); }
+    };
+
+    template<>
+    struct ops<float> {
+        using reg = __m128;
+        using acc = __m128;
+        static constexpr size_t lanes = 4;
+        static constexpr bool ordered = true;
+
+        static MY_VECTOR_TARGET_SSE2 reg load(const float* p) { return _mm_load_ps(p); }
+        static MY_VECTOR_TARGET_SSE2 void store(float* p, reg v) { _mm_store_ps(p, v); }
+        static MY_VECTOR_TARGET_SSE2 reg set1(float value) { return _mm_set1_ps(value); }
+        static MY_VECTOR_TARGET_SSE2 uint32_t eq_mask(reg a, reg b) { return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmpeq_ps(a, b))); }
+        static MY_VECTOR_TARGET_SSE2 reg min(reg a, reg b) { return _mm_min_ps(a, b); }
+        static MY_VECTOR_TARGET_SSE2 reg max(reg a, reg b) { return _mm_max_ps(a, b); }
+        static MY_VECTOR_TARGET_SSE2 acc acc_zero() { return _mm_setzero_ps(); }
+        static MY_VECTOR_TARGET_SSE2 acc acc_add(acc total, reg v) { return _mm_add_ps(total, v); }
+        static MY_VECTOR_TARGET_SSE2 acc acc_merge(acc a, acc b) { return _mm_add_ps(a, b); }
+        static MY_VECTOR_TARGET_SSE2 void acc_store(float* p, acc v) { _mm_store_ps(p, v); }
+    };
+
+    template<>
+    struct ops<double> {
+        using reg = __m128d;
+        using acc = __m128d;
+        static constexpr size_t lanes = 2;
+        static constexpr bool ordered = true;
+
+        static MY_VECTOR_TARGET_SSE2 reg load(const double* p) { return _mm_load_pd(p); }
+        static MY_VECTOR_TARGET_SSE2 void store(double* p, reg v) { _mm_store_pd(p, v); }
+        static MY_VECTOR_TARGET_SSE2 reg set1(double value) { return _mm_set1_pd(value); }
+        static MY_VECTOR_TARGET_SSE2 uint32_t eq_mask(reg a, reg b) { return static_cast<uint32_t>(_mm_movemask_pd(_mm_cmpeq_pd(a, b))); }
+        static MY_VECTOR_TARGET_SSE2 reg min(reg a, reg b) { return _mm_min_pd(a, b); }
+        static MY_VECTOR_TARGET_SSE2 reg max(reg a, reg b) { return _mm_max_pd(a, b); }
+        static MY_VECTOR_TARGET_SSE2 acc acc_zero() { return _mm_setzero_pd(); }
+        static MY_VECTOR_TARGET_SSE2 acc acc_add(acc total, reg v) { return _mm_add_pd(total, v); }
+        static MY_VECTOR_TARGET_SSE2 acc acc_merge(acc a, acc b) { return _mm_add_pd(a, b); }
+        static MY_VECTOR_TARGET_SSE2 void acc_store(double* p, acc v) { _mm_store_pd(p, v); }
+    };
+
+#define MY_VECTOR_KERNEL_TARGET MY_VECTOR_TARGET_SSE2
+#include "simd_kernels_impl.h"
+#undef MY_VECTOR_KERNEL_TARGET
+
+    } // namespace sse2
+
+    namespace avx2 {
+
+    template<typename T>
+    struct ops;
+
+    template<>
+    struct ops<int32_t> {
+        using reg = __m256i;
+        using acc = __m256i;
+        static constexpr size_t lanes = 8;
+        static constexpr bool ordered = true;
+
+        static MY_VECTOR_TARGET_AVX2 reg load(const int32_t* p) { return _mm256_load_si256(reinterpret_cast<const __m256i*>(p)); }
+        static MY_VECTOR_TARGET_AVX2 void store(int32_t* p, reg v) { _mm256_store_si256(reinterpret_cast<__m256i*>(p), v); }
+        static MY_VECTOR_TARGET_AVX2 reg set1(int32_t value) { return _mm256_set1_epi32(value); }
+        static MY_VECTOR_TARGET_AVX2 uint32_t eq_mask(reg a, reg b) {
+          return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))));
+        }
+        static MY_VECTOR_TARGET_AVX2 reg min(reg a, reg b) { return _mm256_min_epi32(a, b); }
+        static MY_VECTOR_TARGET_AVX2 reg max(reg a, reg b) { return _mm256_max_epi32(a, b); }
+        static MY_VECTOR_TARGET_AVX2 acc acc_zero() { return _mm256_setzero_si256(); }
+        static MY_VECTOR_TARGET_AVX2 acc acc_add(acc total, reg v) {
+          const acc low = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v));
+          const acc high = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1));
+          return _mm256_add_epi64(total, _mm256_add_epi64(low, high));
+        }
+        static MY_VECTOR_TARGET_AVX2 acc acc_merge(acc a, acc b) { return _mm256_add_epi64(a, b); }
+        static MY_VECTOR_TARGET_AVX2 void acc_store(int64_t* p, acc v) { _mm256_store_si256(reinterpret_cast<__m256i*>(p), v); }
+    };
+
+    template<>
+    struct ops<int64_t> {
+        using reg = __m256i;
+        using acc = __m256i;
+        static constexpr size_t lanes = 4;
+        static constexpr bool ordered = true;
+
+        static MY_VECTOR_TARGET_AVX2 reg load(const int64_t* p) { return _mm256_load_si256(reinterpret_cast<const __m256i*>(p)); }
+        static MY_VECTOR_TARGET_AVX2 void store(int64_t* p, reg v) { _mm256_store_si256(reinterpret_cast<__m256i*>(p), v); }
+        static MY_VECTOR_TARGET_AVX2 reg set1(int64_t value) { return _mm256_set1_epi64x(value); }
+        static MY_VECTOR_TARGET_AVX2 uint32_t eq_mask(reg a, reg b) {
+          return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b))));
+        }
+        static MY_VECTOR_TARGET_AVX2 reg min(reg a, reg b) { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+        static MY_VECTOR_TARGET_AVX2 reg max(reg a, reg b) { return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b)); }
+        static MY_VECTOR_TARGET_AVX2 acc acc_zero() { return _mm256_setzero_si256(); }
+        static MY_VECTOR_TARGET_AVX2 acc acc_add(acc total, reg v) { return _mm256_add_epi64(total, v); }
+        static MY_VECTOR_TARGET_AVX2 acc acc_merge(acc a, acc b) { return _mm256_add_epi64(a, b); }
+        static MY_VECTOR_TARGET_AVX2 void acc_store(int64_t* p, acc v) { _mm256_store_si256(reinterpret_cast<__m256i*>(p), v); }
+    };
+
+    template<>
+    struct ops<float> {
+        using reg = __m256;
+        using acc = __m256;
+        static constexpr size_t lanes = 8;
+        static constexpr bool ordered = true;
+
+        static MY_VECTOR_TARGET_AVX2 reg load(const float* p) { return _mm256_load_ps(p); }
+        static MY_VECTOR_TARGET_AVX2 void store(float* p, reg v) { _mm256_store_ps(p, v); }
+        static MY_VECTOR_TARGET_AVX2 reg set1(float value) { return _mm256_set1_ps(value); }
+        static MY_VECTOR_TARGET_AVX2 uint32_t eq_mask(reg a, reg b) {
+          return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)));
+        }
+        static MY_VECTOR_TARGET_AVX2 reg min(reg a, reg b) { return _mm256_min_ps(a, b); }
+        static MY_VECTOR_TARGET_AVX2 reg max(reg a, reg b) { return _mm256_max_ps(a, b); }
+        static MY_VECTOR_TARGET_AVX2 acc acc_zero() { return _mm256_setzero_ps(); }
+        static MY_VECTOR_TARGET_AVX2 acc acc_add(acc total, reg v) { return _mm256_add_ps(total, v); }
+        static MY_VECTOR_TARGET_AVX2 acc acc_merge(acc a, acc b) { return _mm256_add_ps(a, b); }
+        static MY_VECTOR_TARGET_AVX2 void acc_store(float* p, acc v) { _mm256_store_ps(p, v); }
+    };
+
+    template<>
+    struct ops<double> {
+        using reg = __m256d;
+        using acc = __m256d;
+        static constexpr size_t lanes = 4;
+        static constexpr bool ordered = true;
+
+        static MY_VECTOR_TARGET_AVX2 reg load(const double* p) { return _mm256_load_pd(p); }
+        static MY_VECTOR_TARGET_AVX2 void store(double* p, reg v) { _mm256_store_pd(p, v); }
+        static MY_VECTOR_TARGET_AVX2 reg set1(double value) { return _mm256_set1_pd(value); }
+        static MY_VECTOR_TARGET_AVX2 uint32_t eq_mask(reg a, reg b) {
+          return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)));
+        }
+        static MY_VECTOR_TARGET_AVX2 reg min(reg a, reg b) { return _mm256_min_pd(a, b); }
+        static MY_VECTOR_TARGET_AVX2 reg max(reg a, reg b) { return _mm256_max_pd(a, b); }
+        static MY_VECTOR_TARGET_AVX2 acc acc_zero() { return _mm256_setzero_pd(); }
+        static MY_VECTOR_TARGET_AVX2 acc acc_add(acc total, reg v) { return _mm256_add_pd(total, v); }
+        static MY_VECTOR_TARGET_AVX2 acc acc_merge(acc a, acc b) { return _mm256_add_pd(a, b); }
+        static MY_VECTOR_TARGET_AVX2 void acc_store(double* p, acc v) { _mm256_store_pd(p, v); }
+    };
+
+#define MY_VECTOR_KERNEL_TARGET MY_VECTOR_TARGET_AVX2
+#include "simd_kernels_impl.h"
+#undef MY_VECTOR_KERNEL_TARGET
+
+    } // namespace avx2
+
+    // GCC 12's AVX-512 headers trip -Wmaybe-uninitialized on their own _mm512_undefined_* helpers.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+    namespace avx512 {
+
+    template<typename T>
+    struct ops;
+
+    template<>
+    struct ops<int32_t> {
+        using reg = __m512i;
+        using acc = __m512i;
+        static constexpr size_t lanes = 16;
+        static constexpr bool ordered = true;
+
+        static MY_VECTOR_TARGET_AVX512 reg load(const int32_t* p) { return _mm512_load_si512(p); }
+        static MY_VECTOR_TARGET_AVX512 void store(int32_t* p, reg v) { _mm512_store_si512(p, v); }
+        static MY_VECTOR_TARGET_AVX512 reg set1(int32_t value) { return _mm512_set1_epi32(value); }
+        static MY_VECTOR_TARGET_AVX512 uint32_t eq_mask(reg a, reg b) { return _mm512_cmpeq_epi32_mask(a, b); }
+        static MY_VECTOR_TARGET_AVX512 reg min(reg a, reg b) { return _mm512_min_epi32(a, b); }
+        static MY_VECTOR_TARGET_AVX512 reg max(reg a, reg b) { return _mm512_max_epi32(a, b); }
+        static MY_VECTOR_TARGET_AVX512 acc acc_zero() { return _mm512_setzero_si512(); }
+        static MY_VECTOR_TARGET_AVX512 acc acc_add(acc total, reg v) {
+          const acc low = _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(v, 0));
+          const acc high = _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(v, 1));
+          return _mm512_add_epi64(total, _mm512_add_epi64(low, high));
+        }
+        static MY_VECTOR_TARGET_AVX512 acc acc_merge(acc a, acc b) { return _mm512_add_epi64(a, b); }
+        static MY_VECTOR_TARGET_AVX512 void acc_store(int64_t* p, acc v) { _mm512_store_si512(p, v); }
+    };
+
+    template<>
+    struct ops<int64_t> {
+        using reg = __m512i;
+        using acc = __m512i;
+        static constexpr size_t lanes = 8;
+        static constexpr bool ordered = true;
+
+        static MY_VECTOR_TARGET_AVX512 reg load(const int64_t* p) { return _mm512_load_si512(p); }
+        static MY_VECTOR_TARGET_AVX512 void store(int64_t* p, reg v) { _mm512_store_si512(p, v); }
+        static MY_VECTOR_TARGET_AVX512 reg set1(int64_t value) { return _mm512_set1_epi64(value); }
+        static MY_VECTOR_TARGET_AVX512 uint32_t eq_mask(reg a, reg b) { return _mm512_cmpeq_epi64_mask(a, b); }
+        static MY_VECTOR_TARGET_AVX512 reg min(reg a, reg b) { return _mm512_min_epi64(a, b); }
+        static MY_VECTOR_TARGET_AVX512 reg max(reg a, reg b) { return _mm512_max_epi64(a, b); }
+        static MY_VECTOR_TARGET_AVX512 acc acc_zero() { return _mm512_setzero_si512(); }
+        static MY_VECTOR_TARGET_AVX512 acc acc_add(acc total, reg v) { return _mm512_add_epi64(total, v); }
+        static MY_VECTOR_TARGET_AVX512 acc acc_merge(acc a, acc b) { return _mm512_add_epi64(a, b); }
+        static MY_VECTOR_TARGET_AVX512 void acc_store(int64_t* p, acc v) { _mm512_store_si512(p, v); }
+    };
+
+    template<>
+    struct ops<float> {
+        using reg = __m512;
+        using acc = __m512;
+        static constexpr size_t lanes = 16;
+        static constexpr bool ordered = true;
+
+        static MY_VECTOR_TARGET_AVX512 reg load(const float* p) { return _mm512_load_ps(p); }
+        static MY_VECTOR_TARGET_AVX512 void store(float* p, reg v) { _mm512_store_ps(p, v); }
+        static MY_VECTOR_TARGET_AVX512 reg set1(float value) { return _mm512_set1_ps(value); }
+        static MY_VECTOR_TARGET_AVX512 uint32_t eq_mask(reg a, reg b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+        static MY_VECTOR_TARGET_AVX512 reg min(reg a, reg b) { return _mm512_min_ps(a, b); }
+        static MY_VECTOR_TARGET_AVX512 reg max(reg a, reg b) { return _mm512_max_ps(a, b); }
+        static MY_VECTOR_TARGET_AVX512 acc acc_zero() { return _mm512_setzero_ps(); }
+        static MY_VECTOR_TARGET_AVX512 acc acc_add(acc total, reg v) { return _mm512_add_ps(total, v); }
+        static MY_VECTOR_TARGET_AVX512 acc acc_merge(acc a, acc b) { return _mm512_add_ps(a, b); }
+        static MY_VECTOR_TARGET_AVX512 void acc_store(float* p, acc v) { _mm512_store_ps(p, v); }
+    };
+
+    template<>
+    struct ops<double> {
+        using reg = __m512d;
+        using acc = __m512d;
+        static constexpr size_t lanes = 8;
+        static constexpr bool ordered = true;
+
+        static MY_VECTOR_TARGET_AVX512 reg load(const double* p) { return _mm512_load_pd(p); }
+        static MY_VECTOR_TARGET_AVX512 void store(double* p, reg v) { _mm512_store_pd(p, v); }
+        static MY_VECTOR_TARGET_AVX512 reg set1(double value) { return _mm512_set1_pd(value); }
+        static MY_VECTOR_TARGET_AVX512 uint32_t eq_mask(reg a, reg b) { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+        static MY_VECTOR_TARGET_AVX512 reg min(reg a, reg b) { return _mm512_min_pd(a, b); }
+        static MY_VECTOR_TARGET_AVX512 reg max(reg a, reg b) { return _mm512_max_pd(a, b); }
+        static MY_VECTOR_TARGET_AVX512 acc acc_zero() { return _mm512_setzero_pd(); }
+        static MY_VECTOR_TARGET_AVX512 acc acc_add(acc total, reg v) { return _mm512_add_pd(total, v); }
+        static MY_VECTOR_TARGET_AVX512 acc acc_merge(acc a, acc b) { return _mm512_add_pd(a, b); }
+        static MY_VECTOR_TARGET_AVX512 void acc_store(double* p, acc v) { _mm512_store_pd(p, v); }
+    };
+
+#define MY_VECTOR_KERNEL_TARGET MY_VECTOR_TARGET_AVX512
+#include "simd_kernels_impl.h"
+#undef MY_VECTOR_KERNEL_TARGET
+
+    } // namespace avx512
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+/**
+ * Forwards a kernel call to the widest instruction set the CPU supports, or to the scalar
+ * loop for element types without kernels. enabled(ops) lets a kernel opt out of a set.
+ */
+#if defined(MY_VECTOR_SIMD_X86)
+#define MY_VECTOR_SIMD_DISPATCH(kernel, enabled, ...)                                  \
+      if constexpr (has_kernels<T>) {                                                   \
+        const isa level = current_isa();                                                \
+        if (level >= isa::avx512) {                                                     \
+          return avx512::kernel(__VA_ARGS__);                                           \
+        }                                                                               \
+        if (level >= isa::avx2) {                                                       \
+          return avx2::kernel(__VA_ARGS__);                                             \
+        }                                                                               \
+        if constexpr (enabled(sse2::ops<T>)) {                                         \
+          if (level >= isa::sse2) {                                                     \
+            return sse2::kernel(__VA_ARGS__);                                           \
+          }                                                                             \
+        }                                                                               \
+      }                                                                                 \
+      return scalar::kernel(__VA_ARGS__)
+#else
+#define MY_VECTOR_SIMD_DISPATCH(kernel, enabled, ...) return scalar::kernel(__VA_ARGS__)
+#endif
+#define MY_VECTOR_SIMD_ANY(ops) true
+#define MY_VECTOR_SIMD_ORDERED(ops) ops::ordered
+
+    /**
+     * @brief Returns the index of the first element equal to value, or n if there is none.
+     */
+    template<typename T>
+    size_t find(const T* data, size_t n, const T& value) {
+      MY_VECTOR_SIMD_DISPATCH(find, MY_VECTOR_SIMD_ANY, data, n, value);
+    }
+
+    /**
+     * @brief Returns the number of elements equal to value.
+     */
+    template<typename T>
+    size_t count(const T* data, size_t n, const T& value) {
+      MY_VECTOR_SIMD_DISPATCH(count, MY_VECTOR_SIMD_ANY, data, n, value);
+    }
+
+    /**
+     * @brief Returns the sum of the elements in sum_t<T>.
+     */
+    template<typename T>
+    sum_t<T> sum(const T* data, size_t n) {
+      MY_VECTOR_SIMD_DISPATCH(sum, MY_VECTOR_SIMD_ANY, data, n);
+    }
+
+    /**
+     * @brief Returns the smallest element. n must not be zero.
+     */
+    template<typename T>
+    T min(const T* data, size_t n) {
+      MY_VECTOR_SIMD_DISPATCH(min, MY_VECTOR_SIMD_ORDERED, data, n);
+    }
+
+    /**
+     * @brief Returns the largest element. n must not be zero.
+     */
+    template<typename T>
+    T max(const T* data, size_t n) {
+      MY_VECTOR_SIMD_DISPATCH(max, MY_VECTOR_SIMD_ORDERED, data, n);
+    }
+
+    /**
+     * @brief Returns the smallest and the largest element in one pass. n must not be zero.
+     */
+    template<typename T>
+    std::pair<T, T> minmax(const T* data, size_t n) {
+      MY_VECTOR_SIMD_DISPATCH(minmax, MY_VECTOR_SIMD_ORDERED, data, n);
+    }
+
+    /**
+     * @brief Assigns value to every element.
+     */
+    template<typename T>
+    void fill(T* data, size_t n, const T& value) {
+      MY_VECTOR_SIMD_DISPATCH(fill, MY_VECTOR_SIMD_ANY, data, n, value);
+    }
+
+#undef MY_VECTOR_SIMD_ORDERED
+#undef MY_VECTOR_SIMD_ANY
+#undef MY_VECTOR_SIMD_DISPATCH
+
+    } // namespace simd
+
+    } // namespace detail
+
+} // namespace my_vector
+
+#endif //VECTOR_SIMD_KERNELS_H
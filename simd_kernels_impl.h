@@ -0,0 +1,205 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+// No include guard: simd_kernels.h includes this file once per instruction set, inside that
+// set's namespace. MY_VECTOR_KERNEL_TARGET names the target attribute and ops<T> describes
+// the registers, so the same loops compile to SSE2, AVX2 and AVX-512 code.
+
+    /**
+     * @brief Returns how many elements precede the first register-aligned one, at most n.
+     */
+    template<typename T>
+    MY_VECTOR_KERNEL_TARGET size_t head_length(const T* data, size_t n) noexcept {
+      constexpr size_t alignment = sizeof(typename ops<T>::reg);
+      const size_t misalignment = reinterpret_cast<uintptr_t>(data) % alignment;
+      return misalignment ? std::min(n, (alignment - misalignment) / sizeof(T)) : 0;
+    }
+
+    template<typename T>
+    MY_VECTOR_KERNEL_TARGET size_t find(const T* data, size_t n, T value) noexcept {
+      using op = ops<T>;
+      size_t i = 0;
+      for (const size_t head = head_length(data, n); i < head; ++i) {
+        if (data[i] == value) {
+          return i;
+        }
+      }
+      const typename op::reg needle = op::set1(value);
+      for (; i + 2 * op::lanes <= n; i += 2 * op::lanes) {
+        const uint32_t low = op::eq_mask(op::load(data + i), needle);
+        const uint32_t high = op::eq_mask(op::load(data + i + op::lanes), needle);
+        if (low | high) {
+          return low ? i + __builtin_ctz(low) : i + op::lanes + __builtin_ctz(high);
+        }
+      }
+      for (; i + op::lanes <= n; i += op::lanes) {
+        if (const uint32_t mask = op::eq_mask(op::load(data + i), needle)) {
+          return i + __builtin_ctz(mask);
+        }
+      }
+      for (; i < n; ++i) {
+        if (data[i] == value) {
+          return i;
+        }
+      }
+      return n;
+    }
+
+    template<typename T>
+    MY_VECTOR_KERNEL_TARGET size_t count(const T* data, size_t n, T value) noexcept {
+      using op = ops<T>;
+      size_t total = 0;
+      size_t i = 0;
+      for (const size_t head = head_length(data, n); i < head; ++i) {
+        total += data[i] == value;
+      }
+      const typename op::reg needle = op::set1(value);
+      for (; i + op::lanes <= n; i += op::lanes) {
+        total += static_cast<size_t>(__builtin_popcount(op::eq_mask(op::load(data + i), needle)));
+      }
+      for (; i < n; ++i) {
+        total += data[i] == value;
+      }
+      return total;
+    }
+
+    template<typename T>
+    MY_VECTOR_KERNEL_TARGET sum_t<T> sum(const T* data, size_t n) noexcept {
+      using op = ops<T>;
+      sum_t<T> total = 0;
+      size_t i = 0;
+      for (const size_t head = head_length(data, n); i < head; ++i) {
+        total += data[i];
+      }
+      // Four independent accumulators hide the latency of the adds.
+      typename op::acc acc0 = op::acc_zero();
+      typename op::acc acc1 = acc0;
+      typename op::acc acc2 = acc0;
+      typename op::acc acc3 = acc0;
+      for (; i + 4 * op::lanes <= n; i += 4 * op::lanes) {
+        acc0 = op::acc_add(acc0, op::load(data + i));
+        acc1 = op::acc_add(acc1, op::load(data + i + op::lanes));
+        acc2 = op::acc_add(acc2, op::load(data + i + 2 * op::lanes));
+        acc3 = op::acc_add(acc3, op::load(data + i + 3 * op::lanes));
+      }
+      for (; i + op::lanes <= n; i += op::lanes) {
+        acc0 = op::acc_add(acc0, op::load(data + i));
+      }
+      acc0 = op::acc_merge(op::acc_merge(acc0, acc1), op::acc_merge(acc2, acc3));
+      alignas(64) sum_t<T> parts[sizeof(typename op::acc) / sizeof(sum_t<T>)];
+      op::acc_store(parts, acc0);
+      for (const sum_t<T> part : parts) {
+        total += part;
+      }
+      for (; i < n; ++i) {
+        total += data[i];
+      }
+      return total;
+    }
+
+    /**
+     * @brief Returns the smallest element, or the largest if Max. n must not be zero.
+     */
+    template<bool Max, typename T>
+    MY_VECTOR_KERNEL_TARGET T extreme(const T* data, size_t n) noexcept {
+      using op = ops<T>;
+      T best = data[0];
+      size_t i = 0;
+      for (const size_t head = head_length(data, n); i < head; ++i) {
+        if (Max ? best < data[i] : data[i] < best) {
+          best = data[i];
+        }
+      }
+      if (i + op::lanes <= n) {
+        typename op::reg best0 = op::load(data + i);
+        typename op::reg best1 = best0;
+        i += op::lanes;
+        for (; i + 2 * op::lanes <= n; i += 2 * op::lanes) {
+          if constexpr (Max) {
+            best0 = op::max(best0, op::load(data + i));
+            best1 = op::max(best1, op::load(data + i + op::lanes));
+          } else {
+            best0 = op::min(best0, op::load(data + i));
+            best1 = op::min(best1, op::load(data + i + op::lanes));
+          }
+        }
+        if (i + op::lanes <= n) {
+          best1 = Max ? op::max(best1, op::load(data + i)) : op::min(best1, op::load(data + i));
+          i += op::lanes;
+        }
+        best0 = Max ? op::max(best0, best1) : op::min(best0, best1);
+        alignas(64) T parts[op::lanes];
+        op::store(parts, best0);
+        for (const T part : parts) {
+          if (Max ? best < part : part < best) {
+            best = part;
+          }
+        }
+      }
+      for (; i < n; ++i) {
+        if (Max ? best < data[i] : data[i] < best) {
+          best = data[i];
+        }
+      }
+      return best;
+    }
+
+    template<typename T>
+    MY_VECTOR_KERNEL_TARGET T min(const T* data, size_t n) noexcept {
+      return extreme<false>(data, n);
+    }
+
+    template<typename T>
+    MY_VECTOR_KERNEL_TARGET T max(const T* data, size_t n) noexcept {
+      return extreme<true>(data, n);
+    }
+
+    template<typename T>
+    MY_VECTOR_KERNEL_TARGET std::pair<T, T> minmax(const T* data, size_t n) noexcept {
+      using op = ops<T>;
+      T low = data[0];
+      T high = data[0];
+      size_t i = 0;
+      for (const size_t head = head_length(data, n); i < head; ++i) {
+        low = data[i] < low ? data[i] : low;
+        high = high < data[i] ? data[i] : high;
+      }
+      if (i + op::lanes <= n) {
+        typename op::reg lows = op::load(data + i);
+        typename op::reg highs = lows;
+        for (i += op::lanes; i + op::lanes <= n; i += op::lanes) {
+          const typename op::reg block = op::load(data + i);
+          lows = op::min(lows, block);
+          highs = op::max(highs, block);
+        }
+        alignas(64) T parts[2][op::lanes];
+        op::store(parts[0], lows);
+        op::store(parts[1], highs);
+        for (size_t lane = 0; lane < op::lanes; ++lane) {
+          low = parts[0][lane] < low ? parts[0][lane] : low;
+          high = high < parts[1][lane] ? parts[1][lane] : high;
+        }
+      }
+      for (; i < n; ++i) {
+        low = data[i] < low ? data[i] : low;
+        high = high < data[i] ? data[i] : high;
+      }
+      return {low, high};
+    }
+
+    template<typename T>
+    MY_VECTOR_KERNEL_TARGET void fill(T* data, size_t n, T value) noexcept {
+      using op = ops<T>;
+      size_t i = 0;
+      for (const size_t head = head_length(data, n); i < head; ++i) {
+        data[i] = value;
+      }
+      const typename op::reg block = op::set1(value);
+      for (; i + op::lanes <= n; i += op::lanes) {
+        op::store(data + i, block);
+      }
+      for (; i < n; ++i) {
+        data[i] = value;
+      }
+    }
@@ -0,0 +1,440 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_SMALL_VECTOR_H
+#define VECTOR_SMALL_VECTOR_H
+
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+
+#include "iterator.h"
+#include "relocation.h"
+#include "vector.h"
+
+namespace my_vector {
+
+/**
+ * @brief A vector that stores up to N elements inside the object itself.
+ *
+ * Behaves like vector, but the first N elements live in an inline buffer, so small
+ * vectors never touch the heap. Once the size exceeds N, the elements move to heap
+ * storage obtained from Allocator and growth continues like in vector. Moving a
+ * small_vector whose elements are inline moves them one by one and never allocates.
+ *
+ * @tparam T The type of elements stored in the vector.
+ * @tparam N The number of elements that fit in the inline buffer.
+ * @tparam Allocator The allocator used once the elements spill to the heap.
+ */
+    template<typename T, size_t N, typename Allocator = std::allocator<T>>
+    class small_vector : private detail::allocator_holder<Allocator> {
+        static_assert(N > 0, "small_vector needs room for at least one inline element");
+
+        using alloc_traits = std::allocator_traits<Allocator>;
+        using detail::allocator_holder<Allocator>::allocator;
+
+        size_t size_; /// Number of elements in the vector
+        size_t capacity_; /// N while inline, otherwise the size of the heap storage
+        T* data_; /// Points at inline_ or at heap storage
+        alignas(T) unsigned char inline_[N * sizeof(T)]; /// Inline storage for the first N elements
+
+      /**
+       * @brief Returns a pointer to the inline buffer.
+       */
+        T* inline_data() noexcept;
+
+      /**
+       * @brief Checks whether the elements live on the heap.
+       */
+        bool on_heap() const noexcept;
+
+      /**
+       * @brief Moves the elements to heap storage with the new capacity if it exceeds the current one.
+       *
+       * @param new_capacity The new capacity of the vector.
+       */
+        void reserve(size_t new_capacity);
+
+      /**
+       * @brief Moves the elements of other into this vector, which must be empty and inline.
+       *
+       * Takes over other's heap storage when the allocators allow it and moves the elements
+       * one by one otherwise. Leaves other empty and inline.
+       *
+       * @param other The vector to take the elements from.
+       */
+        void take_elements(small_vector& other);
+
+      /**
+       * @brief Checks if the vector is empty.
+       *
+       * @return True if the vector is empty, false otherwise.
+       */
+        bool is_empty() const noexcept;
+
+      /**
+       * @brief Destroys all elements and releases heap storage, returning to inline mode.
+       */
+        void destroy_and_deallocate() noexcept;
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using iterator = detail::contiguous_iterator<T, small_vector>;
+        using const_iterator = detail::contiguous_iterator<const T, small_vector>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        /**
+         * @brief Default constructor.
+         *
+         * Creates an empty vector that uses the inline buffer.
+         */
+        small_vector() noexcept(std::is_nothrow_default_constructible<Allocator>::value);
+
+        /**
+         * @brief Constructs an empty vector that spills to storage from the given allocator.
+         *
+         * @param alloc The allocator to use.
+         */
+        explicit small_vector(const Allocator& alloc) noexcept;
+
+        /**
+         * @brief Constructor with size and value.
+         *
+         * @param size The number of elements to initialize.
+         * @param value The value to initialize each element with.
+         * @param alloc The allocator to use.
+         */
+        small_vector(size_t size, T value, const Allocator& alloc = Allocator());
+
+        /**
+         * @brief Copy constructor.
+         *
+         * @param other The vector to copy from.
+         */
+        small_vector(const small_vector& other);
+
+        /**
+         * @brief Copy assignment operator.
+         *
+         * @param other The vector to copy from.
+         * @return A reference to the assigned vector.
+         */
+        small_vector& operator=(const small_vector& other);
+
+        /**
+         * @brief Move constructor.
+         *
+         * Takes over heap storage, or moves inline elements one by one without allocating.
+         *
+         * @param other The vector to move from.
+         */
+        small_vector(small_vector&& other) noexcept(std::is_nothrow_move_constructible<T>::value);
+
+        /**
+         * @brief Move assignment operator.
+         *
+         * @param other The vector to move from.
+         * @return A reference to the assigned vector.
+         */
+        small_vector& operator=(small_vector&& other)
+            noexcept(std::is_nothrow_move_constructible<T>::value &&
+                     (alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value));
+
+        /**
+         * @brief Destructor.
+         */
+        ~small_vector();
+
+        /**
+         * @brief Accesses the element at the specified position.
+         *
+         * @param index The position of the element to access.
+         * @return A reference to the element at the specified position.
+         */
+        T& operator[] (size_t index);
+
+        /**
+         * @brief Accesses the element at the specified position (const version).
+         *
+         * @param index The position of the element to access.
+         * @return A const reference to the element at the specified position.
+         */
+        const T& operator[] (size_t index) const;
+
+        /**
+         * @brief Returns an iterator to the first element.
+         *
+         * @return An iterator to the first element.
+         */
+        iterator begin() noexcept;
+
+        /**
+         * @brief Returns a const iterator to the first element.
+         *
+         * @return A const iterator to the first element.
+         */
+        const_iterator begin() const noexcept;
+
+        /**
+         * @brief Returns an iterator past the last element.
+         *
+         * @return An iterator past the last element.
+         */
+        iterator end() noexcept;
+
+        /**
+         * @brief Returns a const iterator past the last element.
+         *
+         * @return A const iterator past the last element.
+         */
+        const_iterator end() const noexcept;
+
+        /**
+         * @brief Returns a const iterator to the first element.
+         *
+         * @return A const iterator to the first element.
+         */
+        const_iterator cbegin() const noexcept;
+
+        /**
+         * @brief Returns a const iterator past the last element.
+         *
+         * @return A const iterator past the last element.
+         */
+        const_iterator cend() const noexcept;
+
+        /**
+         * @brief Returns a reverse iterator to the last element.
+         *
+         * @return A reverse iterator to the last element.
+         */
+        reverse_iterator rbegin() noexcept;
+
+        /**
+         * @brief Returns a const reverse iterator to the last element.
+         *
+         * @return A const reverse iterator to the last element.
+         */
+        const_reverse_iterator rbegin() const noexcept;
+
+        /**
+         * @brief Returns a reverse iterator before the first element.
+         *
+         * @return A reverse iterator before the first element.
+         */
+        reverse_iterator rend() noexcept;
+
+        /**
+         * @brief Returns a const reverse iterator before the first element.
+         *
+         * @return A const reverse iterator before the first element.
+         */
+        const_reverse_iterator rend() const noexcept;
+
+        /**
+         * @brief Adds an element to the end of the vector.
+         *
+         * @param value The value to add.
+         */
+        void push_back(const T& value);
+
+        /**
+         * @brief Adds an element to the end of the vector using move semantics.
+         *
+         * @param value The value to add.
+         */
+        void push_back(T&& value);
+
+        /**
+         * @brief Adds an element to the front of the vector.
+         *
+         * @param value The value to add.
+         */
+        void push_front(const T& value);
+
+        /**
+         * @brief Adds an element to the front of the vector using move semantics.
+         *
+         * @param value The value to add.
+         */
+        void push_front(T&& value);
+
+        /**
+         * @brief Destroys all elements, keeping the current storage.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Swaps the contents of this vector with another vector.
+         *
+         * @param other The vector to swap with.
+         */
+        void swap(small_vector& other) noexcept(std::is_nothrow_move_constructible<T>::value);
+
+        /**
+         * @brief Returns the number of elements in the vector.
+         *
+         * @return The number of elements in the vector.
+         */
+        [[nodiscard]] size_t size() const noexcept;
+
+        /**
+         * @brief Returns the capacity of the vector, N while the elements are inline.
+         *
+         * @return The capacity of the vector.
+         */
+        [[nodiscard]] size_t capacity() const noexcept;
+
+        /**
+         * @brief Checks whether the elements are stored in the inline buffer.
+         *
+         * @return True if no heap storage is in use.
+         */
+        [[nodiscard]] bool is_inline() const noexcept;
+
+        /**
+         * @brief Accesses the element at the specified position.
+         *
+         * @param index The position of the element to access.
+         * @return A reference to the element at the specified position.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        T& at(size_t index);
+
+        /**
+         * @brief Accesses the element at the specified position (const version).
+         *
+         * @param index The position of the element to access.
+         * @return A const reference to the element at the specified position.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        const T& at(size_t index) const;
+
+        /**
+         * @brief Accesses the first element.
+         *
+         * @return A reference to the first element.
+         * @throws std::out_of_range if the vector is empty.
+         */
+        T& front();
+
+        /**
+         * @brief Accesses the first element (const version).
+         *
+         * @return A const reference to the first element.
+         * @throws std::out_of_range if the vector is empty.
+         */
+        const T& front() const;
+
+        /**
+         * @brief Accesses the last element.
+         *
+         * @return A reference to the last element.
+         * @throws std::out_of_range if the vector is empty.
+         */
+        T& back();
+
+        /**
+         * @brief Accesses the last element (const version).
+         *
+         * @return A const reference to the last element.
+         * @throws std::out_of_range if the vector is empty.
+         */
+        const T& back() const;
+
+        /**
+         * @brief Removes the last element of the vector.
+         *
+         * @throws std::out_of_range if the vector is empty.
+         */
+        void pop_back();
+
+        /**
+         * @brief Removes the first element of the vector.
+         *
+         * @throws std::out_of_range if the vector is empty.
+         */
+        void pop_front();
+
+        /**
+         * @brief Resizes the vector to contain the specified number of elements.
+         *
+         * @param new_size The new size of the vector.
+         */
+        void resize(size_t new_size);
+
+        /**
+         * @brief Resizes the vector, initializing new elements with the specified value.
+         *
+         * @param new_size The new size of the vector.
+         * @param value The value to initialize new elements with.
+         */
+        void resize(size_t new_size, const T& value);
+
+        /**
+         * @brief Shrinks the capacity of the vector to fit its size.
+         *
+         * Moves the elements back into the inline buffer when they fit.
+         */
+        void shrink_to_fit();
+
+        /**
+         * @brief Returns a pointer to the underlying array.
+         *
+         * @return A pointer to the underlying array.
+         */
+        T* data() noexcept;
+
+        /**
+         * @brief Returns a const pointer to the underlying array.
+         *
+         * @return A const pointer to the underlying array.
+         */
+        const T* data() const noexcept;
+
+        /**
+         * @brief Trims the capacity of the vector to match its size.
+         */
+        void trim_to_size();
+
+        /**
+         * @brief Ensures the vector has at least the specified capacity.
+         *
+         * @param min_capacity The minimum capacity to ensure.
+         */
+        void ensure_capacity(size_t min_capacity);
+
+        /**
+         * @brief Returns a copy of the allocator associated with the vector.
+         *
+         * @return The allocator.
+         */
+        allocator_type get_allocator() const noexcept;
+    };
+
+    namespace pmr {
+
+    /**
+     * @brief A small_vector that spills to a std::pmr::memory_resource.
+     *
+     * @tparam T The type of elements stored in the vector.
+     * @tparam N The number of elements that fit in the inline buffer.
+     */
+    template<typename T, size_t N>
+    using small_vector = my_vector::small_vector<T, N, std::pmr::polymorphic_allocator<T>>;
+
+    } // namespace pmr
+
+} // namespace my_vector
+
+#include "small_vector_impl.h"
+
+#endif //VECTOR_SMALL_VECTOR_H
@@ -0,0 +1,458 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace my_vector {
+
+    template<typename T, size_t N, typename Allocator>
+    small_vector<T, N, Allocator>::small_vector() noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+        : size_(0), capacity_(N), data_(inline_data()) {
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    small_vector<T, N, Allocator>::small_vector(const Allocator& alloc) noexcept
+        : detail::allocator_holder<Allocator>(alloc), size_(0), capacity_(N), data_(inline_data()) {
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    small_vector<T, N, Allocator>::small_vector(size_t size, T value, const Allocator& alloc)
+        : small_vector(alloc) {
+      resize(size, value);
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    small_vector<T, N, Allocator>::small_vector(const small_vector& other)
+        : small_vector(alloc_traits::select_on_container_copy_construction(other.allocator())) {
+      try {
+        reserve(other.size_);
+        for (; size_ < other.size_; ++size_) {
+          alloc_traits::construct(allocator(), &data_[size_], other.data_[size_]);
+        }
+      } catch (...) {
+        destroy_and_deallocate();
+        throw;
+      }
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    small_vector<T, N, Allocator>& small_vector<T, N, Allocator>::operator=(const small_vector& other) {
+      if (this != &other) {
+        destroy_and_deallocate();
+        if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+          allocator() = other.allocator();
+        }
+        reserve(other.size_);
+        for (; size_ < other.size_; ++size_) {
+          alloc_traits::construct(allocator(), &data_[size_], other.data_[size_]);
+        }
+      }
+      return *this;
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    small_vector<T, N, Allocator>::small_vector(small_vector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+        : detail::allocator_holder<Allocator>(other.allocator()), size_(0), capacity_(N), data_(inline_data()) {
+      take_elements(other);
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    small_vector<T, N, Allocator>& small_vector<T, N, Allocator>::operator=(small_vector&& other)
+        noexcept(std::is_nothrow_move_constructible<T>::value &&
+                 (alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value)) {
+      if (this != &other) {
+        destroy_and_deallocate();
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+          allocator() = std::move(other.allocator());
+        }
+        take_elements(other);
+      }
+      return *this;
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    small_vector<T, N, Allocator>::~small_vector() {
+      destroy_and_deallocate();
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    T* small_vector<T, N, Allocator>::inline_data() noexcept {
+      return reinterpret_cast<T*>(inline_);
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    bool small_vector<T, N, Allocator>::on_heap() const noexcept {
+      return data_ != reinterpret_cast<const T*>(inline_);
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void small_vector<T, N, Allocator>::take_elements(small_vector& other) {
+      if (other.on_heap() && allocator() == other.allocator()) {
+        data_ = other.data_;
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+        other.data_ = other.inline_data();
+        other.size_ = 0;
+        other.capacity_ = N;
+        return;
+      }
+      // Inline elements (or storage from a foreign allocator) have to be moved one by one.
+      reserve(other.size_);
+      for (; size_ < other.size_; ++size_) {
+        alloc_traits::construct(allocator(), &data_[size_], std::move(other.data_[size_]));
+      }
+      other.destroy_and_deallocate();
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void small_vector<T, N, Allocator>::destroy_and_deallocate() noexcept {
+      for (size_t i = 0; i < size_; ++i) {
+        alloc_traits::destroy(allocator(), &data_[i]);
+      }
+      if (on_heap()) {
+        alloc_traits::deallocate(allocator(), data_, capacity_);
+      }
+      data_ = inline_data();
+      size_ = 0;
+      capacity_ = N;
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    bool small_vector<T, N, Allocator>::is_empty() const noexcept {
+      return size_ == 0;
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void small_vector<T, N, Allocator>::reserve(size_t new_capacity) {
+      if (new_capacity > capacity_) {
+        T* new_data = alloc_traits::allocate(allocator(), new_capacity);
+        try {
+          detail::relocate(allocator(), data_, size_, new_data);
+        } catch (...) {
+          alloc_traits::deallocate(allocator(), new_data, new_capacity);
+          throw;
+        }
+        if (on_heap()) {
+          alloc_traits::deallocate(allocator(), data_, capacity_);
+        }
+        data_ = new_data;
+        capacity_ = new_capacity;
+      }
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    T& small_vector<T, N, Allocator>::operator[] (size_t index) {
+      return data_[index];
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    const T& small_vector<T, N, Allocator>::operator[] (size_t index) const {
+      return data_[index];
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    typename small_vector<T, N, Allocator>::iterator small_vector<T, N, Allocator>::begin() noexcept {
+      return iterator(data_);
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    typename small_vector<T, N, Allocator>::const_iterator small_vector<T, N, Allocator>::begin() const noexcept {
+      return const_iterator(data_);
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    typename small_vector<T, N, Allocator>::iterator small_vector<T, N, Allocator>::end() noexcept {
+      return iterator(data_ + size_);
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    typename small_vector<T, N, Allocator>::const_iterator small_vector<T, N, Allocator>::end() const noexcept {
+      return const_iterator(data_ + size_);
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    typename small_vector<T, N, Allocator>::const_iterator small_vector<T, N, Allocator>::cbegin() const noexcept {
+      return const_iterator(data_);
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    typename small_vector<T, N, Allocator>::const_iterator small_vector<T, N, Allocator>::cend() const noexcept {
+      return const_iterator(data_ + size_);
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    typename small_vector<T, N, Allocator>::reverse_iterator small_vector<T, N, Allocator>::rbegin() noexcept {
+      return reverse_iterator(end());
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    typename small_vector<T, N, Allocator>::const_reverse_iterator small_vector<T, N, Allocator>::rbegin() const noexcept {
+      return const_reverse_iterator(end());
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    typename small_vector<T, N, Allocator>::reverse_iterator small_vector<T, N, Allocator>::rend() noexcept {
+      return reverse_iterator(begin());
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    typename small_vector<T, N, Allocator>::const_reverse_iterator small_vector<T, N, Allocator>::rend() const noexcept {
+      return const_reverse_iterator(begin());
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void small_vector<T, N, Allocator>::push_back(const T& value) {
+      if (size_ == capacity_) {
+        // value may live in this vector, so take a copy before the elements move.
+        T copy(value);
+        reserve(capacity_ * 2);
+        alloc_traits::construct(allocator(), &data_[size_], std::move(copy));
+      } else {
+        alloc_traits::construct(allocator(), &data_[size_], value);
+      }
+      ++size_;
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void small_vector<T, N, Allocator>::push_back(T&& value) {
+      if (size_ == capacity_) {
+        T copy(std::move(value));
+        reserve(capacity_ * 2);
+        alloc_traits::construct(allocator(), &data_[size_], std::move(copy));
+      } else {
+        alloc_traits::construct(allocator(), &data_[size_], std::move(value));
+      }
+      ++size_;
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void small_vector<T, N, Allocator>::push_front(const T& value) {
+      push_front(T(value));
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void small_vector<T, N, Allocator>::push_front(T&& value) {
+      if (size_ == 0) {
+        push_back(std::move(value));
+        return;
+      }
+      T copy(std::move(value));
+      if (size_ == capacity_) {
+        reserve(capacity_ * 2);
+      }
+      // Open a slot at the end, then shift the remaining elements up by move assignment.
+      alloc_traits::construct(allocator(), &data_[size_], std::move(data_[size_ - 1]));
+      ++size_;
+      for (size_t i = size_ - 2; i > 0; --i) {
+        data_[i] = std::move(data_[i - 1]);
+      }
+      data_[0] = std::move(copy);
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void small_vector<T, N, Allocator>::clear() noexcept {
+      for (size_t i = 0; i < size_; ++i) {
+        alloc_traits::destroy(allocator(), &data_[i]);
+      }
+      size_ = 0;
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void small_vector<T, N, Allocator>::swap(small_vector& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+      if (this == &other) {
+        return;
+      }
+      if (on_heap() && other.on_heap()) {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+      } else if (on_heap() || other.on_heap()) {
+        // The heap buffer changes hands as is, so it always stays with the allocator that
+        // owns it once the allocators are swapped below. Only the inline elements move.
+        small_vector& heap = on_heap() ? *this : other;
+        small_vector& local = on_heap() ? other : *this;
+        T* const buffer = heap.data_;
+        const size_t count = heap.size_;
+        const size_t capacity = heap.capacity_;
+        // Leaves both vectors untouched if a move throws.
+        detail::relocate(heap.allocator(), local.data_, local.size_, heap.inline_data());
+        heap.data_ = heap.inline_data();
+        heap.size_ = local.size_;
+        heap.capacity_ = N;
+        local.data_ = buffer;
+        local.size_ = count;
+        local.capacity_ = capacity;
+      } else {
+        small_vector tmp(std::move(other));
+        other.take_elements(*this);
+        take_elements(tmp);
+      }
+      if constexpr (alloc_traits::propagate_on_container_swap::value) {
+        using std::swap;
+        swap(allocator(), other.allocator());
+      }
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    size_t small_vector<T, N, Allocator>::size() const noexcept {
+      return size_;
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    size_t small_vector<T, N, Allocator>::capacity() const noexcept {
+      return capacity_;
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    bool small_vector<T, N, Allocator>::is_inline() const noexcept {
+      return !on_heap();
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    T& small_vector<T, N, Allocator>::at(size_t index) {
+      if (index >= size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      return data_[index];
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    const T& small_vector<T, N, Allocator>::at(size_t index) const {
+      if (index >= size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      return data_[index];
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    T& small_vector<T, N, Allocator>::front() {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      return data_[0];
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    const T& small_vector<T, N, Allocator>::front() const {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      return data_[0];
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    T& small_vector<T, N, Allocator>::back() {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      return data_[size_ - 1];
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    const T& small_vector<T, N, Allocator>::back() const {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      return data_[size_ - 1];
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void small_vector<T, N, Allocator>::pop_back() {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      alloc_traits::destroy(allocator(), &data_[--size_]);
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void small_vector<T, N, Allocator>::pop_front() {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      for (size_t i = 1; i < size_; ++i) {
+        data_[i - 1] = std::move(data_[i]);
+      }
+      alloc_traits::destroy(allocator(), &data_[--size_]);
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void small_vector<T, N, Allocator>::resize(size_t new_size) {
+      if (new_size > capacity_) {
+        reserve(std::max(new_size, capacity_ * 2));
+      }
+      for (; size_ < new_size; ++size_) {
+        alloc_traits::construct(allocator(), &data_[size_]);
+      }
+      for (; size_ > new_size; --size_) {
+        alloc_traits::destroy(allocator(), &data_[size_ - 1]);
+      }
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void small_vector<T, N, Allocator>::resize(size_t new_size, const T& value) {
+      if (new_size > capacity_) {
+        T copy(value);
+        reserve(std::max(new_size, capacity_ * 2));
+        for (; size_ < new_size; ++size_) {
+          alloc_traits::construct(allocator(), &data_[size_], copy);
+        }
+      }
+      for (; size_ < new_size; ++size_) {
+        alloc_traits::construct(allocator(), &data_[size_], value);
+      }
+      for (; size_ > new_size; --size_) {
+        alloc_traits::destroy(allocator(), &data_[size_ - 1]);
+      }
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void small_vector<T, N, Allocator>::shrink_to_fit() {
+      if (!on_heap() || size_ == capacity_) {
+        return;
+      }
+      T* new_data = size_ <= N ? inline_data() : alloc_traits::allocate(allocator(), size_);
+      try {
+        detail::relocate(allocator(), data_, size_, new_data);
+      } catch (...) {
+        if (new_data != inline_data()) {
+          alloc_traits::deallocate(allocator(), new_data, size_);
+        }
+        throw;
+      }
+      alloc_traits::deallocate(allocator(), data_, capacity_);
+      data_ = new_data;
+      capacity_ = size_ <= N ? N : size_;
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    T* small_vector<T, N, Allocator>::data() noexcept {
+      return data_;
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    const T* small_vector<T, N, Allocator>::data() const noexcept {
+      return data_;
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void small_vector<T, N, Allocator>::trim_to_size() {
+      if (capacity_ > size_) {
+        shrink_to_fit();
+      }
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    void small_vector<T, N, Allocator>::ensure_capacity(size_t min_capacity) {
+      if (capacity_ < min_capacity) {
+        reserve(min_capacity);
+      }
+    }
+
+    template<typename T, size_t N, typename Allocator>
+    typename small_vector<T, N, Allocator>::allocator_type small_vector<T, N, Allocator>::get_allocator() const noexcept {
+      return allocator();
+    }
+
+} //namespace my_vector
@@ -0,0 +1,325 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_SNAPSHOT_H
+#define VECTOR_SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "iterator.h"
+#include "vector.h"
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#error "snapshot.h needs a POSIX system"
+#endif
+
+namespace my_vector {
+
+/**
+ * Binary snapshots of a vector.
+ *
+ * A snapshot is a 64-byte header followed by the payload. Trivially copyable elements are
+ * stored as their raw bytes, so a snapshot can be mapped and used in place with
+ * snapshot_view. Other element types are written through a serializer<T> specialization.
+ * The header records the element size and alignment, the count, the byte order of the
+ * writer and an XXH64 checksum of the payload. Loading rejects snapshots that do not match
+ * the reading program instead of converting them.
+ */
+
+    namespace detail {
+
+    /**
+     * @brief The first 64 bytes of a snapshot.
+     */
+    struct snapshot_header {
+        char magic[8]; /// "MYVECSNP"
+        uint16_t version; /// Format version, currently 1
+        uint8_t endianness; /// 1 for little-endian writers, 2 for big-endian ones
+        uint8_t serialized; /// 1 if the payload came from a serializer, 0 for raw element bytes
+        uint32_t element_size; /// sizeof(T) of the writer
+        uint32_t element_align; /// alignof(T) of the writer
+        uint32_t reserved; /// Zero
+        uint64_t count; /// Number of elements
+        uint64_t payload_bytes; /// Length of the payload following the header
+        uint64_t checksum; /// XXH64 of the payload, seed 0
+        unsigned char padding[16]; /// Zero, keeps the payload 64-byte aligned
+    };
+
+    static_assert(sizeof(snapshot_header) == 64, "snapshot_header must stay 64 bytes");
+
+    /**
+     * @brief Computes the XXH64 hash of a buffer.
+     *
+     * @param data The bytes to hash.
+     * @param length The number of bytes.
+     * @param seed The hash seed.
+     * @return The 64-bit hash.
+     */
+    inline uint64_t xxh64(const void* data, size_t length, uint64_t seed = 0) noexcept;
+
+    } // namespace detail
+
+    /**
+     * @brief Collects the bytes a serializer produces for one snapshot.
+     */
+    class snapshot_writer {
+        vector<unsigned char> bytes_; /// The payload written so far
+    public:
+        /**
+         * @brief Appends raw bytes to the payload.
+         *
+         * @param data The bytes to append.
+         * @param length The number of bytes.
+         */
+        void write(const void* data, size_t length);
+
+        /**
+         * @brief Appends the bytes of a trivially copyable value.
+         *
+         * @param value The value to append.
+         */
+        template<typename U>
+        void write_value(const U& value);
+
+        /**
+         * @brief Returns the payload written so far.
+         */
+        const vector<unsigned char>& bytes() const noexcept;
+    };
+
+    /**
+     * @brief Hands a serializer the payload of a snapshot, front to back.
+     */
+    class snapshot_reader {
+        const unsigned char* next_; /// The next unread byte
+        const unsigned char* end_; /// Past the last byte of the payload
+    public:
+        /**
+         * @brief Reads from the given payload.
+         *
+         * @param data The payload.
+         * @param length The number of bytes in the payload.
+         */
+        snapshot_reader(const void* data, size_t length) noexcept;
+
+        /**
+         * @brief Copies the next bytes of the payload.
+         *
+         * @param data The destination.
+         * @param length The number of bytes to copy.
+         * @throws std::runtime_error if the payload is shorter than that.
+         */
+        void read(void* data, size_t length);
+
+        /**
+         * @brief Reads a trivially copyable value.
+         *
+         * @return The value.
+         * @throws std::runtime_error if the payload is too short.
+         */
+        template<typename U>
+        U read_value();
+
+        /**
+         * @brief Returns the number of unread bytes.
+         */
+        [[nodiscard]] size_t remaining() const noexcept;
+    };
+
+    /**
+     * @brief Serializer hook for element types that are not trivially copyable.
+     *
+     * Specialize it with
+     *   static void save(const T& value, snapshot_writer& out);
+     *   static T load(snapshot_reader& in);
+     * or pass a class with the same two functions to save() and load().
+     *
+     * @tparam T The element type.
+     */
+    template<typename T>
+    struct serializer;
+
+    namespace detail {
+
+    /**
+     * @brief Stands in for serializer<T> when it is not specialized; elements are then saved raw.
+     */
+    struct no_serializer {};
+
+    template<typename T, typename = void>
+    struct select_serializer {
+        using type = no_serializer;
+    };
+
+    template<typename T>
+    struct select_serializer<T, std::void_t<decltype(sizeof(serializer<T>))>> {
+        using type = serializer<T>;
+    };
+
+    template<typename T>
+    using serializer_for = typename select_serializer<T>::type;
+
+    } // namespace detail
+
+    /**
+     * @brief Writes a snapshot of the vector to an open file descriptor.
+     *
+     * Writes at the current file offset. Header and payload go out in a single writev call,
+     * repeated only if the kernel accepts less than everything at once. Trivially copyable
+     * elements are written straight from data(). Other types are first serialized into a
+     * buffer. The data is not fsync'ed.
+     *
+     * @param vec The vector to save.
+     * @param fd The file descriptor to write to.
+     * @param hook The serializer, needed for element types that are not trivially copyable.
+     * @throws std::system_error if writing fails.
+     */
+    template<typename T, typename Allocator, typename GrowthPolicy, typename Serializer = detail::serializer_for<T>>
+    void save(const vector<T, Allocator, GrowthPolicy>& vec, int fd, Serializer hook = Serializer());
+
+    /**
+     * @brief Writes a snapshot of the vector to a file, replacing its contents.
+     *
+     * @param vec The vector to save.
+     * @param path The file to write.
+     * @param hook The serializer, needed for element types that are not trivially copyable.
+     * @throws std::system_error if the file cannot be created or written.
+     */
+    template<typename T, typename Allocator, typename GrowthPolicy, typename Serializer = detail::serializer_for<T>>
+    void save(const vector<T, Allocator, GrowthPolicy>& vec, const std::string& path, Serializer hook = Serializer());
+
+    /**
+     * @brief Replaces the contents of the vector with a snapshot read from a file descriptor.
+     *
+     * Reads from the current file offset. Raw payloads are read directly into the vector's
+     * storage. The checksum is verified before the function returns.
+     *
+     * @param vec The vector to load into.
+     * @param fd The file descriptor to read from.
+     * @param hook The serializer, needed for element types that are not trivially copyable.
+     * @throws std::system_error if reading fails.
+     * @throws std::runtime_error if the snapshot is truncated, corrupt or was written for a
+     *         different element type or byte order. The vector is left empty in that case.
+     */
+    template<typename T, typename Allocator, typename GrowthPolicy, typename Serializer = detail::serializer_for<T>>
+    void load(vector<T, Allocator, GrowthPolicy>& vec, int fd, Serializer hook = Serializer());
+
+    /**
+     * @brief Replaces the contents of the vector with a snapshot read from a file.
+     *
+     * @param vec The vector to load into.
+     * @param path The file to read.
+     * @param hook The serializer, needed for element types that are not trivially copyable.
+     * @throws std::system_error if the file cannot be opened or read.
+     * @throws std::runtime_error if the snapshot is invalid, see load(vec, fd).
+     */
+    template<typename T, typename Allocator, typename GrowthPolicy, typename Serializer = detail::serializer_for<T>>
+    void load(vector<T, Allocator, GrowthPolicy>& vec, const std::string& path, Serializer hook = Serializer());
+
+/**
+ * @brief Read-only, zero-copy access to a snapshot of trivially copyable elements.
+ *
+ * Maps the snapshot file and exposes the payload in place, so opening even a large snapshot
+ * only costs the mmap call and the header check. Pages are read as they are touched.
+ * Verifying the checksum reads the whole file, so it can be skipped.
+ *
+ * @tparam T The element type the snapshot was saved with.
+ */
+    template<typename T>
+    class snapshot_view {
+        static_assert(std::is_trivially_copyable<T>::value, "snapshot_view exposes the raw payload");
+
+        void* map_; /// Start of the mapping, which begins with the header
+        size_t mapped_bytes_; /// Length of the mapping
+        size_t size_; /// Number of elements
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using const_reference = const T&;
+        using const_pointer = const T*;
+        using const_iterator = detail::contiguous_iterator<const T, snapshot_view>;
+        using iterator = const_iterator;
+
+        /**
+         * @brief Maps a snapshot file.
+         *
+         * @param path The snapshot to map.
+         * @param verify Whether to check the payload against the checksum in the header.
+         * @throws std::system_error if the file cannot be opened or mapped.
+         * @throws std::runtime_error if the snapshot is invalid, see load(vec, fd).
+         */
+        explicit snapshot_view(const std::string& path, bool verify = true);
+
+        snapshot_view(const snapshot_view&) = delete;
+        snapshot_view& operator=(const snapshot_view&) = delete;
+
+        /**
+         * @brief Move constructor. The moved-from view is empty.
+         *
+         * @param other The view to move from.
+         */
+        snapshot_view(snapshot_view&& other) noexcept;
+
+        /**
+         * @brief Move assignment operator. Unmaps the current snapshot first.
+         *
+         * @param other The view to move from.
+         * @return A reference to the assigned view.
+         */
+        snapshot_view& operator=(snapshot_view&& other) noexcept;
+
+        /**
+         * @brief Destructor. Unmaps the snapshot.
+         */
+        ~snapshot_view();
+
+        /**
+         * @brief Accesses the element at the specified position.
+         *
+         * @param index The position of the element to access.
+         * @return A const reference to the element.
+         */
+        const T& operator[] (size_t index) const;
+
+        /**
+         * @brief Accesses the element at the specified position.
+         *
+         * @param index The position of the element to access.
+         * @return A const reference to the element.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        const T& at(size_t index) const;
+
+        /**
+         * @brief Returns an iterator to the first element.
+         */
+        const_iterator begin() const noexcept;
+
+        /**
+         * @brief Returns an iterator past the last element.
+         */
+        const_iterator end() const noexcept;
+
+        /**
+         * @brief Returns the number of elements in the snapshot.
+         */
+        [[nodiscard]] size_t size() const noexcept;
+
+        /**
+         * @brief Returns a pointer to the first element inside the mapping.
+         */
+        const T* data() const noexcept;
+    };
+
+} // namespace my_vector
+
+#include "snapshot_impl.h"
+
+#endif //VECTOR_SNAPSHOT_H
@@ -0,0 +1,431 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "posix_io.h"
+
+namespace my_vector {
+
+    namespace detail {
+
+    inline constexpr char snapshot_magic[8] = {'M', 'Y', 'V', 'E', 'C', 'S', 'N', 'P'};
+
+    inline uint8_t host_endianness() noexcept {
+      const uint16_t probe = 1;
+      unsigned char first;
+      std::memcpy(&first, &probe, 1);
+      return first == 1 ? 1 : 2;
+    }
+
+    inline uint64_t rotl64(uint64_t x, int r) noexcept {
+      return (x << r) | (x >> (64 - r));
+    }
+
+    inline uint64_t xxh64(const void* data, size_t length, uint64_t seed) noexcept {
+      constexpr uint64_t p1 = 11400714785074694791ULL;
+      constexpr uint64_t p2 = 14029467366897019727ULL;
+      constexpr uint64_t p3 = 1609587929392839161ULL;
+      constexpr uint64_t p4 = 9650029242287828579ULL;
+      constexpr uint64_t p5 = 2870177450012600261ULL;
+      const auto read64 = [](const unsigned char* p) {
+        uint64_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+      };
+      const auto round = [](uint64_t acc, uint64_t input) {
+        return rotl64(acc + input * p2, 31) * p1;
+      };
+      const auto merge = [&round](uint64_t acc, uint64_t v) {
+        return (acc ^ round(0, v)) * p1 + p4;
+      };
+
+      const unsigned char* p = static_cast<const unsigned char*>(data);
+      const unsigned char* const end = p + length;
+      uint64_t h;
+      if (length >= 32) {
+        uint64_t v1 = seed + p1 + p2;
+        uint64_t v2 = seed + p2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - p1;
+        for (; p + 32 <= end; p += 32) {
+          v1 = round(v1, read64(p));
+          v2 = round(v2, read64(p + 8));
+          v3 = round(v3, read64(p + 16));
+          v4 = round(v4, read64(p + 24));
+        }
+        h = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+        h = merge(h, v1);
+        h = merge(h, v2);
+        h = merge(h, v3);
+        h = merge(h, v4);
+      } else {
+        h = seed + p5;
+      }
+      h += static_cast<uint64_t>(length);
+      for (; p + 8 <= end; p += 8) {
+        h = rotl64(h ^ round(0, read64(p)), 27) * p1 + p4;
+      }
+      if (p + 4 <= end) {
+        uint32_t v;
+        std::memcpy(&v, p, sizeof(v));
+        h = rotl64(h ^ (static_cast<uint64_t>(v) * p1), 23) * p2 + p3;
+        p += 4;
+      }
+      for (; p < end; ++p) {
+        h = rotl64(h ^ (*p * p5), 11) * p1;
+      }
+      h ^= h >> 33;
+      h *= p2;
+      h ^= h >> 29;
+      h *= p3;
+      h ^= h >> 32;
+      return h;
+    }
+
+    template<typename T, bool Serialized>
+    snapshot_header make_snapshot_header(size_t count, const void* payload, size_t payload_bytes) noexcept {
+      snapshot_header header {};
+      std::memcpy(header.magic, snapshot_magic, sizeof(header.magic));
+      header.version = 1;
+      header.endianness = host_endianness();
+      header.serialized = Serialized;
+      header.element_size = sizeof(T);
+      header.element_align = alignof(T);
+      header.count = count;
+      header.payload_bytes = payload_bytes;
+      header.checksum = xxh64(payload, payload_bytes);
+      return header;
+    }
+
+    /**
+     * @brief Checks a header against the type the caller expects.
+     *
+     * @throws std::runtime_error if the snapshot cannot be read as T.
+     */
+    template<typename T>
+    void check_snapshot_header(const snapshot_header& header, bool serialized) {
+      if (std::memcmp(header.magic, snapshot_magic, sizeof(header.magic)) != 0) {
+        throw std::runtime_error("snapshot: not a snapshot file");
+      }
+      if (header.version != 1) {
+        throw std::runtime_error("snapshot: unsupported format version");
+      }
+      if (header.endianness != host_endianness()) {
+        throw std::runtime_error("snapshot: written with a different byte order");
+      }
+      if (header.serialized != serialized) {
+        throw std::runtime_error(serialized ? "snapshot: payload holds raw elements, not serialized ones"
+                                            : "snapshot: payload was written by a serializer");
+      }
+      if (!serialized && (header.element_size != sizeof(T) || header.element_align != alignof(T)
+                          || header.payload_bytes / sizeof(T) != header.count
+                          || header.payload_bytes % sizeof(T) != 0)) {
+        throw std::runtime_error("snapshot: written for a different element type");
+      }
+    }
+
+    inline void check_snapshot_checksum(const snapshot_header& header, const void* payload) {
+      if (xxh64(payload, static_cast<size_t>(header.payload_bytes)) != header.checksum) {
+        throw std::runtime_error("snapshot: checksum mismatch");
+      }
+    }
+
+    /**
+     * @brief Checks that a regular file holds the whole payload after the header just read.
+     *
+     * Runs before the payload buffer is allocated, so a truncated or corrupt header cannot
+     * force a huge allocation. Pipes and sockets have no length and are not checked.
+     *
+     * @throws std::runtime_error if the file is shorter than the header claims.
+     */
+    inline void check_snapshot_payload_fits(int fd, const snapshot_header& header) {
+      struct stat st {};
+      if (::fstat(fd, &st) != 0) {
+        throw_errno("snapshot: fstat");
+      }
+      if (!S_ISREG(st.st_mode)) {
+        return;
+      }
+      const off_t position = ::lseek(fd, 0, SEEK_CUR);
+      if (position < 0) {
+        throw_errno("snapshot: lseek");
+      }
+      const uint64_t left = st.st_size > position ? static_cast<uint64_t>(st.st_size - position) : 0;
+      if (header.payload_bytes > left) {
+        throw std::runtime_error("snapshot: file ends inside the payload");
+      }
+    }
+
+    } // namespace detail
+
+    inline void snapshot_writer::write(const void* data, size_t length) {
+      const unsigned char* bytes = static_cast<const unsigned char*>(data);
+      bytes_.append(bytes, bytes + length);
+    }
+
+    template<typename U>
+    void snapshot_writer::write_value(const U& value) {
+      static_assert(std::is_trivially_copyable<U>::value, "write_value copies the object representation");
+      write(&value, sizeof(U));
+    }
+
+    inline const vector<unsigned char>& snapshot_writer::bytes() const noexcept {
+      return bytes_;
+    }
+
+    inline snapshot_reader::snapshot_reader(const void* data, size_t length) noexcept
+        : next_(static_cast<const unsigned char*>(data)), end_(static_cast<const unsigned char*>(data) + length) {
+    }
+
+    inline void snapshot_reader::read(void* data, size_t length) {
+      if (length > remaining()) {
+        throw std::runtime_error("snapshot: payload ended early");
+      }
+      std::memcpy(data, next_, length);
+      next_ += length;
+    }
+
+    template<typename U>
+    U snapshot_reader::read_value() {
+      static_assert(std::is_trivially_copyable<U>::value, "read_value copies the object representation");
+      U value;
+      read(&value, sizeof(U));
+      return value;
+    }
+
+    inline size_t snapshot_reader::remaining() const noexcept {
+      return static_cast<size_t>(end_ - next_);
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy, typename Serializer>
+    void save(const vector<T, Allocator, GrowthPolicy>& vec, int fd, Serializer hook) {
+      iovec iov[2];
+      detail::snapshot_header header;
+      if constexpr (std::is_same<Serializer, detail::no_serializer>::value) {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "T is not trivially copyable, specialize my_vector::serializer<T> or pass a serializer");
+        (void) hook;
+        const size_t payload_bytes = vec.size() * sizeof(T);
+        header = detail::make_snapshot_header<T, false>(vec.size(), vec.data(), payload_bytes);
+        iov[0] = {&header, sizeof(header)};
+        iov[1] = {const_cast<T*>(vec.data()), payload_bytes};
+        detail::write_all(fd, iov, 2);
+      } else {
+        snapshot_writer out;
+        for (size_t i = 0; i < vec.size(); ++i) {
+          hook.save(vec[i], out);
+        }
+        const vector<unsigned char>& payload = out.bytes();
+        header = detail::make_snapshot_header<T, true>(vec.size(), payload.data(), payload.size());
+        iov[0] = {&header, sizeof(header)};
+        iov[1] = {const_cast<unsigned char*>(payload.data()), payload.size()};
+        detail::write_all(fd, iov, 2);
+      }
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy, typename Serializer>
+    void save(const vector<T, Allocator, GrowthPolicy>& vec, const std::string& path, Serializer hook) {
+      const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+      if (fd < 0) {
+        detail::throw_errno("snapshot: open");
+      }
+      try {
+        save(vec, fd, std::move(hook));
+      } catch (...) {
+        ::close(fd);
+        throw;
+      }
+      if (::close(fd) != 0) {
+        detail::throw_errno("snapshot: close");
+      }
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy, typename Serializer>
+    void load(vector<T, Allocator, GrowthPolicy>& vec, int fd, Serializer hook) {
+      constexpr bool serialized = !std::is_same<Serializer, detail::no_serializer>::value;
+      vec.clear();
+      try {
+        detail::snapshot_header header;
+        if (detail::read_all(fd, &header, sizeof(header)) != sizeof(header)) {
+          throw std::runtime_error("snapshot: file ends inside the header");
+        }
+        detail::check_snapshot_header<T>(header, serialized);
+        detail::check_snapshot_payload_fits(fd, header);
+        const size_t payload_bytes = static_cast<size_t>(header.payload_bytes);
+
+        if constexpr (!serialized) {
+          static_assert(std::is_trivially_copyable<T>::value,
+                        "T is not trivially copyable, specialize my_vector::serializer<T> or pass a serializer");
+          (void) hook;
+          const size_t count = static_cast<size_t>(header.count);
+          if constexpr (std::is_trivially_default_constructible<T>::value) {
+            vec.resize_for_overwrite(count);
+            if (detail::read_all(fd, vec.data(), payload_bytes) != payload_bytes) {
+              throw std::runtime_error("snapshot: file ends inside the payload");
+            }
+            detail::check_snapshot_checksum(header, vec.data());
+          } else {
+            vector<unsigned char> bytes;
+            bytes.resize_for_overwrite(payload_bytes);
+            if (detail::read_all(fd, bytes.data(), payload_bytes) != payload_bytes) {
+              throw std::runtime_error("snapshot: file ends inside the payload");
+            }
+            detail::check_snapshot_checksum(header, bytes.data());
+            vec.ensure_capacity(count);
+            for (size_t i = 0; i < count; ++i) {
+              T value;
+              std::memcpy(static_cast<void*>(&value), bytes.data() + i * sizeof(T), sizeof(T));
+              vec.push_back(value);
+            }
+          }
+        } else {
+          vector<unsigned char> bytes;
+          bytes.resize_for_overwrite(payload_bytes);
+          if (detail::read_all(fd, bytes.data(), payload_bytes) != payload_bytes) {
+            throw std::runtime_error("snapshot: file ends inside the payload");
+          }
+          detail::check_snapshot_checksum(header, bytes.data());
+          snapshot_reader in(bytes.data(), bytes.size());
+          // The checksum matched, but stay defensive about the count a serializer wrote.
+          vec.ensure_capacity(std::min(static_cast<size_t>(header.count), payload_bytes));
+          for (uint64_t i = 0; i < header.count; ++i) {
+            vec.push_back(hook.load(in));
+          }
+        }
+      } catch (...) {
+        vec.clear();
+        throw;
+      }
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy, typename Serializer>
+    void load(vector<T, Allocator, GrowthPolicy>& vec, const std::string& path, Serializer hook) {
+      const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+      if (fd < 0) {
+        detail::throw_errno("snapshot: open");
+      }
+      try {
+        load(vec, fd, std::move(hook));
+      } catch (...) {
+        ::close(fd);
+        throw;
+      }
+      ::close(fd);
+    }
+
+    template<typename T>
+    snapshot_view<T>::snapshot_view(const std::string& path, bool verify)
+        : map_(nullptr), mapped_bytes_(0), size_(0) {
+      const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+      if (fd < 0) {
+        detail::throw_errno("snapshot: open");
+      }
+      struct stat st {};
+      if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        detail::throw_errno("snapshot: fstat");
+      }
+      const size_t file_bytes = static_cast<size_t>(st.st_size);
+      if (file_bytes < sizeof(detail::snapshot_header)) {
+        ::close(fd);
+        throw std::runtime_error("snapshot: file ends inside the header");
+      }
+      void* p = ::mmap(nullptr, file_bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+      ::close(fd);
+      if (p == MAP_FAILED) {
+        detail::throw_errno("snapshot: mmap");
+      }
+      map_ = p;
+      mapped_bytes_ = file_bytes;
+      try {
+        const auto& header = *static_cast<const detail::snapshot_header*>(map_);
+        detail::check_snapshot_header<T>(header, false);
+        if (header.payload_bytes > file_bytes - sizeof(detail::snapshot_header)) {
+          throw std::runtime_error("snapshot: file ends inside the payload");
+        }
+        if (verify) {
+          detail::check_snapshot_checksum(header, static_cast<const unsigned char*>(map_) + sizeof(header));
+        }
+        size_ = static_cast<size_t>(header.count);
+      } catch (...) {
+        ::munmap(map_, mapped_bytes_);
+        throw;
+      }
+    }
+
+    template<typename T>
+    snapshot_view<T>::snapshot_view(snapshot_view&& other) noexcept
+        : map_(other.map_), mapped_bytes_(other.mapped_bytes_), size_(other.size_) {
+      other.map_ = nullptr;
+      other.mapped_bytes_ = 0;
+      other.size_ = 0;
+    }
+
+    template<typename T>
+    snapshot_view<T>& snapshot_view<T>::operator=(snapshot_view&& other) noexcept {
+      if (this != &other) {
+        if (map_) {
+          ::munmap(map_, mapped_bytes_);
+        }
+        map_ = other.map_;
+        mapped_bytes_ = other.mapped_bytes_;
+        size_ = other.size_;
+        other.map_ = nullptr;
+        other.mapped_bytes_ = 0;
+        other.size_ = 0;
+      }
+      return *this;
+    }
+
+    template<typename T>
+    snapshot_view<T>::~snapshot_view() {
+      if (map_) {
+        ::munmap(map_, mapped_bytes_);
+      }
+    }
+
+    template<typename T>
+    const T& snapshot_view<T>::operator[] (size_t index) const {
+      return data()[index];
+    }
+
+    template<typename T>
+    const T& snapshot_view<T>::at(size_t index) const {
+      if (index >= size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      return data()[index];
+    }
+
+    template<typename T>
+    typename snapshot_view<T>::const_iterator snapshot_view<T>::begin() const noexcept {
+      return const_iterator(data());
+    }
+
+    template<typename T>
+    typename snapshot_view<T>::const_iterator snapshot_view<T>::end() const noexcept {
+      return const_iterator(data() + size_);
+    }
+
+    template<typename T>
+    size_t snapshot_view<T>::size() const noexcept {
+      return size_;
+    }
+
+    template<typename T>
+    const T* snapshot_view<T>::data() const noexcept {
+      return map_ ? reinterpret_cast<const T*>(static_cast<const unsigned char*>(map_) + sizeof(detail::snapshot_header))
+                  : nullptr;
+    }
+
+} // namespace my_vector
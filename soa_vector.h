@@ -0,0 +1,625 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_SOA_VECTOR_H
+#define VECTOR_SOA_VECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "growth_policy.h"
+#include "relocation.h"
+#include "span.h"
+
+namespace my_vector {
+
+    namespace detail {
+
+    /**
+     * @brief Source for a soa_vector field that value-initializes it.
+     */
+    struct value_init_tag {};
+
+    template<typename T>
+    using value_init_for = value_init_tag;
+
+/**
+ * @brief Proxy reference to one element of a soa_vector: a reference to each of its fields.
+ *
+ * Assigning to the proxy assigns through to the fields, and converting it to value_type
+ * copies them out. Copying the proxy itself only copies the references. There is no way to
+ * move out of a proxy, so std algorithms that shuffle elements copy them.
+ *
+ * @tparam Ts The field types, const-qualified for a const_reference.
+ */
+    template<typename... Ts>
+    class soa_reference {
+        std::tuple<Ts&...> fields_; /// One reference per field
+
+        template<size_t... I>
+        static void swap_fields(const soa_reference& a, const soa_reference& b, std::index_sequence<I...>) {
+          using std::swap;
+          (swap(std::get<I>(a.fields_), std::get<I>(b.fields_)), ...);
+        }
+    public:
+        using value_type = std::tuple<std::remove_const_t<Ts>...>;
+
+        explicit soa_reference(Ts&... fields) noexcept : fields_(fields...) {}
+        soa_reference(const soa_reference& other) noexcept = default;
+
+        /**
+         * @brief Converts a reference into a const_reference.
+         */
+        template<typename... Us, typename = std::enable_if_t<(std::is_convertible<Us*, Ts*>::value && ...)>>
+        soa_reference(const soa_reference<Us...>& other) noexcept : fields_(other.fields()) {}
+
+        /**
+         * @brief Returns the references to the fields.
+         */
+        const std::tuple<Ts&...>& fields() const noexcept { return fields_; }
+
+        /**
+         * @brief Returns the field with index I.
+         */
+        template<size_t I>
+        std::tuple_element_t<I, std::tuple<Ts...>>& get() const noexcept { return std::get<I>(fields_); }
+
+        /**
+         * @brief Copies the fields out into a value_type.
+         */
+        operator value_type() const { return value_type(fields_); }
+
+        /**
+         * @brief Assigns the fields of another element to the fields of this one.
+         */
+        soa_reference& operator=(const soa_reference& other) {
+          fields_ = other.fields_;
+          return *this;
+        }
+
+        soa_reference& operator=(const value_type& value) {
+          fields_ = value;
+          return *this;
+        }
+
+        soa_reference& operator=(value_type&& value) {
+          fields_ = std::move(value);
+          return *this;
+        }
+
+        /**
+         * @brief Exchanges the fields of two elements.
+         */
+        friend void swap(const soa_reference& a, const soa_reference& b) {
+          swap_fields(a, b, std::index_sequence_for<Ts...>());
+        }
+    };
+
+    template<typename T>
+    struct is_soa_reference : std::false_type {};
+
+    template<typename... Ts>
+    struct is_soa_reference<soa_reference<Ts...>> : std::true_type {};
+
+    template<typename L, typename R>
+    using require_soa_reference = std::enable_if_t<is_soa_reference<L>::value || is_soa_reference<R>::value>;
+
+    /**
+     * @brief Returns the fields of a proxy or a value as a tuple, so the two can be compared.
+     */
+    template<typename... Ts>
+    const std::tuple<Ts&...>& soa_tie(const soa_reference<Ts...>& ref) noexcept {
+      return ref.fields();
+    }
+
+    template<typename... Ts>
+    const std::tuple<Ts...>& soa_tie(const std::tuple<Ts...>& value) noexcept {
+      return value;
+    }
+
+    template<typename L, typename R, typename = require_soa_reference<L, R>>
+    bool operator==(const L& lhs, const R& rhs) { return soa_tie(lhs) == soa_tie(rhs); }
+    template<typename L, typename R, typename = require_soa_reference<L, R>>
+    bool operator!=(const L& lhs, const R& rhs) { return soa_tie(lhs) != soa_tie(rhs); }
+    template<typename L, typename R, typename = require_soa_reference<L, R>>
+    bool operator<(const L& lhs, const R& rhs) { return soa_tie(lhs) < soa_tie(rhs); }
+    template<typename L, typename R, typename = require_soa_reference<L, R>>
+    bool operator>(const L& lhs, const R& rhs) { return soa_tie(lhs) > soa_tie(rhs); }
+    template<typename L, typename R, typename = require_soa_reference<L, R>>
+    bool operator<=(const L& lhs, const R& rhs) { return soa_tie(lhs) <= soa_tie(rhs); }
+    template<typename L, typename R, typename = require_soa_reference<L, R>>
+    bool operator>=(const L& lhs, const R& rhs) { return soa_tie(lhs) >= soa_tie(rhs); }
+
+/**
+ * @brief Random-access iterator that walks all field arrays of a soa_vector in step.
+ *
+ * Dereferencing yields a soa_reference, so the iterator meets the requirements of the std
+ * algorithms except that reference is not value_type&.
+ *
+ * @tparam Ts The field types, const-qualified for const iterators.
+ */
+    template<typename... Ts>
+    class soa_iterator {
+        std::tuple<Ts*...> data;
+        size_t index;
+
+        template<size_t... I>
+        soa_reference<Ts...> at(size_t position, std::index_sequence<I...>) const noexcept {
+          return soa_reference<Ts...>(std::get<I>(data)[position]...);
+        }
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::tuple<std::remove_const_t<Ts>...>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = soa_reference<Ts...>;
+
+        soa_iterator() noexcept : data(), index(0) {}
+        soa_iterator(const std::tuple<Ts*...>& data, size_t index) noexcept : data(data), index(index) {}
+
+        /**
+         * @brief Converts an iterator into a const_iterator.
+         */
+        template<typename... Us, typename = std::enable_if_t<(std::is_convertible<Us*, Ts*>::value && ...)>>
+        soa_iterator(const soa_iterator<Us...>& other) noexcept : data(other.fields()), index(other.position()) {}
+
+        /**
+         * @brief Returns the start of every field array.
+         */
+        const std::tuple<Ts*...>& fields() const noexcept { return data; }
+
+        /**
+         * @brief Returns the index of the element the iterator refers to.
+         */
+        size_t position() const noexcept { return index; }
+
+        reference operator*() const noexcept { return at(index, std::index_sequence_for<Ts...>()); }
+        reference operator[](difference_type n) const noexcept { return at(index + n, std::index_sequence_for<Ts...>()); }
+
+        soa_iterator& operator++() noexcept { ++index; return *this; }
+        soa_iterator operator++(int) noexcept { soa_iterator tmp = *this; ++index; return tmp; }
+        soa_iterator& operator--() noexcept { --index; return *this; }
+        soa_iterator operator--(int) noexcept { soa_iterator tmp = *this; --index; return tmp; }
+        soa_iterator& operator+=(difference_type n) noexcept { index += n; return *this; }
+        soa_iterator& operator-=(difference_type n) noexcept { index -= n; return *this; }
+
+        friend soa_iterator operator+(soa_iterator it, difference_type n) noexcept { return it += n; }
+        friend soa_iterator operator+(difference_type n, soa_iterator it) noexcept { return it += n; }
+        friend soa_iterator operator-(soa_iterator it, difference_type n) noexcept { return it -= n; }
+
+        template<typename... Us>
+        difference_type operator-(const soa_iterator<Us...>& other) const noexcept {
+          return static_cast<difference_type>(index) - static_cast<difference_type>(other.position());
+        }
+
+        template<typename... Us>
+        bool operator==(const soa_iterator<Us...>& other) const noexcept { return index == other.position(); }
+        template<typename... Us>
+        bool operator!=(const soa_iterator<Us...>& other) const noexcept { return index != other.position(); }
+        template<typename... Us>
+        bool operator<(const soa_iterator<Us...>& other) const noexcept { return index < other.position(); }
+        template<typename... Us>
+        bool operator>(const soa_iterator<Us...>& other) const noexcept { return index > other.position(); }
+        template<typename... Us>
+        bool operator<=(const soa_iterator<Us...>& other) const noexcept { return index <= other.position(); }
+        template<typename... Us>
+        bool operator>=(const soa_iterator<Us...>& other) const noexcept { return index >= other.position(); }
+    };
+
+    } // namespace detail
+
+/**
+ * @brief A vector of records stored as a structure of arrays: one contiguous array per field.
+ *
+ * A kernel that reads one or two fields streams through only those arrays instead of
+ * dragging whole records through the cache. All arrays live in a single allocation, each
+ * starting on a 64-byte boundary so it can be scanned with aligned vector loads, and they
+ * grow together on one growth decision, sized by the total bytes per element.
+ *
+ * Elements are accessed through soa_reference proxies, field<I>() returns one array as a
+ * span, and the iterators walk all arrays in step so std algorithms, including std::sort,
+ * work on whole records. Growth invalidates spans, references and iterators, as for vector.
+ *
+ * @tparam Ts The field types, each aligned to at most 64 bytes.
+ */
+    template<typename... Ts>
+    class soa_vector {
+        static_assert(sizeof...(Ts) > 0, "soa_vector needs at least one field");
+        static_assert(((alignof(Ts) <= 64) && ...), "soa_vector fields must be aligned to at most 64 bytes");
+        static_assert(((!std::is_const<Ts>::value && !std::is_reference<Ts>::value) && ...),
+                      "soa_vector fields must be non-const object types");
+
+        using pointers = std::tuple<Ts*...>;
+        using indices = std::index_sequence_for<Ts...>;
+
+        static constexpr size_t alignment = 64;
+        static constexpr size_t element_bytes = (sizeof(Ts) + ...);
+
+        pointers data_; /// The start of each field array, all within one block
+        size_t size_; /// Number of elements
+        size_t capacity_; /// Number of elements each field array can hold
+
+      /**
+       * @brief Returns the bytes a field array of the given capacity takes, rounded up to the alignment.
+       */
+        static size_t array_bytes(size_t capacity, size_t field_size) noexcept;
+
+      /**
+       * @brief Allocates the block for the given capacity and splits it into field arrays.
+       *
+       * @throws std::length_error if the block would not fit in size_t.
+       */
+        static pointers allocate(size_t capacity);
+
+      /**
+       * @brief Returns a block obtained from allocate to the heap.
+       */
+        static void deallocate(const pointers& data) noexcept;
+
+      /**
+       * @brief Constructs the fields of the element at index from a tuple with one source per field.
+       *
+       * A source of type detail::value_init_tag value-initializes its field. If a constructor
+       * throws, the fields built so far are destroyed again.
+       */
+        template<typename Sources, size_t... I>
+        static void construct_element(const pointers& data, size_t index, Sources&& sources, std::index_sequence<I...>);
+
+      /**
+       * @brief Destroys the elements [first, last) of every field array.
+       */
+        static void destroy_range(const pointers& data, size_t first, size_t last) noexcept;
+
+      /**
+       * @brief Moves count elements of every field array from one block to another.
+       *
+       * Relocates each array when all fields relocate without throwing. Otherwise it copies
+       * them, or moves the ones that cannot be copied, and destroys the source afterwards, so
+       * a throwing constructor leaves the source intact.
+       */
+        static void transfer(const pointers& from, const pointers& to, size_t count);
+
+      /**
+       * @brief Returns a tuple of references to the fields of the element at index.
+       */
+        template<size_t... I>
+        std::tuple<const Ts&...> field_refs(size_t index, std::index_sequence<I...>) const noexcept;
+
+      /**
+       * @brief Returns the start of every field array as pointers to const.
+       */
+        std::tuple<const Ts*...> const_data() const noexcept;
+
+      /**
+       * @brief Moves the elements into a block of the given capacity.
+       */
+        void reallocate(size_t new_capacity);
+
+      /**
+       * @brief Appends an element built from one source per field.
+       *
+       * On growth the element is built in the new block before the old elements move, so the
+       * sources may refer into this vector.
+       */
+        template<typename Sources>
+        void append_element(Sources&& sources);
+
+      /**
+       * @brief Appends copies of all elements of another vector, whose capacity must already suffice.
+       */
+        void append_copies(const soa_vector& other);
+
+      /**
+       * @brief Checks whether the vector holds no elements.
+       */
+        [[nodiscard]] bool is_empty() const noexcept;
+
+      /**
+       * @brief Destroys all elements and frees the block.
+       */
+        void destroy_and_deallocate() noexcept;
+    public:
+        using value_type = std::tuple<Ts...>;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = detail::soa_reference<Ts...>;
+        using const_reference = detail::soa_reference<const Ts...>;
+        using iterator = detail::soa_iterator<Ts...>;
+        using const_iterator = detail::soa_iterator<const Ts...>;
+
+        /**
+         * @brief The type of the field with index I.
+         */
+        template<size_t I>
+        using field_type = std::tuple_element_t<I, value_type>;
+
+        /**
+         * @brief Default constructor.
+         *
+         * Creates an empty vector without allocating.
+         */
+        soa_vector() noexcept;
+
+        /**
+         * @brief Constructor with initializer list.
+         *
+         * @param init The records to initialize the elements with.
+         */
+        soa_vector(std::initializer_list<value_type> init);
+
+        /**
+         * @brief Copy constructor.
+         *
+         * @param other The vector to copy from.
+         */
+        soa_vector(const soa_vector& other);
+
+        /**
+         * @brief Copy assignment operator.
+         *
+         * @param other The vector to copy from.
+         * @return A reference to the assigned vector.
+         */
+        soa_vector& operator=(const soa_vector& other);
+
+        /**
+         * @brief Move constructor. Takes over the block, so no element moves.
+         *
+         * @param other The vector to move from.
+         */
+        soa_vector(soa_vector&& other) noexcept;
+
+        /**
+         * @brief Move assignment operator.
+         *
+         * @param other The vector to move from.
+         * @return A reference to the assigned vector.
+         */
+        soa_vector& operator=(soa_vector&& other) noexcept;
+
+        /**
+         * @brief Destructor.
+         */
+        ~soa_vector();
+
+        /**
+         * @brief Appends a copy of the record, one field into each array.
+         *
+         * @param value The record to append.
+         */
+        void push_back(const value_type& value);
+
+        /**
+         * @brief Appends the record by moving its fields.
+         *
+         * @param value The record to append.
+         */
+        void push_back(value_type&& value);
+
+        /**
+         * @brief Constructs an element at the end from one argument per field.
+         *
+         * @param args The initial value of each field, in order.
+         * @return A proxy reference to the new element.
+         */
+        template<typename... Args>
+        reference emplace_back(Args&&... args);
+
+        /**
+         * @brief Removes the last element.
+         *
+         * @throws std::out_of_range if the vector is empty.
+         */
+        void pop_back();
+
+        /**
+         * @brief Removes the element at the specified position, shifting the later ones down.
+         *
+         * @param index The position of the element to remove.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        void erase(size_t index);
+
+        /**
+         * @brief Removes the element at the specified position by moving the last element into its place.
+         *
+         * Does not preserve order, but moves only one element per field.
+         *
+         * @param index The position of the element to remove.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        void swap_erase(size_t index);
+
+        /**
+         * @brief Changes the number of elements, value-initializing the fields of new ones.
+         *
+         * @param new_size The new number of elements.
+         */
+        void resize(size_t new_size);
+
+        /**
+         * @brief Changes the number of elements, copying the record into new ones.
+         *
+         * @param new_size The new number of elements.
+         * @param value The record to copy into new elements.
+         */
+        void resize(size_t new_size, const value_type& value);
+
+        /**
+         * @brief Accesses the element at the specified position.
+         *
+         * @param index The position of the element to access.
+         * @return A proxy reference to the element.
+         */
+        reference operator[] (size_t index) noexcept;
+
+        /**
+         * @brief Accesses the element at the specified position.
+         *
+         * @param index The position of the element to access.
+         * @return A const proxy reference to the element.
+         */
+        const_reference operator[] (size_t index) const noexcept;
+
+        /**
+         * @brief Accesses the element at the specified position with bounds checking.
+         *
+         * @param index The position of the element to access.
+         * @return A proxy reference to the element.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        reference at(size_t index);
+
+        /**
+         * @brief Accesses the element at the specified position with bounds checking.
+         *
+         * @param index The position of the element to access.
+         * @return A const proxy reference to the element.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        const_reference at(size_t index) const;
+
+        /**
+         * @brief Accesses the first element.
+         *
+         * @throws std::out_of_range if the vector is empty.
+         */
+        reference front();
+
+        /**
+         * @brief Accesses the first element.
+         *
+         * @throws std::out_of_range if the vector is empty.
+         */
+        const_reference front() const;
+
+        /**
+         * @brief Accesses the last element.
+         *
+         * @throws std::out_of_range if the vector is empty.
+         */
+        reference back();
+
+        /**
+         * @brief Accesses the last element.
+         *
+         * @throws std::out_of_range if the vector is empty.
+         */
+        const_reference back() const;
+
+        /**
+         * @brief Returns the array of field I.
+         */
+        template<size_t I>
+        span<field_type<I>> field() noexcept;
+
+        /**
+         * @brief Returns the array of field I.
+         */
+        template<size_t I>
+        span<const field_type<I>> field() const noexcept;
+
+        /**
+         * @brief Returns a pointer to the first element of the array of field I, aligned to 64 bytes.
+         */
+        template<size_t I>
+        field_type<I>* data() noexcept;
+
+        /**
+         * @brief Returns a pointer to the first element of the array of field I, aligned to 64 bytes.
+         */
+        template<size_t I>
+        const field_type<I>* data() const noexcept;
+
+        /**
+         * @brief Returns an iterator to the first element.
+         */
+        iterator begin() noexcept;
+
+        /**
+         * @brief Returns an iterator to the first element.
+         */
+        const_iterator begin() const noexcept;
+
+        /**
+         * @brief Returns an iterator past the last element.
+         */
+        iterator end() noexcept;
+
+        /**
+         * @brief Returns an iterator past the last element.
+         */
+        const_iterator end() const noexcept;
+
+        /**
+         * @brief Returns a const iterator to the first element.
+         */
+        const_iterator cbegin() const noexcept;
+
+        /**
+         * @brief Returns a const iterator past the last element.
+         */
+        const_iterator cend() const noexcept;
+
+        /**
+         * @brief Returns the number of elements.
+         */
+        [[nodiscard]] size_t size() const noexcept;
+
+        /**
+         * @brief Returns the number of elements each field array can hold without growing.
+         */
+        [[nodiscard]] size_t capacity() const noexcept;
+
+        /**
+         * @brief Ensures that every field array can hold at least the given number of elements.
+         *
+         * @param min_capacity The minimum capacity.
+         */
+        void ensure_capacity(size_t min_capacity);
+
+        /**
+         * @brief Reduces the capacity to the number of elements.
+         */
+        void shrink_to_fit();
+
+        /**
+         * @brief Destroys all elements but keeps the block.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Destroys all elements and frees the block.
+         */
+        void clear_and_free() noexcept;
+
+        /**
+         * @brief Exchanges the contents with another vector.
+         *
+         * @param other The vector to swap with.
+         */
+        void swap(soa_vector& other) noexcept;
+    };
+
+} // namespace my_vector
+
+namespace std {
+
+    template<typename... Ts>
+    struct tuple_size<my_vector::detail::soa_reference<Ts...>> : std::integral_constant<size_t, sizeof...(Ts)> {};
+
+    template<size_t I, typename... Ts>
+    struct tuple_element<I, my_vector::detail::soa_reference<Ts...>> {
+        using type = std::tuple_element_t<I, std::tuple<Ts...>>&;
+    };
+
+} // namespace std
+
+#include "soa_vector_impl.h"
+
+#endif //VECTOR_SOA_VECTOR_H
@@ -0,0 +1,486 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+
+namespace my_vector {
+
+    template<typename... Ts>
+    size_t soa_vector<Ts...>::array_bytes(size_t capacity, size_t field_size) noexcept {
+      return (capacity * field_size + alignment - 1) & ~(alignment - 1);
+    }
+
+    template<typename... Ts>
+    typename soa_vector<Ts...>::pointers soa_vector<Ts...>::allocate(size_t capacity) {
+      if (capacity == 0) {
+        return pointers();
+      }
+      if (capacity > (std::numeric_limits<size_t>::max() - sizeof...(Ts) * alignment) / element_bytes) {
+        throw std::length_error("soa_vector: capacity too large");
+      }
+      auto* block = static_cast<unsigned char*>(
+          ::operator new((array_bytes(capacity, sizeof(Ts)) + ...), std::align_val_t(alignment)));
+      size_t offset = 0;
+      // The braced list is evaluated left to right, so the arrays follow each other in field order.
+      return pointers{[&] {
+        auto* array = reinterpret_cast<Ts*>(block + offset);
+        offset += array_bytes(capacity, sizeof(Ts));
+        return array;
+      }()...};
+    }
+
+    template<typename... Ts>
+    void soa_vector<Ts...>::deallocate(const pointers& data) noexcept {
+      ::operator delete(std::get<0>(data), std::align_val_t(alignment));
+    }
+
+    namespace detail {
+
+    template<typename T, typename Source>
+    void construct_field(T* slot, Source&& source) {
+      ::new (static_cast<void*>(slot)) T(std::forward<Source>(source));
+    }
+
+    template<typename T>
+    void construct_field(T* slot, value_init_tag) {
+      ::new (static_cast<void*>(slot)) T();
+    }
+
+    } // namespace detail
+
+    template<typename... Ts>
+    template<typename Sources, size_t... I>
+    void soa_vector<Ts...>::construct_element(const pointers& data, size_t index, Sources&& sources,
+                                              std::index_sequence<I...>) {
+      size_t built = 0;
+      try {
+        ((detail::construct_field(std::get<I>(data) + index, std::get<I>(std::forward<Sources>(sources))), ++built), ...);
+      } catch (...) {
+        ((I < built ? std::get<I>(data)[index].~Ts() : void()), ...);
+        throw;
+      }
+    }
+
+    template<typename... Ts>
+    void soa_vector<Ts...>::destroy_range(const pointers& data, size_t first, size_t last) noexcept {
+      std::apply([&](Ts*... arrays) {
+        (std::destroy(arrays + first, arrays + last), ...);
+      }, data);
+    }
+
+    template<typename... Ts>
+    void soa_vector<Ts...>::transfer(const pointers& from, const pointers& to, size_t count) {
+      if constexpr ((detail::is_nothrow_relocatable_v<Ts> && ...)) {
+        std::apply([&](Ts*... sources) {
+          std::apply([&](Ts*... targets) {
+            auto relocate = [count](auto* source, auto* target) {
+              std::allocator<std::remove_pointer_t<decltype(source)>> alloc;
+              detail::relocate(alloc, source, count, target);
+            };
+            (relocate(sources, targets), ...);
+          }, to);
+        }, from);
+      } else {
+        size_t built = 0;
+        auto copy = [&](auto* source, auto* target) {
+          using T = std::remove_pointer_t<decltype(source)>;
+          if constexpr (std::is_copy_constructible<T>::value) {
+            std::uninitialized_copy_n(static_cast<const T*>(source), count, target);
+          } else {
+            std::uninitialized_move_n(source, count, target);
+          }
+          ++built;
+        };
+        std::apply([&](Ts*... sources) {
+          std::apply([&](Ts*... targets) {
+            try {
+              (copy(sources, targets), ...);
+            } catch (...) {
+              size_t field = 0;
+              ((field++ < built ? std::destroy_n(targets, count) : targets), ...);
+              throw;
+            }
+          }, to);
+        }, from);
+        destroy_range(from, 0, count);
+      }
+    }
+
+    template<typename... Ts>
+    template<size_t... I>
+    std::tuple<const Ts&...> soa_vector<Ts...>::field_refs(size_t index, std::index_sequence<I...>) const noexcept {
+      return std::tuple<const Ts&...>(std::get<I>(data_)[index]...);
+    }
+
+    template<typename... Ts>
+    std::tuple<const Ts*...> soa_vector<Ts...>::const_data() const noexcept {
+      return std::tuple<const Ts*...>(data_);
+    }
+
+    template<typename... Ts>
+    void soa_vector<Ts...>::reallocate(size_t new_capacity) {
+      const pointers new_data = allocate(new_capacity);
+      try {
+        transfer(data_, new_data, size_);
+      } catch (...) {
+        deallocate(new_data);
+        throw;
+      }
+      deallocate(data_);
+      data_ = new_data;
+      capacity_ = new_capacity;
+    }
+
+    template<typename... Ts>
+    template<typename Sources>
+    void soa_vector<Ts...>::append_element(Sources&& sources) {
+      if (size_ < capacity_) {
+        construct_element(data_, size_, std::forward<Sources>(sources), indices());
+        ++size_;
+        return;
+      }
+      const size_t new_capacity = double_growth::next_capacity(capacity_, size_ + 1, element_bytes);
+      const pointers new_data = allocate(new_capacity);
+      try {
+        construct_element(new_data, size_, std::forward<Sources>(sources), indices());
+      } catch (...) {
+        deallocate(new_data);
+        throw;
+      }
+      try {
+        transfer(data_, new_data, size_);
+      } catch (...) {
+        destroy_range(new_data, size_, size_ + 1);
+        deallocate(new_data);
+        throw;
+      }
+      deallocate(data_);
+      data_ = new_data;
+      capacity_ = new_capacity;
+      ++size_;
+    }
+
+    template<typename... Ts>
+    void soa_vector<Ts...>::append_copies(const soa_vector& other) {
+      for (size_t i = 0; i < other.size_; ++i) {
+        construct_element(data_, size_, other.field_refs(i, indices()), indices());
+        ++size_;
+      }
+    }
+
+    template<typename... Ts>
+    bool soa_vector<Ts...>::is_empty() const noexcept {
+      return size_ == 0;
+    }
+
+    template<typename... Ts>
+    void soa_vector<Ts...>::destroy_and_deallocate() noexcept {
+      destroy_range(data_, 0, size_);
+      deallocate(data_);
+      data_ = pointers();
+      size_ = 0;
+      capacity_ = 0;
+    }
+
+    template<typename... Ts>
+    soa_vector<Ts...>::soa_vector() noexcept : data_(), size_(0), capacity_(0) {
+    }
+
+    template<typename... Ts>
+    soa_vector<Ts...>::soa_vector(std::initializer_list<value_type> init) : soa_vector() {
+      try {
+        ensure_capacity(init.size());
+        for (const value_type& value : init) {
+          append_element(value);
+        }
+      } catch (...) {
+        destroy_and_deallocate();
+        throw;
+      }
+    }
+
+    template<typename... Ts>
+    soa_vector<Ts...>::soa_vector(const soa_vector& other) : soa_vector() {
+      try {
+        ensure_capacity(other.size_);
+        append_copies(other);
+      } catch (...) {
+        destroy_and_deallocate();
+        throw;
+      }
+    }
+
+    template<typename... Ts>
+    soa_vector<Ts...>& soa_vector<Ts...>::operator=(const soa_vector& other) {
+      if (this != &other) {
+        soa_vector copy(other);
+        swap(copy);
+      }
+      return *this;
+    }
+
+    template<typename... Ts>
+    soa_vector<Ts...>::soa_vector(soa_vector&& other) noexcept
+        : data_(std::exchange(other.data_, pointers())), size_(std::exchange(other.size_, 0)),
+          capacity_(std::exchange(other.capacity_, 0)) {
+    }
+
+    template<typename... Ts>
+    soa_vector<Ts...>& soa_vector<Ts...>::operator=(soa_vector&& other) noexcept {
+      if (this != &other) {
+        destroy_and_deallocate();
+        swap(other);
+      }
+      return *this;
+    }
+
+    template<typename... Ts>
+    soa_vector<Ts...>::~soa_vector() {
+      destroy_and_deallocate();
+    }
+
+    template<typename... Ts>
+    void soa_vector<Ts...>::push_back(const value_type& value) {
+      append_element(value);
+    }
+
+    template<typename... Ts>
+    void soa_vector<Ts...>::push_back(value_type&& value) {
+      append_element(std::move(value));
+    }
+
+    template<typename... Ts>
+    template<typename... Args>
+    typename soa_vector<Ts...>::reference soa_vector<Ts...>::emplace_back(Args&&... args) {
+      static_assert(sizeof...(Args) == sizeof...(Ts), "emplace_back takes one argument per field");
+      append_element(std::forward_as_tuple(std::forward<Args>(args)...));
+      return (*this)[size_ - 1];
+    }
+
+    template<typename... Ts>
+    void soa_vector<Ts...>::pop_back() {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      --size_;
+      destroy_range(data_, size_, size_ + 1);
+    }
+
+    template<typename... Ts>
+    void soa_vector<Ts...>::erase(size_t index) {
+      if (index >= size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      std::apply([&](Ts*... arrays) {
+        (std::move(arrays + index + 1, arrays + size_, arrays + index), ...);
+      }, data_);
+      pop_back();
+    }
+
+    template<typename... Ts>
+    void soa_vector<Ts...>::swap_erase(size_t index) {
+      if (index >= size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      if (index != size_ - 1) {
+        std::apply([&](Ts*... arrays) {
+          ((arrays[index] = std::move(arrays[size_ - 1])), ...);
+        }, data_);
+      }
+      pop_back();
+    }
+
+    template<typename... Ts>
+    void soa_vector<Ts...>::resize(size_t new_size) {
+      if (new_size <= size_) {
+        destroy_range(data_, new_size, size_);
+        size_ = new_size;
+        return;
+      }
+      ensure_capacity(new_size);
+      while (size_ < new_size) {
+        construct_element(data_, size_, std::tuple<detail::value_init_for<Ts>...>(), indices());
+        ++size_;
+      }
+    }
+
+    template<typename... Ts>
+    void soa_vector<Ts...>::resize(size_t new_size, const value_type& value) {
+      if (new_size <= size_) {
+        destroy_range(data_, new_size, size_);
+        size_ = new_size;
+        return;
+      }
+      // The value may refer into this vector, so copy it before growing moves the elements.
+      if (new_size > capacity_) {
+        const value_type copy(value);
+        ensure_capacity(new_size);
+        resize(new_size, copy);
+        return;
+      }
+      while (size_ < new_size) {
+        construct_element(data_, size_, value, indices());
+        ++size_;
+      }
+    }
+
+    template<typename... Ts>
+    typename soa_vector<Ts...>::reference soa_vector<Ts...>::operator[](size_t index) noexcept {
+      return begin()[index];
+    }
+
+    template<typename... Ts>
+    typename soa_vector<Ts...>::const_reference soa_vector<Ts...>::operator[](size_t index) const noexcept {
+      return begin()[index];
+    }
+
+    template<typename... Ts>
+    typename soa_vector<Ts...>::reference soa_vector<Ts...>::at(size_t index) {
+      if (index >= size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      return (*this)[index];
+    }
+
+    template<typename... Ts>
+    typename soa_vector<Ts...>::const_reference soa_vector<Ts...>::at(size_t index) const {
+      if (index >= size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      return (*this)[index];
+    }
+
+    template<typename... Ts>
+    typename soa_vector<Ts...>::reference soa_vector<Ts...>::front() {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      return (*this)[0];
+    }
+
+    template<typename... Ts>
+    typename soa_vector<Ts...>::const_reference soa_vector<Ts...>::front() const {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      return (*this)[0];
+    }
+
+    template<typename... Ts>
+    typename soa_vector<Ts...>::reference soa_vector<Ts...>::back() {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      return (*this)[size_ - 1];
+    }
+
+    template<typename... Ts>
+    typename soa_vector<Ts...>::const_reference soa_vector<Ts...>::back() const {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      return (*this)[size_ - 1];
+    }
+
+    template<typename... Ts>
+    template<size_t I>
+    span<typename soa_vector<Ts...>::template field_type<I>> soa_vector<Ts...>::field() noexcept {
+      return span<field_type<I>>(std::get<I>(data_), size_);
+    }
+
+    template<typename... Ts>
+    template<size_t I>
+    span<const typename soa_vector<Ts...>::template field_type<I>> soa_vector<Ts...>::field() const noexcept {
+      return span<const field_type<I>>(std::get<I>(data_), size_);
+    }
+
+    template<typename... Ts>
+    template<size_t I>
+    typename soa_vector<Ts...>::template field_type<I>* soa_vector<Ts...>::data() noexcept {
+      return std::get<I>(data_);
+    }
+
+    template<typename... Ts>
+    template<size_t I>
+    const typename soa_vector<Ts...>::template field_type<I>* soa_vector<Ts...>::data() const noexcept {
+      return std::get<I>(data_);
+    }
+
+    template<typename... Ts>
+    typename soa_vector<Ts...>::iterator soa_vector<Ts...>::begin() noexcept {
+      return iterator(data_, 0);
+    }
+
+    template<typename... Ts>
+    typename soa_vector<Ts...>::const_iterator soa_vector<Ts...>::begin() const noexcept {
+      return const_iterator(const_data(), 0);
+    }
+
+    template<typename... Ts>
+    typename soa_vector<Ts...>::iterator soa_vector<Ts...>::end() noexcept {
+      return iterator(data_, size_);
+    }
+
+    template<typename... Ts>
+    typename soa_vector<Ts...>::const_iterator soa_vector<Ts...>::end() const noexcept {
+      return const_iterator(const_data(), size_);
+    }
+
+    template<typename... Ts>
+    typename soa_vector<Ts...>::const_iterator soa_vector<Ts...>::cbegin() const noexcept {
+      return begin();
+    }
+
+    template<typename... Ts>
+    typename soa_vector<Ts...>::const_iterator soa_vector<Ts...>::cend() const noexcept {
+      return end();
+    }
+
+    template<typename... Ts>
+    size_t soa_vector<Ts...>::size() const noexcept {
+      return size_;
+    }
+
+    template<typename... Ts>
+    size_t soa_vector<Ts...>::capacity() const noexcept {
+      return capacity_;
+    }
+
+    template<typename... Ts>
+    void soa_vector<Ts...>::ensure_capacity(size_t min_capacity) {
+      if (min_capacity > capacity_) {
+        reallocate(double_growth::next_capacity(capacity_, min_capacity, element_bytes));
+      }
+    }
+
+    template<typename... Ts>
+    void soa_vector<Ts...>::shrink_to_fit() {
+      if (size_ < capacity_) {
+        reallocate(size_);
+      }
+    }
+
+    template<typename... Ts>
+    void soa_vector<Ts...>::clear() noexcept {
+      destroy_range(data_, 0, size_);
+      size_ = 0;
+    }
+
+    template<typename... Ts>
+    void soa_vector<Ts...>::clear_and_free() noexcept {
+      destroy_and_deallocate();
+    }
+
+    template<typename... Ts>
+    void soa_vector<Ts...>::swap(soa_vector& other) noexcept {
+      std::swap(data_, other.data_);
+      std::swap(size_, other.size_);
+      std::swap(capacity_, other.capacity_);
+    }
+
+} // namespace my_vector
@@ -0,0 +1,68 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_SPAN_H
+#define VECTOR_SPAN_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+namespace my_vector {
+
+/**
+ * @brief A view of count contiguous elements, a C++17 stand-in for std::span<T>.
+ *
+ * Does not own the elements. It has data() and size(), so the scans in algorithm.h accept it
+ * directly.
+ *
+ * @tparam T The element type, const-qualified for read-only views.
+ */
+    template<typename T>
+    class span {
+        T* data_; /// The first element
+        size_t size_; /// Number of elements
+    public:
+        using element_type = T;
+        using value_type = std::remove_cv_t<T>;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+        using iterator = T*;
+
+        constexpr span() noexcept : data_(nullptr), size_(0) {}
+        constexpr span(T* data, size_t size) noexcept : data_(data), size_(size) {}
+
+        /**
+         * @brief Converts a span into a span of const elements.
+         */
+        template<typename U, typename = std::enable_if_t<std::is_convertible<U(*)[], T(*)[]>::value>>
+        constexpr span(const span<U>& other) noexcept : data_(other.data()), size_(other.size()) {}
+
+        constexpr T* data() const noexcept { return data_; }
+        constexpr size_t size() const noexcept { return size_; }
+        [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+
+        constexpr T& operator[](size_t index) const noexcept { return data_[index]; }
+
+        constexpr T* begin() const noexcept { return data_; }
+        constexpr T* end() const noexcept { return data_ + size_; }
+
+        /**
+         * @brief Returns the view of count elements starting at offset.
+         *
+         * @throws std::out_of_range if the range does not lie within the span.
+         */
+        span subspan(size_t offset, size_t count) const {
+          if (offset > size_ || count > size_ - offset) {
+            throw std::out_of_range("Index out of range");
+          }
+          return span(data_ + offset, count);
+        }
+    };
+
+} // namespace my_vector
+
+#endif //VECTOR_SPAN_H
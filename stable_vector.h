@@ -0,0 +1,581 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_STABLE_VECTOR_H
+#define VECTOR_STABLE_VECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include "iterator.h"
+#include "vector.h"
+
+namespace my_vector {
+
+    namespace detail {
+
+    /**
+     * @brief Returns the default number of elements per stable_vector chunk.
+     *
+     * The largest power of two whose chunk fits in 16 KiB, and at least one.
+     */
+    template<typename T>
+    constexpr size_t default_chunk_size() noexcept {
+      size_t size = 1;
+      while (size * 2 * sizeof(T) <= 16384) {
+        size *= 2;
+      }
+      return size;
+    }
+
+    } // namespace detail
+
+/**
+ * @brief A vector whose elements never move when it grows.
+ *
+ * Elements live in fixed-size chunks of ChunkSize elements, and a vector of chunk pointers
+ * maps an index to its chunk with a shift and a mask. Growing allocates one more chunk
+ * and appends its pointer. Existing elements are never copied, so pointers and references
+ * to them stay valid across push_back, emplace_back, append, resize and ensure_capacity.
+ * The worst-case cost of an append is one chunk allocation plus an occasional doubling of
+ * the chunk index, which holds capacity / ChunkSize pointers.
+ *
+ * Inserting or erasing in the middle shifts the later elements by move assignment, just
+ * like vector. References past the insertion or erasure point then refer to different values.
+ *
+ * @tparam T The type of elements stored in the vector.
+ * @tparam Allocator The allocator used to obtain chunks.
+ * @tparam ChunkSize The number of elements per chunk, a power of two.
+ */
+    template<typename T, typename Allocator = std::allocator<T>, size_t ChunkSize = detail::default_chunk_size<T>()>
+    class stable_vector : private detail::allocator_holder<Allocator> {
+        static_assert(ChunkSize > 0 && (ChunkSize & (ChunkSize - 1)) == 0, "ChunkSize must be a power of two");
+
+        using alloc_traits = std::allocator_traits<Allocator>;
+        using detail::allocator_holder<Allocator>::allocator;
+        using chunk_index = vector<T*, typename alloc_traits::template rebind_alloc<T*>>;
+
+        chunk_index chunks_; /// Pointers to the chunks; chunk i holds the elements from i * ChunkSize on
+        size_t size_; /// Number of elements in the vector
+
+      /**
+       * @brief Allocates one more chunk and appends it to the chunk index.
+       */
+        void add_chunk();
+
+      /**
+       * @brief Appends an element constructed from args, adding a chunk if all are full.
+       */
+        template<typename... Args>
+        T& construct_back(Args&&... args);
+
+      /**
+       * @brief Moves the elements appended after old_size to the given position.
+       *
+       * The elements [index, old_size) are shifted behind them.
+       *
+       * @param index The position where the appended elements should end up.
+       * @param old_size The size before the elements were appended.
+       */
+        void rotate_tail(size_t index, size_t old_size);
+
+      /**
+       * @brief Destroys the elements [new_size, size_) and sets the size to new_size.
+       */
+        void truncate(size_t new_size) noexcept;
+
+      /**
+       * @brief Checks if the vector is empty.
+       *
+       * @return True if the vector is empty, false otherwise.
+       */
+        bool is_empty() const noexcept;
+
+      /**
+       * @brief Destroys all elements and returns every chunk to the allocator.
+       */
+        void destroy_and_deallocate() noexcept;
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using iterator = detail::index_iterator<T, stable_vector>;
+        using const_iterator = detail::index_iterator<const T, const stable_vector>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        /**
+         * @brief The number of elements per chunk.
+         */
+        static constexpr size_t chunk_size = ChunkSize;
+
+        /**
+         * @brief Default constructor.
+         *
+         * Creates an empty vector without allocating.
+         */
+        stable_vector() noexcept(std::is_nothrow_default_constructible<Allocator>::value);
+
+        /**
+         * @brief Constructs an empty vector that obtains its chunks from the given allocator.
+         *
+         * @param alloc The allocator to use.
+         */
+        explicit stable_vector(const Allocator& alloc) noexcept;
+
+        /**
+         * @brief Constructor with size and value.
+         *
+         * @param size The number of elements to initialize.
+         * @param value The value to initialize each element with.
+         * @param alloc The allocator to use.
+         */
+        stable_vector(size_t size, const T& value, const Allocator& alloc = Allocator());
+
+        /**
+         * @brief Copy constructor.
+         *
+         * @param other The vector to copy from.
+         */
+        stable_vector(const stable_vector& other);
+
+        /**
+         * @brief Constructs the vector from an initializer list.
+         *
+         * @param init The elements to copy.
+         * @param alloc The allocator to use.
+         */
+        stable_vector(std::initializer_list<T> init, const Allocator& alloc = Allocator());
+
+        /**
+         * @brief Constructs the vector from the range [first, last).
+         *
+         * @param first The beginning of the range.
+         * @param last The end of the range.
+         * @param alloc The allocator to use.
+         */
+        template<typename InputIt, typename = detail::require_input_iterator<InputIt>>
+        stable_vector(InputIt first, InputIt last, const Allocator& alloc = Allocator());
+
+        /**
+         * @brief Copy assignment operator.
+         *
+         * @param other The vector to copy from.
+         * @return A reference to the assigned vector.
+         */
+        stable_vector& operator=(const stable_vector& other);
+
+        /**
+         * @brief Move constructor. Takes over the chunks, so no element moves.
+         *
+         * @param other The vector to move from.
+         */
+        stable_vector(stable_vector&& other) noexcept;
+
+        /**
+         * @brief Move assignment operator.
+         *
+         * Takes over the chunks if the allocators propagate or compare equal, and moves the
+         * elements one by one otherwise.
+         *
+         * @param other The vector to move from.
+         * @return A reference to the assigned vector.
+         */
+        stable_vector& operator=(stable_vector&& other)
+            noexcept(alloc_traits::propagate_on_container_move_assignment::value
+                     || alloc_traits::is_always_equal::value);
+
+        /**
+         * @brief Destructor.
+         */
+        ~stable_vector();
+
+        /**
+         * @brief Accesses the element at the specified position.
+         *
+         * @param index The position of the element to access.
+         * @return A reference to the element.
+         */
+        T& operator[] (size_t index);
+
+        /**
+         * @brief Accesses the element at the specified position.
+         *
+         * @param index The position of the element to access.
+         * @return A const reference to the element.
+         */
+        const T& operator[] (size_t index) const;
+
+        /**
+         * @brief Returns an iterator to the first element.
+         */
+        iterator begin() noexcept;
+
+        /**
+         * @brief Returns an iterator to the first element.
+         */
+        const_iterator begin() const noexcept;
+
+        /**
+         * @brief Returns an iterator past the last element.
+         */
+        iterator end() noexcept;
+
+        /**
+         * @brief Returns an iterator past the last element.
+         */
+        const_iterator end() const noexcept;
+
+        /**
+         * @brief Returns a const iterator to the first element.
+         */
+        const_iterator cbegin() const noexcept;
+
+        /**
+         * @brief Returns a const iterator past the last element.
+         */
+        const_iterator cend() const noexcept;
+
+        /**
+         * @brief Returns a reverse iterator to the last element.
+         */
+        reverse_iterator rbegin() noexcept;
+
+        /**
+         * @brief Returns a reverse iterator to the last element.
+         */
+        const_reverse_iterator rbegin() const noexcept;
+
+        /**
+         * @brief Returns a reverse iterator before the first element.
+         */
+        reverse_iterator rend() noexcept;
+
+        /**
+         * @brief Returns a reverse iterator before the first element.
+         */
+        const_reverse_iterator rend() const noexcept;
+
+        /**
+         * @brief Adds an element to the end of the vector. Existing elements do not move.
+         *
+         * @param value The value to add, which may be an element of this vector.
+         */
+        void push_back(const T& value);
+
+        /**
+         * @brief Adds an element to the end of the vector using move semantics.
+         *
+         * @param value The value to add.
+         */
+        void push_back(T&& value);
+
+        /**
+         * @brief Constructs an element in place at the end of the vector.
+         *
+         * @param args The arguments for the constructor of T.
+         * @return A reference to the new element.
+         */
+        template<typename... Args>
+        T& emplace_back(Args&&... args);
+
+        /**
+         * @brief Constructs an element in place before the element at the specified position.
+         *
+         * @param index The position to insert at, at most size().
+         * @param args The arguments for the constructor of T.
+         * @return A reference to the new element.
+         * @throws std::out_of_range if the index is greater than size().
+         */
+        template<typename... Args>
+        T& emplace(size_t index, Args&&... args);
+
+        /**
+         * @brief Appends the range [first, last) to the end of the vector.
+         *
+         * The range may refer to elements of this vector.
+         *
+         * @param first The beginning of the range.
+         * @param last The end of the range.
+         */
+        template<typename InputIt, typename = detail::require_input_iterator<InputIt>>
+        void append(InputIt first, InputIt last);
+
+        /**
+         * @brief Appends the elements of an initializer list to the end of the vector.
+         *
+         * @param init The elements to append.
+         */
+        void append(std::initializer_list<T> init);
+
+        /**
+         * @brief Inserts the range [first, last) before the element at the specified position.
+         *
+         * @param index The position to insert at, at most size().
+         * @param first The beginning of the range.
+         * @param last The end of the range.
+         * @throws std::out_of_range if the index is greater than size().
+         */
+        template<typename InputIt, typename = detail::require_input_iterator<InputIt>>
+        void insert(size_t index, InputIt first, InputIt last);
+
+        /**
+         * @brief Inserts count copies of value before the element at the specified position.
+         *
+         * @param index The position to insert at, at most size().
+         * @param count The number of copies to insert.
+         * @param value The value to copy, which may be an element of this vector.
+         * @throws std::out_of_range if the index is greater than size().
+         */
+        void insert(size_t index, size_t count, const T& value);
+
+        /**
+         * @brief Inserts the elements of an initializer list before the element at the specified position.
+         *
+         * @param index The position to insert at, at most size().
+         * @param init The elements to insert.
+         * @throws std::out_of_range if the index is greater than size().
+         */
+        void insert(size_t index, std::initializer_list<T> init);
+
+        /**
+         * @brief Replaces the contents with count copies of value.
+         *
+         * @param count The new size of the vector.
+         * @param value The value to copy.
+         */
+        void assign(size_t count, const T& value);
+
+        /**
+         * @brief Replaces the contents with the range [first, last), keeping the chunks.
+         *
+         * @param first The beginning of the range.
+         * @param last The end of the range.
+         */
+        template<typename InputIt, typename = detail::require_input_iterator<InputIt>>
+        void assign(InputIt first, InputIt last);
+
+        /**
+         * @brief Replaces the contents with the elements of an initializer list.
+         *
+         * @param init The elements to copy.
+         */
+        void assign(std::initializer_list<T> init);
+
+        /**
+         * @brief Adds an element to the front of the vector.
+         *
+         * Shifts every element, so this is O(n).
+         *
+         * @param value The value to add.
+         */
+        void push_front(const T& value);
+
+        /**
+         * @brief Adds an element to the front of the vector using move semantics.
+         *
+         * @param value The value to add.
+         */
+        void push_front(T&& value);
+
+        /**
+         * @brief Clears the contents of the vector, keeping the chunks.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Clears the contents of the vector and frees every chunk.
+         */
+        void clear_and_free() noexcept;
+
+        /**
+         * @brief Swaps the contents of this vector with another vector.
+         *
+         * @param other The vector to swap with.
+         */
+        void swap(stable_vector& other) noexcept;
+
+        /**
+         * @brief Returns a copy of the allocator associated with the vector.
+         */
+        allocator_type get_allocator() const noexcept;
+
+        /**
+         * @brief Returns the number of elements in the vector.
+         */
+        [[nodiscard]] size_t size() const noexcept;
+
+        /**
+         * @brief Returns the number of elements the allocated chunks can hold.
+         */
+        [[nodiscard]] size_t capacity() const noexcept;
+
+        /**
+         * @brief Accesses the element at the specified position.
+         *
+         * @param index The position of the element to access.
+         * @return A reference to the element.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        T& at(size_t index);
+
+        /**
+         * @brief Accesses the element at the specified position.
+         *
+         * @param index The position of the element to access.
+         * @return A const reference to the element.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        const T& at(size_t index) const;
+
+        /**
+         * @brief Returns the first element.
+         *
+         * @throws std::out_of_range if the vector is empty.
+         */
+        T& front();
+
+        /**
+         * @brief Returns the first element.
+         *
+         * @throws std::out_of_range if the vector is empty.
+         */
+        const T& front() const;
+
+        /**
+         * @brief Returns the last element.
+         *
+         * @throws std::out_of_range if the vector is empty.
+         */
+        T& back();
+
+        /**
+         * @brief Returns the last element.
+         *
+         * @throws std::out_of_range if the vector is empty.
+         */
+        const T& back() const;
+
+        /**
+         * @brief Removes the last element.
+         *
+         * @throws std::out_of_range if the vector is empty.
+         */
+        void pop_back();
+
+        /**
+         * @brief Removes the first element, shifting the others. This is O(n).
+         *
+         * @throws std::out_of_range if the vector is empty.
+         */
+        void pop_front();
+
+        /**
+         * @brief Removes the element at the specified position.
+         *
+         * @param index The position of the element to remove.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        void erase(size_t index);
+
+        /**
+         * @brief Removes the elements in the range [first, last).
+         *
+         * @param first The position of the first element to remove.
+         * @param last The position past the last element to remove.
+         * @throws std::out_of_range if the range is invalid.
+         */
+        void erase(size_t first, size_t last);
+
+        /**
+         * @brief Removes the element at the iterator position.
+         *
+         * @param pos An iterator to the element to remove.
+         * @return An iterator to the element that followed the removed one.
+         */
+        iterator erase(const_iterator pos);
+
+        /**
+         * @brief Removes the elements in the iterator range [first, last).
+         *
+         * @param first An iterator to the first element to remove.
+         * @param last An iterator past the last element to remove.
+         * @return An iterator to the element that followed the removed ones.
+         */
+        iterator erase(const_iterator first, const_iterator last);
+
+        /**
+         * @brief Removes the element at the specified position by moving the last element into its place.
+         *
+         * O(1), but does not preserve the order of elements.
+         *
+         * @param index The position of the element to remove.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        void swap_erase(size_t index);
+
+        /**
+         * @brief Resizes the vector, value-initializing new elements. Existing elements do not move.
+         *
+         * @param new_size The new size of the vector.
+         */
+        void resize(size_t new_size);
+
+        /**
+         * @brief Resizes the vector, copying value into new elements.
+         *
+         * @param new_size The new size of the vector.
+         * @param value The value to copy.
+         */
+        void resize(size_t new_size, const T& value);
+
+        /**
+         * @brief Frees the chunks that hold no elements.
+         */
+        void shrink_to_fit();
+
+        /**
+         * @brief Allocates chunks until the vector can hold at least min_capacity elements.
+         *
+         * Only the chunk index may be reallocated; no element moves.
+         *
+         * @param min_capacity The minimum capacity to ensure.
+         */
+        void ensure_capacity(size_t min_capacity);
+
+        /**
+         * @brief Returns the number of allocated chunks.
+         */
+        [[nodiscard]] size_t chunk_count() const noexcept;
+
+        /**
+         * @brief Returns a pointer to the first element of a chunk, for bulk processing.
+         *
+         * Chunk i holds the elements [i * chunk_size, min(size(), (i + 1) * chunk_size)).
+         *
+         * @param index The chunk to return, less than chunk_count().
+         */
+        T* chunk(size_t index) noexcept;
+
+        /**
+         * @brief Returns a const pointer to the first element of a chunk.
+         *
+         * @param index The chunk to return, less than chunk_count().
+         */
+        const T* chunk(size_t index) const noexcept;
+    };
+
+} // namespace my_vector
+
+#include "stable_vector_impl.h"
+
+#endif //VECTOR_STABLE_VECTOR_H
@@ -0,0 +1,560 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace my_vector {
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::add_chunk() {
+      T* chunk = alloc_traits::allocate(allocator(), ChunkSize);
+      try {
+        chunks_.push_back(chunk);
+      } catch (...) {
+        alloc_traits::deallocate(allocator(), chunk, ChunkSize);
+        throw;
+      }
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    template<typename... Args>
+    T& stable_vector<T, Allocator, ChunkSize>::construct_back(Args&&... args) {
+      if (size_ == chunks_.size() * ChunkSize) {
+        add_chunk();
+      }
+      T* slot = chunks_[size_ / ChunkSize] + size_ % ChunkSize;
+      alloc_traits::construct(allocator(), slot, std::forward<Args>(args)...);
+      ++size_;
+      return *slot;
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::rotate_tail(size_t index, size_t old_size) {
+      std::rotate(begin() + index, begin() + old_size, end());
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::truncate(size_t new_size) noexcept {
+      if constexpr (!std::is_trivially_destructible<T>::value) {
+        for (size_t i = new_size; i < size_; ++i) {
+          alloc_traits::destroy(allocator(), &(*this)[i]);
+        }
+      }
+      size_ = new_size;
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    bool stable_vector<T, Allocator, ChunkSize>::is_empty() const noexcept {
+      return size_ == 0;
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::destroy_and_deallocate() noexcept {
+      truncate(0);
+      for (size_t i = 0; i < chunks_.size(); ++i) {
+        alloc_traits::deallocate(allocator(), chunks_[i], ChunkSize);
+      }
+      chunks_.clear_and_free();
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    stable_vector<T, Allocator, ChunkSize>::stable_vector()
+        noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+        : chunks_(), size_(0) {
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    stable_vector<T, Allocator, ChunkSize>::stable_vector(const Allocator& alloc) noexcept
+        : detail::allocator_holder<Allocator>(alloc), chunks_(typename chunk_index::allocator_type(alloc)), size_(0) {
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    stable_vector<T, Allocator, ChunkSize>::stable_vector(size_t size, const T& value, const Allocator& alloc)
+        : stable_vector(alloc) {
+      try {
+        ensure_capacity(size);
+        while (size_ < size) {
+          construct_back(value);
+        }
+      } catch (...) {
+        destroy_and_deallocate();
+        throw;
+      }
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    stable_vector<T, Allocator, ChunkSize>::stable_vector(const stable_vector& other)
+        : stable_vector(alloc_traits::select_on_container_copy_construction(other.allocator())) {
+      try {
+        append(other.begin(), other.end());
+      } catch (...) {
+        destroy_and_deallocate();
+        throw;
+      }
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    stable_vector<T, Allocator, ChunkSize>::stable_vector(std::initializer_list<T> init, const Allocator& alloc)
+        : stable_vector(init.begin(), init.end(), alloc) {
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    template<typename InputIt, typename>
+    stable_vector<T, Allocator, ChunkSize>::stable_vector(InputIt first, InputIt last, const Allocator& alloc)
+        : stable_vector(alloc) {
+      try {
+        append(first, last);
+      } catch (...) {
+        destroy_and_deallocate();
+        throw;
+      }
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    stable_vector<T, Allocator, ChunkSize>& stable_vector<T, Allocator, ChunkSize>::operator=(const stable_vector& other) {
+      if (this != &other) {
+        if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+          if (allocator() != other.allocator()) {
+            destroy_and_deallocate();
+          }
+          allocator() = other.allocator();
+        }
+        clear();
+        append(other.begin(), other.end());
+      }
+      return *this;
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    stable_vector<T, Allocator, ChunkSize>::stable_vector(stable_vector&& other) noexcept
+        : detail::allocator_holder<Allocator>(std::move(other.allocator())), chunks_(std::move(other.chunks_)),
+          size_(other.size_) {
+      other.size_ = 0;
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    stable_vector<T, Allocator, ChunkSize>& stable_vector<T, Allocator, ChunkSize>::operator=(stable_vector&& other)
+        noexcept(alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value) {
+      if (this != &other) {
+        destroy_and_deallocate();
+
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+          allocator() = std::move(other.allocator());
+        } else if (allocator() != other.allocator()) {
+          // Chunks cannot change hands between unequal allocators, move element-wise instead.
+          ensure_capacity(other.size_);
+          for (size_t i = 0; i < other.size_; ++i) {
+            construct_back(std::move(other[i]));
+          }
+          return *this;
+        }
+        chunks_ = std::move(other.chunks_);
+        size_ = other.size_;
+        other.size_ = 0;
+      }
+      return *this;
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    stable_vector<T, Allocator, ChunkSize>::~stable_vector() {
+      destroy_and_deallocate();
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    T& stable_vector<T, Allocator, ChunkSize>::operator[] (size_t index) {
+      return chunks_[index / ChunkSize][index % ChunkSize];
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    const T& stable_vector<T, Allocator, ChunkSize>::operator[] (size_t index) const {
+      return chunks_[index / ChunkSize][index % ChunkSize];
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    typename stable_vector<T, Allocator, ChunkSize>::iterator stable_vector<T, Allocator, ChunkSize>::begin() noexcept {
+      return iterator(this, 0);
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    typename stable_vector<T, Allocator, ChunkSize>::const_iterator
+    stable_vector<T, Allocator, ChunkSize>::begin() const noexcept {
+      return const_iterator(this, 0);
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    typename stable_vector<T, Allocator, ChunkSize>::iterator stable_vector<T, Allocator, ChunkSize>::end() noexcept {
+      return iterator(this, size_);
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    typename stable_vector<T, Allocator, ChunkSize>::const_iterator
+    stable_vector<T, Allocator, ChunkSize>::end() const noexcept {
+      return const_iterator(this, size_);
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    typename stable_vector<T, Allocator, ChunkSize>::const_iterator
+    stable_vector<T, Allocator, ChunkSize>::cbegin() const noexcept {
+      return begin();
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    typename stable_vector<T, Allocator, ChunkSize>::const_iterator
+    stable_vector<T, Allocator, ChunkSize>::cend() const noexcept {
+      return end();
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    typename stable_vector<T, Allocator, ChunkSize>::reverse_iterator
+    stable_vector<T, Allocator, ChunkSize>::rbegin() noexcept {
+      return reverse_iterator(end());
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    typename stable_vector<T, Allocator, ChunkSize>::const_reverse_iterator
+    stable_vector<T, Allocator, ChunkSize>::rbegin() const noexcept {
+      return const_reverse_iterator(end());
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    typename stable_vector<T, Allocator, ChunkSize>::reverse_iterator
+    stable_vector<T, Allocator, ChunkSize>::rend() noexcept {
+      return reverse_iterator(begin());
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    typename stable_vector<T, Allocator, ChunkSize>::const_reverse_iterator
+    stable_vector<T, Allocator, ChunkSize>::rend() const noexcept {
+      return const_reverse_iterator(begin());
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::push_back(const T& value) {
+      construct_back(value);
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::push_back(T&& value) {
+      construct_back(std::move(value));
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    template<typename... Args>
+    T& stable_vector<T, Allocator, ChunkSize>::emplace_back(Args&&... args) {
+      return construct_back(std::forward<Args>(args)...);
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    template<typename... Args>
+    T& stable_vector<T, Allocator, ChunkSize>::emplace(size_t index, Args&&... args) {
+      if (index > size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      if (index == size_) {
+        return construct_back(std::forward<Args>(args)...);
+      }
+      T value(std::forward<Args>(args)...);
+      construct_back(std::move((*this)[size_ - 1]));
+      for (size_t i = size_ - 2; i > index; --i) {
+        (*this)[i] = std::move((*this)[i - 1]);
+      }
+      (*this)[index] = std::move(value);
+      return (*this)[index];
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    template<typename InputIt, typename>
+    void stable_vector<T, Allocator, ChunkSize>::append(InputIt first, InputIt last) {
+      if constexpr (detail::is_forward_iterator_v<InputIt>) {
+        ensure_capacity(size_ + static_cast<size_t>(std::distance(first, last)));
+      }
+      for (; first != last; ++first) {
+        construct_back(*first);
+      }
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::append(std::initializer_list<T> init) {
+      append(init.begin(), init.end());
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    template<typename InputIt, typename>
+    void stable_vector<T, Allocator, ChunkSize>::insert(size_t index, InputIt first, InputIt last) {
+      if (index > size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      const size_t old_size = size_;
+      try {
+        append(first, last);
+      } catch (...) {
+        truncate(old_size);
+        throw;
+      }
+      rotate_tail(index, old_size);
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::insert(size_t index, size_t count, const T& value) {
+      if (index > size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      const size_t old_size = size_;
+      try {
+        ensure_capacity(size_ + count);
+        for (size_t i = 0; i < count; ++i) {
+          construct_back(value);
+        }
+      } catch (...) {
+        truncate(old_size);
+        throw;
+      }
+      rotate_tail(index, old_size);
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::insert(size_t index, std::initializer_list<T> init) {
+      insert(index, init.begin(), init.end());
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::assign(size_t count, const T& value) {
+      T copy(value);
+      clear();
+      ensure_capacity(count);
+      for (size_t i = 0; i < count; ++i) {
+        construct_back(copy);
+      }
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    template<typename InputIt, typename>
+    void stable_vector<T, Allocator, ChunkSize>::assign(InputIt first, InputIt last) {
+      clear();
+      append(first, last);
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::assign(std::initializer_list<T> init) {
+      assign(init.begin(), init.end());
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::push_front(const T& value) {
+      emplace(0, value);
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::push_front(T&& value) {
+      emplace(0, std::move(value));
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::clear() noexcept {
+      truncate(0);
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::clear_and_free() noexcept {
+      destroy_and_deallocate();
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::swap(stable_vector& other) noexcept {
+      if constexpr (alloc_traits::propagate_on_container_swap::value) {
+        using std::swap;
+        swap(allocator(), other.allocator());
+      }
+      chunks_.swap(other.chunks_);
+      std::swap(size_, other.size_);
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    typename stable_vector<T, Allocator, ChunkSize>::allocator_type
+    stable_vector<T, Allocator, ChunkSize>::get_allocator() const noexcept {
+      return allocator();
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    size_t stable_vector<T, Allocator, ChunkSize>::size() const noexcept {
+      return size_;
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    size_t stable_vector<T, Allocator, ChunkSize>::capacity() const noexcept {
+      return chunks_.size() * ChunkSize;
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    T& stable_vector<T, Allocator, ChunkSize>::at(size_t index) {
+      if (index >= size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      return (*this)[index];
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    const T& stable_vector<T, Allocator, ChunkSize>::at(size_t index) const {
+      if (index >= size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      return (*this)[index];
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    T& stable_vector<T, Allocator, ChunkSize>::front() {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      return (*this)[0];
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    const T& stable_vector<T, Allocator, ChunkSize>::front() const {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      return (*this)[0];
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    T& stable_vector<T, Allocator, ChunkSize>::back() {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      return (*this)[size_ - 1];
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    const T& stable_vector<T, Allocator, ChunkSize>::back() const {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      return (*this)[size_ - 1];
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::pop_back() {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      truncate(size_ - 1);
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::pop_front() {
+      if (is_empty()) {
+        throw std::out_of_range("Vector is empty");
+      }
+      erase(0, 1);
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::erase(size_t index) {
+      if (index >= size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      erase(index, index + 1);
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::erase(size_t first, size_t last) {
+      if (first > last || last > size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      if (first == last) {
+        return;
+      }
+      std::move(begin() + last, end(), begin() + first);
+      truncate(size_ - (last - first));
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    typename stable_vector<T, Allocator, ChunkSize>::iterator
+    stable_vector<T, Allocator, ChunkSize>::erase(const_iterator pos) {
+      erase(pos.position());
+      return iterator(this, pos.position());
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    typename stable_vector<T, Allocator, ChunkSize>::iterator
+    stable_vector<T, Allocator, ChunkSize>::erase(const_iterator first, const_iterator last) {
+      erase(first.position(), last.position());
+      return iterator(this, first.position());
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::swap_erase(size_t index) {
+      if (index >= size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      if (index != size_ - 1) {
+        (*this)[index] = std::move((*this)[size_ - 1]);
+      }
+      truncate(size_ - 1);
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::resize(size_t new_size) {
+      if (new_size <= size_) {
+        truncate(new_size);
+        return;
+      }
+      ensure_capacity(new_size);
+      while (size_ < new_size) {
+        construct_back();
+      }
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::resize(size_t new_size, const T& value) {
+      if (new_size <= size_) {
+        truncate(new_size);
+        return;
+      }
+      ensure_capacity(new_size);
+      while (size_ < new_size) {
+        construct_back(value);
+      }
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::shrink_to_fit() {
+      const size_t needed = (size_ + ChunkSize - 1) / ChunkSize;
+      while (chunks_.size() > needed) {
+        alloc_traits::deallocate(allocator(), chunks_.back(), ChunkSize);
+        chunks_.pop_back();
+      }
+      chunks_.shrink_to_fit();
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    void stable_vector<T, Allocator, ChunkSize>::ensure_capacity(size_t min_capacity) {
+      const size_t needed = (min_capacity + ChunkSize - 1) / ChunkSize;
+      if (chunks_.size() < needed) {
+        chunks_.ensure_capacity(needed);
+        while (chunks_.size() < needed) {
+          add_chunk();
+        }
+      }
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    size_t stable_vector<T, Allocator, ChunkSize>::chunk_count() const noexcept {
+      return chunks_.size();
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    T* stable_vector<T, Allocator, ChunkSize>::chunk(size_t index) noexcept {
+      return chunks_[index];
+    }
+
+    template<typename T, typename Allocator, size_t ChunkSize>
+    const T* stable_vector<T, Allocator, ChunkSize>::chunk(size_t index) const noexcept {
+      return chunks_[index];
+    }
+
+} // namespace my_vector
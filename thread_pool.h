@@ -0,0 +1,117 @@
+//
+// Created by Fin on 17.10.2026.
+//
+
+#ifndef VECTOR_THREAD_POOL_H
+#define VECTOR_THREAD_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace my_vector {
+
+    namespace detail {
+
+/**
+ * @brief A fixed set of worker threads that run submitted tasks in FIFO order.
+ *
+ * The library shares one pool, created on first use with one worker per hardware thread
+ * minus one, because the submitting thread normally takes part in the work as well.
+ * Tasks must not throw; callers catch inside the task and hand exceptions back themselves.
+ */
+    class thread_pool {
+        std::mutex mutex_; /// Guards tasks_ and stopping_
+        std::condition_variable wake_; /// Signalled when a task is queued or the pool stops
+        std::deque<std::function<void()>> tasks_; /// Tasks not yet picked up by a worker
+        std::vector<std::thread> workers_; /// The worker threads
+        bool stopping_; /// Set by the destructor to let the workers exit
+
+      /**
+       * @brief The loop each worker runs until the pool is destroyed.
+       */
+        void work() {
+          for (;;) {
+            std::function<void()> task;
+            {
+              std::unique_lock<std::mutex> lock(mutex_);
+              wake_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+              if (tasks_.empty()) {
+                return;
+              }
+              task = std::move(tasks_.front());
+              tasks_.pop_front();
+            }
+            task();
+          }
+        }
+    public:
+        /**
+         * @brief Starts the given number of worker threads.
+         *
+         * @param threads The number of workers. Zero is allowed; submitted tasks then never run,
+         *                so callers must be able to finish the work themselves.
+         */
+        explicit thread_pool(size_t threads) : stopping_(false) {
+          workers_.reserve(threads);
+          for (size_t i = 0; i < threads; ++i) {
+            workers_.emplace_back([this] { work(); });
+          }
+        }
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        /**
+         * @brief Runs the queued tasks to completion and joins the workers.
+         */
+        ~thread_pool() {
+          {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+          }
+          wake_.notify_all();
+          for (std::thread& worker : workers_) {
+            worker.join();
+          }
+        }
+
+        /**
+         * @brief Returns the number of worker threads.
+         */
+        size_t size() const noexcept {
+          return workers_.size();
+        }
+
+        /**
+         * @brief Queues a task for one of the workers.
+         *
+         * @param task The task to run. It must not throw.
+         */
+        void submit(std::function<void()> task) {
+          {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(std::move(task));
+          }
+          wake_.notify_one();
+        }
+
+        /**
+         * @brief Returns the pool shared by the library.
+         */
+        static thread_pool& instance() {
+          static thread_pool pool(std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 0);
+          return pool;
+        }
+    };
+
+    } // namespace detail
+
+} // namespace my_vector
+
+#endif //VECTOR_THREAD_POOL_H
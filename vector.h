@@ -5,94 +5,269 @@
 #ifndef VECTOR_VECTOR_H
 #define VECTOR_VECTOR_H
 
+#include <functional>
+#include <initializer_list>
+#include <iterator>
 #include <memory>
+#include <memory_resource>
+#include <type_traits>
 
+#include "growth_policy.h"
+#include "iterator.h"
+#include "parallel.h"
+#include "relocation.h"
+#include "simd.h"
 
 namespace my_vector {
 
+    namespace detail {
+
+    /**
+     * @brief Storage for a container's allocator.
+     *
+     * Empty, non-final allocators (std::allocator, most stateless arena handles) are
+     * stored as a base class so that they take up no space in the container.
+     * Stateful allocators are stored as a regular member.
+     *
+     * @tparam Allocator The allocator type to store.
+     */
+    template<typename Allocator, bool = std::is_empty<Allocator>::value && !std::is_final<Allocator>::value>
+    class allocator_holder : private Allocator {
+    protected:
+        allocator_holder() = default;
+        explicit allocator_holder(const Allocator& alloc) : Allocator(alloc) {}
+        explicit allocator_holder(Allocator&& alloc) noexcept : Allocator(std::move(alloc)) {}
+
+        Allocator& allocator() noexcept { return *this; }
+        const Allocator& allocator() const noexcept { return *this; }
+    };
+
+    template<typename Allocator>
+    class allocator_holder<Allocator, false> {
+        Allocator allocator_; /// Stateful allocator instance
+    protected:
+        allocator_holder() = default;
+        explicit allocator_holder(const Allocator& alloc) : allocator_(alloc) {}
+        explicit allocator_holder(Allocator&& alloc) noexcept : allocator_(std::move(alloc)) {}
+
+        Allocator& allocator() noexcept { return allocator_; }
+        const Allocator& allocator() const noexcept { return allocator_; }
+    };
+
+    /**
+     * @brief Enables a container overload only for types that model an input iterator.
+     *
+     * Keeps calls such as vector<int>(5, 3) away from the iterator-range overloads.
+     */
+    template<typename It>
+    using require_input_iterator = std::enable_if_t<std::is_convertible<
+        typename std::iterator_traits<It>::iterator_category, std::input_iterator_tag>::value>;
+
+    template<typename It>
+    inline constexpr bool is_forward_iterator_v = std::is_convertible<
+        typename std::iterator_traits<It>::iterator_category, std::forward_iterator_tag>::value;
+
+    } // namespace detail
+
 /**
  * @brief A templated vector class.
  *
  * This class provides a dynamic array implementation using templates.
  *
  * @tparam T The type of elements stored in the vector.
+ * @tparam Allocator The allocator used to obtain storage. Stateless allocators add no size to the vector.
+ * @tparam GrowthPolicy Decides the new capacity when the vector runs out of room (see growth_policy.h).
  */
-    template<typename T>
-    class vector {
-
-        class iterator {
-            T* ptr;
-        public:
-            explicit iterator(T* ptr) : ptr(ptr) {}
-            iterator& operator++() { ++ptr; return *this; }
-            iterator operator++(int) { iterator tmp = *this; ++ptr; return tmp; }
-            T& operator*() { return *ptr; }
-            T* operator->() { return ptr; }
-            bool operator==(const iterator& other) const { return ptr == other.ptr; }
-            bool operator!=(const iterator& other) const { return ptr != other.ptr; }
-        };
-
-        iterator begin() { return iterator(data_); }
-        iterator end() { return iterator(data_ + size_); }
-        iterator cbegin() const { return iterator(data_); }
-        iterator cend() const { return iterator(data_ + size_); }
+    template<typename T, typename Allocator = std::allocator<T>, typename GrowthPolicy = double_growth>
+    class vector : private detail::allocator_holder<Allocator> {
+        using alloc_traits = std::allocator_traits<Allocator>;
+        using detail::allocator_holder<Allocator>::allocator;
 
         size_t size_; /// Number of elements in the vector
         size_t capacity_; /// Allocated storage capacity_ of the vector
         T* data_; /// Pointer to the allocated storage
-        std::allocator<T> allocator; /// Allocator for managing memory
 
       /**
        * @brief Resizes the vector to a new capacity_.
        *
        * If the current capacity_ is exceeded, reallocates storage with the new capacity_.
+       * Trivially relocatable elements are transferred with a single memcpy, others with
+       * move_if_noexcept so that a throwing copy leaves the vector unchanged.
+       * If the allocator provides reallocate() (see realloc_allocator), trivially relocatable
+       * elements are grown in place instead.
        *
        * @param new_capacity The new capacity_ of the vector.
        */
         void reserve(size_t new_capacity);
 
+      /**
+       * @brief Grows the storage according to GrowthPolicy so that it holds at least min_capacity elements.
+       *
+       * @param min_capacity The number of elements the storage must hold.
+       */
+        void grow(size_t min_capacity);
+
+      /**
+       * @brief Moves the elements to larger storage and constructs a new element at index.
+       *
+       * The new element is constructed before the old elements are moved, so args may refer
+       * to elements of this vector.
+       *
+       * @param index The position of the new element, at most size_.
+       * @param args The arguments to construct the element from.
+       */
+        template<typename... Args>
+        void emplace_reallocate(size_t index, Args&&... args);
+
+      /**
+       * @brief Inserts count new elements before index, each built by construct(T* slot).
+       *
+       * Grows at most once. Elements are shifted with relocate_within when that cannot throw;
+       * otherwise the new elements and the old ones are built in a fresh buffer, so a
+       * throwing constructor leaves the vector unchanged.
+       *
+       * @param index The position of the first new element, at most size_.
+       * @param count The number of elements to insert.
+       * @param construct Called once per new element, in order, with the slot to construct into.
+       */
+        template<typename Construct>
+        void insert_n(size_t index, size_t count, Construct&& construct);
+
+      /**
+       * @brief Inserts count trivially copyable elements from contiguous memory with memmove/memcpy.
+       *
+       * @param index The position of the first new element, at most size_.
+       * @param source The first element to copy, which may point into this vector.
+       * @param count The number of elements to copy.
+       */
+        void insert_trivial(size_t index, const T* source, size_t count);
+
+      /**
+       * @brief Constructs count elements after the last one, each built by construct(T* slot, size_t i).
+       *
+       * Runs on the thread pool once the elements reach parallel_threshold() bytes. The
+       * capacity must already suffice. If a constructor throws, the new elements are destroyed
+       * again and the vector keeps the elements it had before the call.
+       *
+       * @param count The number of elements to construct.
+       * @param construct Called once per new element with its slot and its offset from the old end.
+       */
+        template<typename Construct>
+        void construct_at_end(size_t count, Construct&& construct);
+
+      /**
+       * @brief Checks whether p points at one of the elements of this vector.
+       *
+       * @param p The address to check.
+       * @return True if p lies within [data_, data_ + size_).
+       */
+        bool contains_address(const T* p) const noexcept;
+
       /**
        * @brief Checks if the vector is empty.
        *
        * @return True if the vector is empty, false otherwise.
        */
         bool is_empty() noexcept;
+
+      /**
+       * @brief Destroys all elements and returns the storage to the allocator.
+       *
+       * Leaves size_ and capacity_ untouched; callers reset them as needed.
+       */
+        void destroy_and_deallocate() noexcept;
     public:
+        using value_type = T;
+        using allocator_type = Allocator;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using iterator = detail::contiguous_iterator<T, vector>;
+        using const_iterator = detail::contiguous_iterator<const T, vector>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
         /**
          * @brief Default constructor.
          *
          * Initializes the vector with size_ and capacity_ set to 0, and data_ set to nullptr.
          */
-        vector();
+        vector() noexcept(std::is_nothrow_default_constructible<Allocator>::value);
+
+        /**
+         * @brief Constructs an empty vector that obtains its storage from the given allocator.
+         *
+         * @param alloc The allocator to use, e.g. a std::pmr::polymorphic_allocator bound to an arena.
+         */
+        explicit vector(const Allocator& alloc) noexcept;
 
         /**
          * @brief Constructor with size_ and value.
          *
          * Initializes the vector with a given size_ and fills it with the specified value.
+         * Large vectors are filled on the thread pool, see set_parallel_threshold().
          *
          * @param size The number of elements to initialize.
          * @param value The value to initialize each element with.
+         * @param alloc The allocator to use.
          */
-        vector(size_t size, T value);
+        vector(size_t size, T value, const Allocator& alloc = Allocator());
 
         /**
          * @brief Copy constructor.
          *
-         * Creates a copy of the given vector.
+         * Creates a copy of the given vector. The allocator is obtained through
+         * select_on_container_copy_construction, so pmr vectors fall back to the default resource.
+         * Large vectors are copied on the thread pool, see set_parallel_threshold().
          *
          * @param other The vector to copy from.
          */
-        vector(const vector<T>& other);
+        vector(const vector<T, Allocator, GrowthPolicy>& other);
+
+        /**
+         * @brief Copy constructor with an explicit allocator.
+         *
+         * @param other The vector to copy from.
+         * @param alloc The allocator to use for the copy.
+         */
+        vector(const vector<T, Allocator, GrowthPolicy>& other, const Allocator& alloc);
+
+        /**
+         * @brief Constructs the vector from an initializer list.
+         *
+         * @param init The elements to copy.
+         * @param alloc The allocator to use.
+         */
+        vector(std::initializer_list<T> init, const Allocator& alloc = Allocator());
+
+        /**
+         * @brief Constructs the vector from the range [first, last).
+         *
+         * Forward ranges are measured first and allocated for in one go.
+         *
+         * @param first The beginning of the range.
+         * @param last The end of the range.
+         * @param alloc The allocator to use.
+         */
+        template<typename InputIt, typename = detail::require_input_iterator<InputIt>>
+        vector(InputIt first, InputIt last, const Allocator& alloc = Allocator());
 
         /**
          * @brief Copy assignment operator.
          *
          * Assigns the contents of one vector to another.
+         * Large vectors are copied on the thread pool, see set_parallel_threshold().
+         * The old elements are destroyed and their storage freed before the copy starts, so
+         * peak memory stays at one copy. If an element's copy constructor throws, the vector
+         * is left empty.
          *
          * @param other The vector to copy from.
          * @return A reference to the assigned vector.
          */
-        vector<T>& operator=(const vector<T>& other);
+        vector<T, Allocator, GrowthPolicy>& operator=(const vector<T, Allocator, GrowthPolicy>& other);
 
         /**
          * @brief Move constructor.
@@ -101,17 +276,29 @@ namespace my_vector {
          *
          * @param other The vector to move from.
          */
-        vector(vector<T>&& other) noexcept;
+        vector(vector<T, Allocator, GrowthPolicy>&& other) noexcept;
+
+        /**
+         * @brief Move constructor with an explicit allocator.
+         *
+         * Steals the storage if the allocators compare equal, otherwise moves the elements one by one.
+         *
+         * @param other The vector to move from.
+         * @param alloc The allocator to use for the new vector.
+         */
+        vector(vector<T, Allocator, GrowthPolicy>&& other, const Allocator& alloc);
 
         /**
          * @brief Move assignment operator.
          *
-         * Moves the contents of one vector to another.
+         * Moves the contents of one vector to another. If the allocator does not propagate and
+         * the two allocators differ, the elements are moved one by one.
          *
          * @param other The vector to move from.
          * @return A reference to the assigned vector.
          */
-        vector<T>& operator=(vector<T>&& other) noexcept;
+        vector<T, Allocator, GrowthPolicy>& operator=(vector<T, Allocator, GrowthPolicy>&& other)
+            noexcept(alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value);
 
         /**
          * @brief Accesses the element at the specified position.
@@ -119,8 +306,103 @@ namespace my_vector {
          * @param index The position of the element to access.
          * @return A reference to the element at the specified position.
          */
+        T& operator[] (size_t index);
+
+        /**
+         * @brief Accesses the element at the specified position (const version).
+         *
+         * @param index The position of the element to access.
+         * @return A const reference to the element at the specified position.
+         */
         const T& operator[] (size_t index) const;
 
+        /**
+         * @brief Returns an iterator to the first element.
+         *
+         * Iterators are random access (contiguous with C++20), so the std algorithms, including
+         * the parallel ones, work directly on the vector.
+         *
+         * @return An iterator to the first element.
+         */
+        iterator begin() noexcept;
+
+        /**
+         * @brief Returns a const iterator to the first element.
+         *
+         * @return A const iterator to the first element.
+         */
+        const_iterator begin() const noexcept;
+
+        /**
+         * @brief Returns an iterator past the last element.
+         *
+         * @return An iterator past the last element.
+         */
+        iterator end() noexcept;
+
+        /**
+         * @brief Returns a const iterator past the last element.
+         *
+         * @return A const iterator past the last element.
+         */
+        const_iterator end() const noexcept;
+
+        /**
+         * @brief Returns a const iterator to the first element.
+         *
+         * @return A const iterator to the first element.
+         */
+        const_iterator cbegin() const noexcept;
+
+        /**
+         * @brief Returns a const iterator past the last element.
+         *
+         * @return A const iterator past the last element.
+         */
+        const_iterator cend() const noexcept;
+
+        /**
+         * @brief Returns a reverse iterator to the last element.
+         *
+         * @return A reverse iterator to the last element.
+         */
+        reverse_iterator rbegin() noexcept;
+
+        /**
+         * @brief Returns a const reverse iterator to the last element.
+         *
+         * @return A const reverse iterator to the last element.
+         */
+        const_reverse_iterator rbegin() const noexcept;
+
+        /**
+         * @brief Returns a reverse iterator before the first element.
+         *
+         * @return A reverse iterator before the first element.
+         */
+        reverse_iterator rend() noexcept;
+
+        /**
+         * @brief Returns a const reverse iterator before the first element.
+         *
+         * @return A const reverse iterator before the first element.
+         */
+        const_reverse_iterator rend() const noexcept;
+
+        /**
+         * @brief Returns a const reverse iterator to the last element.
+         *
+         * @return A const reverse iterator to the last element.
+         */
+        const_reverse_iterator crbegin() const noexcept;
+
+        /**
+         * @brief Returns a const reverse iterator before the first element.
+         *
+         * @return A const reverse iterator before the first element.
+         */
+        const_reverse_iterator crend() const noexcept;
+
         /**
          * @brief Destructor.
          *
@@ -142,9 +424,126 @@ namespace my_vector {
          */
         void push_back(T&& value);
 
+        /**
+         * @brief Constructs an element in place at the end of the vector.
+         *
+         * The arguments may refer to elements of this vector, even if it has to grow.
+         *
+         * @param args The arguments to forward to the constructor of T.
+         * @return A reference to the new element.
+         */
+        template<typename... Args>
+        T& emplace_back(Args&&... args);
+
+        /**
+         * @brief Constructs an element in place at the front of the vector.
+         *
+         * Shifts every element, so this is O(n). Use devector for queue-like workloads.
+         *
+         * @param args The arguments to forward to the constructor of T.
+         * @return A reference to the new element.
+         */
+        template<typename... Args>
+        T& emplace_front(Args&&... args);
+
+        /**
+         * @brief Constructs an element in place before the element at the specified position.
+         *
+         * Elements from index onwards shift one place back. The arguments may refer to elements
+         * of this vector.
+         *
+         * @param index The position of the new element, at most size().
+         * @param args The arguments to forward to the constructor of T.
+         * @return A reference to the new element.
+         * @throws std::out_of_range if the index is greater than size().
+         */
+        template<typename... Args>
+        T& emplace(size_t index, Args&&... args);
+
+        /**
+         * @brief Appends the range [first, last) to the end of the vector.
+         *
+         * Forward ranges are measured first, so the vector grows at most once. Contiguous
+         * ranges of a trivially copyable T are copied with a single memcpy.
+         *
+         * @param first The beginning of the range.
+         * @param last The end of the range.
+         */
+        template<typename InputIt, typename = detail::require_input_iterator<InputIt>>
+        void append(InputIt first, InputIt last);
+
+        /**
+         * @brief Appends the elements of an initializer list to the end of the vector.
+         *
+         * @param init The elements to append.
+         */
+        void append(std::initializer_list<T> init);
+
+        /**
+         * @brief Inserts the range [first, last) before the element at the specified position.
+         *
+         * The vector grows at most once for forward ranges. A pointer range may point into this
+         * vector; other iterators into this vector are not allowed.
+         *
+         * @param index The position to insert at, at most size().
+         * @param first The beginning of the range.
+         * @param last The end of the range.
+         * @throws std::out_of_range if the index is greater than size().
+         */
+        template<typename InputIt, typename = detail::require_input_iterator<InputIt>>
+        void insert(size_t index, InputIt first, InputIt last);
+
+        /**
+         * @brief Inserts count copies of value before the element at the specified position.
+         *
+         * @param index The position to insert at, at most size().
+         * @param count The number of copies to insert.
+         * @param value The value to copy, which may be an element of this vector.
+         * @throws std::out_of_range if the index is greater than size().
+         */
+        void insert(size_t index, size_t count, const T& value);
+
+        /**
+         * @brief Inserts the elements of an initializer list before the element at the specified position.
+         *
+         * @param index The position to insert at, at most size().
+         * @param init The elements to insert.
+         * @throws std::out_of_range if the index is greater than size().
+         */
+        void insert(size_t index, std::initializer_list<T> init);
+
+        /**
+         * @brief Replaces the contents with count copies of value.
+         *
+         * @param count The new size of the vector.
+         * @param value The value to copy.
+         */
+        void assign(size_t count, const T& value);
+
+        /**
+         * @brief Replaces the contents with the range [first, last).
+         *
+         * Forward ranges are measured first; the storage is reused if it is large enough and
+         * replaced by an exactly sized one otherwise.
+         *
+         * @param first The beginning of the range.
+         * @param last The end of the range.
+         */
+        template<typename InputIt, typename = detail::require_input_iterator<InputIt>>
+        void assign(InputIt first, InputIt last);
+
+        /**
+         * @brief Replaces the contents with the elements of an initializer list.
+         *
+         * @param init The elements to copy.
+         */
+        void assign(std::initializer_list<T> init);
+
         /**
          * @brief Adds an element to the front of the vector.
          *
+         * Shifts every element, so this is O(n). Use devector for queue-like workloads.
+         *
          * @param value The value to add.
          */
         void push_front(const T& value);
@@ -159,9 +558,27 @@ namespace my_vector {
         /**
          * @brief Clears the contents of the vector.
          *
-         * Sets the size_ to 0 but does not deallocate the memory.
+         * Sets the size_ to 0 but does not deallocate the memory, so refilling the vector
+         * up to its previous size does not allocate.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Clears the contents of the vector and releases its memory.
+         *
+         * Afterwards capacity() is 0.
+         */
+        void clear_and_free() noexcept;
+
+        /**
+         * @brief Clears the contents of the vector, keeping room for at least min_capacity elements.
+         *
+         * Keeps the current storage if it is large enough, otherwise grows it according to
+         * GrowthPolicy. Growing an empty vector does not move any elements.
+         *
+         * @param min_capacity The minimum capacity to keep.
          */
-        void constexpr clear() noexcept;
+        void reset(size_t min_capacity);
 
         /**
          * @brief Swaps the contents of this vector with another vector.
@@ -170,6 +587,13 @@ namespace my_vector {
          */
         void swap(vector& other) noexcept;
 
+        /**
+         * @brief Returns a copy of the allocator associated with the vector.
+         *
+         * @return The allocator.
+         */
+        allocator_type get_allocator() const noexcept;
+
         /**
          * @brief Returns the number of elements in the vector.
          *
@@ -244,14 +668,63 @@ namespace my_vector {
         /**
          * @brief Removes the first element of the vector.
          *
+         * Shifts every element, so this is O(n). Use devector for queue-like workloads.
+         *
          * @throws std::out_of_range if the vector is empty.
          */
         void pop_front();
 
+        /**
+         * @brief Removes the element at the specified position, shifting the following elements forward.
+         *
+         * @param index The position of the element to remove.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        void erase(size_t index);
+
+        /**
+         * @brief Removes the elements in [first, last), shifting the following elements forward.
+         *
+         * @param first The position of the first element to remove.
+         * @param last The position after the last element to remove.
+         * @throws std::out_of_range if the range is not within the vector.
+         */
+        void erase(size_t first, size_t last);
+
+        /**
+         * @brief Removes the element at the specified position, iterator version.
+         *
+         * @param pos An iterator to the element to remove.
+         * @return An iterator to the element that followed the removed one.
+         */
+        iterator erase(const_iterator pos);
+
+        /**
+         * @brief Removes the elements in [first, last), iterator version.
+         *
+         * Together with std::remove_if this gives the usual erase-remove idiom.
+         *
+         * @param first An iterator to the first element to remove.
+         * @param last An iterator past the last element to remove.
+         * @return An iterator to the element that followed the removed ones.
+         */
+        iterator erase(const_iterator first, const_iterator last);
+
+        /**
+         * @brief Removes the element at the specified position in O(1) by moving the last element into its place.
+         *
+         * Does not preserve the order of the elements.
+         *
+         * @param index The position of the element to remove.
+         * @throws std::out_of_range if the index is out of range.
+         */
+        void swap_erase(size_t index);
+
         /**
          * @brief Resizes the vector to contain the specified number of elements.
          *
          * If the new size_ is greater than the current size_, new elements are default-initialized.
+         * Storage grows according to GrowthPolicy.
          * If the new size_ is less than the current size_, elements are destroyed.
          *
          * @param new_size The new size_ of the vector.
@@ -262,6 +735,8 @@ namespace my_vector {
          * @brief Resizes the vector to contain the specified number of elements, initializing new elements with the specified value.
          *
          * If the new size_ is greater than the current size_, new elements are initialized with the specified value.
+         * Large fills run on the thread pool, see set_parallel_threshold().
+         * Storage grows according to GrowthPolicy.
          * If the new size_ is less than the current size_, elements are destroyed.
          *
          * @param new_size The new size_ of the vector.
@@ -269,8 +744,32 @@ namespace my_vector {
          */
         void resize(size_t new_size, const T& value);
 
+        /**
+         * @brief Resizes the vector without initializing the new elements.
+         *
+         * For buffers that are written right away, e.g. by read() or a decoder. Unlike
+         * resize(), the new elements are neither zeroed nor touched, so a large fresh
+         * allocation is not faulted in until it is written. Only available for trivially
+         * default-constructible T, for which skipping initialization is well-defined.
+         *
+         * @param new_size The new size_ of the vector.
+         */
+        void resize_for_overwrite(size_t new_size);
+
+        /**
+         * @brief Appends count elements without initializing them.
+         *
+         * Only available for trivially default-constructible T.
+         *
+         * @param count The number of elements to append.
+         * @return A pointer to the first appended element, to be written by the caller.
+         */
+        T* append_uninitialized(size_t count);
+
         /**
          * @brief Shrinks the capacity_ of the vector to fit its size_.
+         *
+         * Elements are relocated the same way as in reserve().
          */
         void shrink_to_fit();
 
@@ -300,13 +799,41 @@ namespace my_vector {
          * @brief Ensures the vector has at least the specified capacity.
          *
          * This method increases the capacity of the vector if the current capacity
-         * is less than the specified minimum capacity.
+         * is less than the specified minimum capacity. The new capacity is chosen by
+         * GrowthPolicy, so it may exceed min_capacity.
          *
          * @param min_capacity The minimum capacity to ensure.
          */
         void ensure_capacity(size_t min_capacity);
     };
 
+/**
+ * @brief Removes every element for which pred returns true, in a single pass.
+ *
+ * The remaining elements keep their order. For arithmetic elements the survivors are packed
+ * with AVX2 permutes when the CPU supports it and the elements are 4 or 8 bytes, otherwise
+ * with a branch-free scalar loop. Other types are compacted with move assignment.
+ *
+ * @param vec The vector to filter.
+ * @param pred Returns true for the elements to remove.
+ * @return The number of elements removed.
+ */
+    template<typename T, typename Allocator, typename GrowthPolicy, typename Pred>
+    size_t erase_if(vector<T, Allocator, GrowthPolicy>& vec, Pred pred);
+
+    namespace pmr {
+
+    /**
+     * @brief A vector that obtains its storage from a std::pmr::memory_resource.
+     *
+     * @tparam T The type of elements stored in the vector.
+     * @tparam GrowthPolicy Decides the new capacity when the vector runs out of room.
+     */
+    template<typename T, typename GrowthPolicy = double_growth>
+    using vector = my_vector::vector<T, std::pmr::polymorphic_allocator<T>, GrowthPolicy>;
+
+    } // namespace pmr
+
 } // namespace my_vector
 
 #include "vector_impl.h"
@@ -3,65 +3,217 @@
 //
 
 #include <algorithm>
+#include <cstring>
+#include <iterator>
 #include <stdexcept>
 
 namespace my_vector {
 
-    template<typename T>
-    vector<T>::vector() : size_(0), capacity_(0), data_(nullptr) {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    vector<T, Allocator, GrowthPolicy>::vector() noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+        : size_(0), capacity_(0), data_(nullptr) {
     }
 
-    template<typename T>
-    vector<T>::vector(size_t size, T value) : size_(size), capacity_(size), data_(allocator.allocate(size)){
-      for (int i = 0; i < size; i++) {
-        allocator.construct(&this->data_[i], value);
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    vector<T, Allocator, GrowthPolicy>::vector(const Allocator& alloc) noexcept
+        : detail::allocator_holder<Allocator>(alloc), size_(0), capacity_(0), data_(nullptr) {
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    vector<T, Allocator, GrowthPolicy>::vector(size_t size, T value, const Allocator& alloc)
+        : detail::allocator_holder<Allocator>(alloc), size_(0), capacity_(size),
+          data_(size ? alloc_traits::allocate(allocator(), size) : nullptr) {
+      try {
+        construct_at_end(size, [this, &value](T* slot, size_t) {
+          alloc_traits::construct(allocator(), slot, value);
+        });
+      } catch (...) {
+        alloc_traits::deallocate(allocator(), data_, capacity_);
+        throw;
       }
     }
 
-    template<typename T>
-    vector<T>::vector(const vector<T>& other) : size_(other.size_), capacity_(other.capacity_), data_(allocator.allocate(other.capacity_)) {
-      for (int i = 0; i < other.size_; ++i) {
-        allocator.construct(&this->data_[i], other.data_[i]);
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    vector<T, Allocator, GrowthPolicy>::vector(const vector<T, Allocator, GrowthPolicy>& other)
+        : vector(other, alloc_traits::select_on_container_copy_construction(other.allocator())) {
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    vector<T, Allocator, GrowthPolicy>::vector(const vector<T, Allocator, GrowthPolicy>& other, const Allocator& alloc)
+        : detail::allocator_holder<Allocator>(alloc), size_(0), capacity_(other.capacity_),
+          data_(other.capacity_ ? alloc_traits::allocate(allocator(), other.capacity_) : nullptr) {
+      try {
+        construct_at_end(other.size_, [this, &other](T* slot, size_t i) {
+          alloc_traits::construct(allocator(), slot, other.data_[i]);
+        });
+      } catch (...) {
+        if (data_) {
+          alloc_traits::deallocate(allocator(), data_, capacity_);
+        }
+        throw;
       }
     }
 
-    template<typename T>
-    vector<T>& vector<T>::operator=(const vector<T>& other) {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    vector<T, Allocator, GrowthPolicy>::vector(std::initializer_list<T> init, const Allocator& alloc)
+        : vector(alloc) {
+      assign(init.begin(), init.end());
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    template<typename InputIt, typename>
+    vector<T, Allocator, GrowthPolicy>::vector(InputIt first, InputIt last, const Allocator& alloc)
+        : vector(alloc) {
+      assign(first, last);
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    vector<T, Allocator, GrowthPolicy>& vector<T, Allocator, GrowthPolicy>::operator=(const vector<T, Allocator, GrowthPolicy>& other) {
       if (this != &other) {
-        for (int i = 0; i < size_; ++i) {
-          allocator.destroy(&data_[i]);
-        }
-        allocator.deallocate(data_, capacity_);
+        destroy_and_deallocate();
+        size_ = 0;
+        capacity_ = 0;
+        data_ = nullptr;
 
-        this->size_ = other.size_;
-        this->capacity_ = other.capacity_;
-        this->data_ = allocator.allocate(other.capacity_);
-        for (int i = 0; i < other.size_; ++i) {
-          allocator.construct(&this->data_[i], other.data_[i]);
+        if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+          allocator() = other.allocator();
+        }
+        if (other.capacity_) {
+          this->data_ = alloc_traits::allocate(allocator(), other.capacity_);
+          this->capacity_ = other.capacity_;
         }
+        construct_at_end(other.size_, [this, &other](T* slot, size_t i) {
+          alloc_traits::construct(allocator(), slot, other.data_[i]);
+        });
       }
       return *this;
     }
 
-    template<typename T>
-    const T& vector<T>::operator[] (size_t index) const {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    T& vector<T, Allocator, GrowthPolicy>::operator[] (size_t index) {
+      return data_[index];
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    const T& vector<T, Allocator, GrowthPolicy>::operator[] (size_t index) const {
       return data_[index];
     }
 
-    template<typename T>
-    vector<T>::vector(vector<T>&& other) noexcept : size_(other.size_), capacity_(other.capacity_), data_(other.data_) {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    typename vector<T, Allocator, GrowthPolicy>::iterator vector<T, Allocator, GrowthPolicy>::begin() noexcept {
+      return iterator(data_);
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    typename vector<T, Allocator, GrowthPolicy>::const_iterator vector<T, Allocator, GrowthPolicy>::begin() const noexcept {
+      return const_iterator(data_);
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    typename vector<T, Allocator, GrowthPolicy>::iterator vector<T, Allocator, GrowthPolicy>::end() noexcept {
+      return iterator(data_ + size_);
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    typename vector<T, Allocator, GrowthPolicy>::const_iterator vector<T, Allocator, GrowthPolicy>::end() const noexcept {
+      return const_iterator(data_ + size_);
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    typename vector<T, Allocator, GrowthPolicy>::const_iterator vector<T, Allocator, GrowthPolicy>::cbegin() const noexcept {
+      return const_iterator(data_);
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    typename vector<T, Allocator, GrowthPolicy>::const_iterator vector<T, Allocator, GrowthPolicy>::cend() const noexcept {
+      return const_iterator(data_ + size_);
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    typename vector<T, Allocator, GrowthPolicy>::reverse_iterator vector<T, Allocator, GrowthPolicy>::rbegin() noexcept {
+      return reverse_iterator(end());
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    typename vector<T, Allocator, GrowthPolicy>::const_reverse_iterator vector<T, Allocator, GrowthPolicy>::rbegin() const noexcept {
+      return const_reverse_iterator(end());
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    typename vector<T, Allocator, GrowthPolicy>::reverse_iterator vector<T, Allocator, GrowthPolicy>::rend() noexcept {
+      return reverse_iterator(begin());
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    typename vector<T, Allocator, GrowthPolicy>::const_reverse_iterator vector<T, Allocator, GrowthPolicy>::rend() const noexcept {
+      return const_reverse_iterator(begin());
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    typename vector<T, Allocator, GrowthPolicy>::const_reverse_iterator vector<T, Allocator, GrowthPolicy>::crbegin() const noexcept {
+      return const_reverse_iterator(cend());
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    typename vector<T, Allocator, GrowthPolicy>::const_reverse_iterator vector<T, Allocator, GrowthPolicy>::crend() const noexcept {
+      return const_reverse_iterator(cbegin());
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    vector<T, Allocator, GrowthPolicy>::vector(vector<T, Allocator, GrowthPolicy>&& other) noexcept
+        : detail::allocator_holder<Allocator>(std::move(other.allocator())),
+          size_(other.size_), capacity_(other.capacity_), data_(other.data_) {
       other.size_ = 0;
       other.capacity_ = 0;
       other.data_ = nullptr;
     }
 
-    template<typename T>
-    vector<T>& vector<T>::operator=(vector<T>&& other) noexcept {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    vector<T, Allocator, GrowthPolicy>::vector(vector<T, Allocator, GrowthPolicy>&& other, const Allocator& alloc)
+        : detail::allocator_holder<Allocator>(alloc), size_(0), capacity_(0), data_(nullptr) {
+      if (allocator() == other.allocator()) {
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+        data_ = other.data_;
+        other.size_ = 0;
+        other.capacity_ = 0;
+        other.data_ = nullptr;
+      } else if (other.size_) {
+        data_ = alloc_traits::allocate(allocator(), other.size_);
+        capacity_ = other.size_;
+        try {
+          for (; size_ < other.size_; ++size_) {
+            alloc_traits::construct(allocator(), &data_[size_], std::move(other.data_[size_]));
+          }
+        } catch (...) {
+          destroy_and_deallocate();
+          throw;
+        }
+      }
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    vector<T, Allocator, GrowthPolicy>& vector<T, Allocator, GrowthPolicy>::operator=(vector<T, Allocator, GrowthPolicy>&& other)
+        noexcept(alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value) {
       if(this != &other){
-        for(int i = 0; i < size_; ++i){
-          allocator.destroy(&data_[i]);
+        destroy_and_deallocate();
+        size_ = 0;
+        capacity_ = 0;
+        data_ = nullptr;
+
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+          allocator() = std::move(other.allocator());
+        } else if (allocator() != other.allocator()) {
+          // Storage cannot change hands between unequal allocators, move element-wise instead.
+          if (other.size_) {
+            data_ = alloc_traits::allocate(allocator(), other.size_);
+            capacity_ = other.size_;
+          }
+          for (; size_ < other.size_; ++size_) {
+            alloc_traits::construct(allocator(), &data_[size_], std::move(other.data_[size_]));
+          }
+          return *this;
         }
-        allocator.deallocate(data_, capacity_);
 
         this->size_ = other.size_;
         this->capacity_ = other.capacity_;
@@ -73,230 +225,675 @@ namespace my_vector {
       return *this;
     }
 
-    template<typename T>
-    vector<T>::~vector() {
-      for (int i = 0; i < size_; ++i) {
-        allocator.destroy(&data_[i]);
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    vector<T, Allocator, GrowthPolicy>::~vector() {
+      destroy_and_deallocate();
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::destroy_and_deallocate() noexcept {
+      for (size_t i = 0; i < size_; ++i) {
+        alloc_traits::destroy(allocator(), &data_[i]);
+      }
+      if (data_) {
+        alloc_traits::deallocate(allocator(), data_, capacity_);
       }
-      allocator.deallocate(data_, capacity_);
     }
 
-    template<typename T>
-    bool vector<T>::is_empty() noexcept {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    bool vector<T, Allocator, GrowthPolicy>::is_empty() noexcept {
       return size_ == 0;
     }
 
-    template<typename T>
-    void vector<T>::reserve(size_t new_capacity) {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::reserve(size_t new_capacity) {
       if(new_capacity > capacity_){
-        T* new_data = allocator.allocate(new_capacity);
-        for(int i = 0; i < size_; ++i){
-          allocator.construct(&new_data[i], std::move(data_[i]));
-          allocator.destroy(&data_[i]);
+        if constexpr (detail::can_reallocate<Allocator, T>::value) {
+          if (data_) {
+            data_ = allocator().reallocate(data_, capacity_, new_capacity);
+            capacity_ = detail::usable_capacity<GrowthPolicy>(allocator(), data_, new_capacity);
+            return;
+          }
+        }
+        T* new_data = alloc_traits::allocate(allocator(), new_capacity);
+        try {
+          detail::relocate(allocator(), data_, size_, new_data);
+        } catch (...) {
+          alloc_traits::deallocate(allocator(), new_data, new_capacity);
+          throw;
+        }
+        if (data_) {
+          alloc_traits::deallocate(allocator(), data_, capacity_);
         }
-        allocator.deallocate(data_, capacity_);
         data_ = new_data;
-        capacity_ = new_capacity;
+        capacity_ = detail::usable_capacity<GrowthPolicy>(allocator(), new_data, new_capacity);
       }
     }
 
-    template<typename T>
-    void vector<T>::push_back(const T& value) {
-      if(size_ == capacity_){
-        reserve(capacity_ == 0 ? 1 : capacity_ * 2);
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::grow(size_t min_capacity) {
+      reserve(GrowthPolicy::next_capacity(capacity_, min_capacity, sizeof(T)));
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    template<typename... Args>
+    void vector<T, Allocator, GrowthPolicy>::emplace_reallocate(size_t index, Args&&... args) {
+      const size_t new_capacity = GrowthPolicy::next_capacity(capacity_, size_ + 1, sizeof(T));
+      if constexpr (detail::can_reallocate<Allocator, T>::value) {
+        if (data_) {
+          // reallocate() may move the block under args, so build the element first.
+          T value(std::forward<Args>(args)...);
+          reserve(new_capacity);
+          detail::relocate_within(allocator(), data_ + index, size_ - index, data_ + index + 1);
+          alloc_traits::construct(allocator(), &data_[index], std::move(value));
+          ++size_;
+          return;
+        }
       }
-      allocator.construct(&data_[size_++], value);
+      T* new_data = alloc_traits::allocate(allocator(), new_capacity);
+      try {
+        alloc_traits::construct(allocator(), &new_data[index], std::forward<Args>(args)...);
+      } catch (...) {
+        alloc_traits::deallocate(allocator(), new_data, new_capacity);
+        throw;
+      }
+      try {
+        detail::relocate_with_gap(allocator(), data_, size_, new_data, index, 1);
+      } catch (...) {
+        alloc_traits::destroy(allocator(), &new_data[index]);
+        alloc_traits::deallocate(allocator(), new_data, new_capacity);
+        throw;
+      }
+      if (data_) {
+        alloc_traits::deallocate(allocator(), data_, capacity_);
+      }
+      data_ = new_data;
+      capacity_ = detail::usable_capacity<GrowthPolicy>(allocator(), new_data, new_capacity);
+      ++size_;
     }
 
-    template<typename T>
-    void vector<T>::push_back(T&& value) {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    template<typename... Args>
+    T& vector<T, Allocator, GrowthPolicy>::emplace_back(Args&&... args) {
       if(size_ == capacity_){
-        reserve(capacity_ == 0 ? 1 : capacity_ * 2);
+        emplace_reallocate(size_, std::forward<Args>(args)...);
+      } else {
+        alloc_traits::construct(allocator(), &data_[size_], std::forward<Args>(args)...);
+        ++size_;
       }
-      allocator.construct(&data_[size_++], std::move(value));
+      return data_[size_ - 1];
     }
 
-    template<typename T>
-    void vector<T>::push_front(const T& value) {
-      if(size_ == capacity_){
-        reserve(capacity_ == 0 ? 1 : capacity_ * 2);
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    template<typename... Args>
+    T& vector<T, Allocator, GrowthPolicy>::emplace_front(Args&&... args) {
+      return emplace(0, std::forward<Args>(args)...);
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    template<typename... Args>
+    T& vector<T, Allocator, GrowthPolicy>::emplace(size_t index, Args&&... args) {
+      if (index > size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      if (size_ == capacity_) {
+        emplace_reallocate(index, std::forward<Args>(args)...);
+        return data_[index];
+      }
+      if (index == size_) {
+        alloc_traits::construct(allocator(), &data_[size_], std::forward<Args>(args)...);
+        ++size_;
+        return data_[index];
       }
-      for(int i = size_; i > 0; --i){
-        data_[i] = std::move(data_[i - 1]);
+      // args may refer to elements that are about to shift, so build the element first.
+      T value(std::forward<Args>(args)...);
+      if constexpr (detail::is_nothrow_relocatable_v<T>) {
+        detail::relocate_within(allocator(), data_ + index, size_ - index, data_ + index + 1);
+        alloc_traits::construct(allocator(), &data_[index], std::move(value));
+        ++size_;
+      } else {
+        alloc_traits::construct(allocator(), &data_[size_], std::move(data_[size_ - 1]));
+        ++size_;
+        for (size_t i = size_ - 2; i > index; --i) {
+          data_[i] = std::move(data_[i - 1]);
+        }
+        data_[index] = std::move(value);
       }
-      allocator.construct(&data_[0], value);
-      size_++;
+      return data_[index];
     }
 
-    template<typename T>
-    void vector<T>::push_front(T&& value) {
-      if(size_ == capacity_){
-        reserve(capacity_ == 0 ? 1 : capacity_ * 2);
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    bool vector<T, Allocator, GrowthPolicy>::contains_address(const T* p) const noexcept {
+      return !std::less<const T*>()(p, data_) && std::less<const T*>()(p, data_ + size_);
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    template<typename Construct>
+    void vector<T, Allocator, GrowthPolicy>::insert_n(size_t index, size_t count, Construct&& construct) {
+      if (count == 0) {
+        return;
       }
-      for(int i = size_; i > 0; --i){
-        data_[i] = std::move(data_[i - 1]);
+      if constexpr (detail::can_reallocate<Allocator, T>::value) {
+        if (size_ + count > capacity_) {
+          reserve(GrowthPolicy::next_capacity(capacity_, size_ + count, sizeof(T)));
+        }
+      }
+      if constexpr (detail::is_nothrow_relocatable_v<T>) {
+        if (size_ + count <= capacity_) {
+          T* gap = data_ + index;
+          detail::relocate_within(allocator(), gap, size_ - index, gap + count);
+          size_t built = 0;
+          try {
+            for (; built < count; ++built) {
+              construct(gap + built);
+            }
+          } catch (...) {
+            for (size_t i = 0; i < built; ++i) {
+              alloc_traits::destroy(allocator(), gap + i);
+            }
+            detail::relocate_within(allocator(), gap + count, size_ - index, gap);
+            throw;
+          }
+          size_ += count;
+          return;
+        }
+      }
+      const size_t new_capacity = size_ + count <= capacity_
+          ? capacity_ : GrowthPolicy::next_capacity(capacity_, size_ + count, sizeof(T));
+      T* new_data = alloc_traits::allocate(allocator(), new_capacity);
+      size_t built = 0;
+      try {
+        for (; built < count; ++built) {
+          construct(new_data + index + built);
+        }
+        detail::relocate_with_gap(allocator(), data_, size_, new_data, index, count);
+      } catch (...) {
+        for (size_t i = 0; i < built; ++i) {
+          alloc_traits::destroy(allocator(), new_data + index + i);
+        }
+        alloc_traits::deallocate(allocator(), new_data, new_capacity);
+        throw;
       }
-      allocator.construct(&data_[0], std::move(value));
-      size_++;
+      if (data_) {
+        alloc_traits::deallocate(allocator(), data_, capacity_);
+      }
+      data_ = new_data;
+      capacity_ = detail::usable_capacity<GrowthPolicy>(allocator(), new_data, new_capacity);
+      size_ += count;
     }
 
-    template<typename T>
-    void constexpr vector<T>::clear() noexcept {
-      for(int i = 0; i < size_; ++i){
-        allocator.destroy(&data_[i]);
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::insert_trivial(size_t index, const T* source, size_t count) {
+      if (count == 0) {
+        return;
+      }
+      if (contains_address(source)) {
+        // The source would move under us, so copy it out first.
+        vector<T, Allocator, GrowthPolicy> buffer(allocator());
+        buffer.insert_trivial(0, source, count);
+        insert_trivial(index, buffer.data_, count);
+        return;
+      }
+      if (size_ + count > capacity_) {
+        const size_t new_capacity = GrowthPolicy::next_capacity(capacity_, size_ + count, sizeof(T));
+        if constexpr (!detail::can_reallocate<Allocator, T>::value) {
+          T* new_data = alloc_traits::allocate(allocator(), new_capacity);
+          std::memcpy(static_cast<void*>(new_data + index), static_cast<const void*>(source), count * sizeof(T));
+          detail::relocate_with_gap(allocator(), data_, size_, new_data, index, count);
+          if (data_) {
+            alloc_traits::deallocate(allocator(), data_, capacity_);
+          }
+          data_ = new_data;
+          capacity_ = detail::usable_capacity<GrowthPolicy>(allocator(), new_data, new_capacity);
+          size_ += count;
+          return;
+        }
+        reserve(new_capacity);
+      }
+      if (index < size_) {
+        std::memmove(static_cast<void*>(data_ + index + count), static_cast<const void*>(data_ + index),
+                     (size_ - index) * sizeof(T));
       }
+      std::memcpy(static_cast<void*>(data_ + index), static_cast<const void*>(source), count * sizeof(T));
+      size_ += count;
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    template<typename Construct>
+    void vector<T, Allocator, GrowthPolicy>::construct_at_end(size_t count, Construct&& construct) {
+      detail::construct_n(allocator(), data_ + size_, count, construct);
+      size_ += count;
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    template<typename InputIt, typename>
+    void vector<T, Allocator, GrowthPolicy>::append(InputIt first, InputIt last) {
+      insert(size_, first, last);
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::append(std::initializer_list<T> init) {
+      insert(size_, init.begin(), init.end());
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    template<typename InputIt, typename>
+    void vector<T, Allocator, GrowthPolicy>::insert(size_t index, InputIt first, InputIt last) {
+      if (index > size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      if constexpr (detail::is_contiguous_iterator<InputIt>::value && !std::is_pointer<InputIt>::value) {
+        insert(index, detail::to_address(first), detail::to_address(last));
+        return;
+      }
+      if constexpr (std::is_pointer<InputIt>::value) {
+        using source_type = std::remove_cv_t<std::remove_pointer_t<InputIt>>;
+        if constexpr (std::is_same<source_type, T>::value) {
+          if constexpr (std::is_trivially_copyable<T>::value) {
+            insert_trivial(index, first, static_cast<size_t>(last - first));
+            return;
+          } else if (first != last && contains_address(first)) {
+            // Shifting the tail would move the source, so copy it out first.
+            vector<T, Allocator, GrowthPolicy> buffer(first, last, allocator());
+            insert(index, std::make_move_iterator(buffer.data_), std::make_move_iterator(buffer.data_ + buffer.size_));
+            return;
+          }
+        }
+      }
+      if constexpr (detail::is_forward_iterator_v<InputIt>) {
+        insert_n(index, static_cast<size_t>(std::distance(first, last)), [&](T* slot) {
+          alloc_traits::construct(allocator(), slot, *first);
+          ++first;
+        });
+      } else if (index == size_) {
+        for (; first != last; ++first) {
+          emplace_back(*first);
+        }
+      } else {
+        // A single-pass range cannot be measured, so collect it before shifting the tail.
+        vector<T, Allocator, GrowthPolicy> buffer(first, last, allocator());
+        insert(index, std::make_move_iterator(buffer.data_), std::make_move_iterator(buffer.data_ + buffer.size_));
+      }
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::insert(size_t index, size_t count, const T& value) {
+      if (index > size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      if (contains_address(&value)) {
+        const T copy(value);
+        insert(index, count, copy);
+        return;
+      }
+      insert_n(index, count, [&](T* slot) {
+        alloc_traits::construct(allocator(), slot, value);
+      });
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::insert(size_t index, std::initializer_list<T> init) {
+      insert(index, init.begin(), init.end());
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::assign(size_t count, const T& value) {
+      if (contains_address(&value)) {
+        const T copy(value);
+        assign(count, copy);
+        return;
+      }
+      clear();
+      if (count > capacity_) {
+        clear_and_free();
+        reserve(count);
+      }
+      insert_n(0, count, [&](T* slot) {
+        alloc_traits::construct(allocator(), slot, value);
+      });
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    template<typename InputIt, typename>
+    void vector<T, Allocator, GrowthPolicy>::assign(InputIt first, InputIt last) {
+      if constexpr (detail::is_contiguous_iterator<InputIt>::value && !std::is_pointer<InputIt>::value) {
+        assign(detail::to_address(first), detail::to_address(last));
+        return;
+      }
+      if constexpr (std::is_pointer<InputIt>::value) {
+        if constexpr (std::is_same<std::remove_cv_t<std::remove_pointer_t<InputIt>>, T>::value) {
+          if (first != last && contains_address(first)) {
+            vector<T, Allocator, GrowthPolicy> buffer(first, last, allocator());
+            assign(std::make_move_iterator(buffer.data_), std::make_move_iterator(buffer.data_ + buffer.size_));
+            return;
+          }
+        }
+      }
+      clear();
+      if constexpr (detail::is_forward_iterator_v<InputIt>) {
+        const size_t count = static_cast<size_t>(std::distance(first, last));
+        if (count > capacity_) {
+          clear_and_free();
+          reserve(count);
+        }
+      }
+      insert(0, first, last);
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::assign(std::initializer_list<T> init) {
+      assign(init.begin(), init.end());
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::push_back(const T& value) {
+      emplace_back(value);
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::push_back(T&& value) {
+      emplace_back(std::move(value));
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::push_front(const T& value) {
+      emplace_front(value);
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::push_front(T&& value) {
+      emplace_front(std::move(value));
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::clear() noexcept {
+      for(size_t i = 0; i < size_; ++i){
+        alloc_traits::destroy(allocator(), &data_[i]);
+      }
+      size_ = 0;
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::clear_and_free() noexcept {
+      destroy_and_deallocate();
       size_ = 0;
-      shrink_to_fit();
+      capacity_ = 0;
+      data_ = nullptr;
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::reset(size_t min_capacity) {
+      clear();
+      ensure_capacity(min_capacity);
     }
 
-    template<typename T>
-    void vector<T>::swap(vector& other) noexcept {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::swap(vector& other) noexcept {
+      if constexpr (alloc_traits::propagate_on_container_swap::value) {
+        using std::swap;
+        swap(allocator(), other.allocator());
+      }
       std::swap(size_, other.size_);
       std::swap(capacity_, other.capacity_);
       std::swap(data_, other.data_);
     }
 
-    template<typename T>
-    T& vector<T>::at(size_t index) {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    typename vector<T, Allocator, GrowthPolicy>::allocator_type vector<T, Allocator, GrowthPolicy>::get_allocator() const noexcept {
+      return allocator();
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    T& vector<T, Allocator, GrowthPolicy>::at(size_t index) {
       if (index >= size_) {
         throw std::out_of_range("Index out of range");
       }
       return data_[index];
     }
 
-    template<typename T>
-    const T& vector<T>::at(size_t index) const {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    const T& vector<T, Allocator, GrowthPolicy>::at(size_t index) const {
       if (index >= size_) {
         throw std::out_of_range("Index out of range");
       }
       return data_[index];
     }
 
-    template<typename T>
-    T& vector<T>::front() {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    T& vector<T, Allocator, GrowthPolicy>::front() {
       if (is_empty()) {
         throw std::out_of_range("Vector is empty");
       }
       return data_[0];
     }
 
-    template<typename T>
-    const T& vector<T>::front() const {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    const T& vector<T, Allocator, GrowthPolicy>::front() const {
       if (is_empty()) {
         throw std::out_of_range("Vector is empty");
       }
       return data_[0];
     }
 
-    template<typename T>
-    T& vector<T>::back() {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    T& vector<T, Allocator, GrowthPolicy>::back() {
       if (is_empty()) {
         throw std::out_of_range("Vector is empty");
       }
       return data_[size_ - 1];
     }
 
-    template<typename T>
-    const T& vector<T>::back() const {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    const T& vector<T, Allocator, GrowthPolicy>::back() const {
       if (is_empty()) {
         throw std::out_of_range("Vector is empty");
       }
       return data_[size_ - 1];
     }
 
-    template<typename T>
-    void vector<T>::pop_back() {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::pop_back() {
       if (is_empty()) {
         throw std::out_of_range("Vector is empty");
       }
-      allocator.destroy(&data_[--size_]);
+      alloc_traits::destroy(allocator(), &data_[--size_]);
     }
 
-    template<typename T>
-    void vector<T>::pop_front() {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::pop_front() {
       if (is_empty()) {
         throw std::out_of_range("Vector is empty");
       }
-      allocator.destroy(&data_[0]);
-      for (size_t i = 1; i < size_; ++i) {
-        data_[i - 1] = std::move(data_[i]);
+      erase(0, 1);
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::erase(size_t index) {
+      if (index >= size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      erase(index, index + 1);
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::erase(size_t first, size_t last) {
+      if (first > last || last > size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      if (first == last) {
+        return;
+      }
+      if constexpr (detail::is_nothrow_relocatable_v<T>) {
+        for (size_t i = first; i < last; ++i) {
+          alloc_traits::destroy(allocator(), &data_[i]);
+        }
+        detail::relocate_within(allocator(), data_ + last, size_ - last, data_ + first);
+        size_ -= last - first;
+      } else {
+        std::move(data_ + last, data_ + size_, data_ + first);
+        for (size_t i = size_ - (last - first); i < size_; ++i) {
+          alloc_traits::destroy(allocator(), &data_[i]);
+        }
+        size_ -= last - first;
+      }
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    typename vector<T, Allocator, GrowthPolicy>::iterator vector<T, Allocator, GrowthPolicy>::erase(const_iterator pos) {
+      const size_t index = static_cast<size_t>(pos - cbegin());
+      erase(index);
+      return iterator(data_ + index);
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    typename vector<T, Allocator, GrowthPolicy>::iterator vector<T, Allocator, GrowthPolicy>::erase(const_iterator first, const_iterator last) {
+      const size_t index = static_cast<size_t>(first - cbegin());
+      erase(index, static_cast<size_t>(last - cbegin()));
+      return iterator(data_ + index);
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::swap_erase(size_t index) {
+      if (index >= size_) {
+        throw std::out_of_range("Index out of range");
+      }
+      if (index != size_ - 1) {
+        data_[index] = std::move(data_[size_ - 1]);
+      }
+      alloc_traits::destroy(allocator(), &data_[--size_]);
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy, typename Pred>
+    size_t erase_if(vector<T, Allocator, GrowthPolicy>& vec, Pred pred) {
+      T* data = vec.data();
+      const size_t size = vec.size();
+      size_t kept;
+      if constexpr (std::is_arithmetic<T>::value) {
+        kept = detail::simd::compact_if(data, size, pred);
+      } else {
+        kept = static_cast<size_t>(std::remove_if(data, data + size, pred) - data);
       }
-      --size_;
+      vec.erase(kept, size);
+      return size - kept;
     }
 
-    template<typename T>
-    void vector<T>::resize(size_t new_size) {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::resize(size_t new_size) {
       if (new_size > capacity_) {
-        reserve(new_size);
+        grow(new_size);
       }
       for (size_t i = size_; i < new_size; ++i) {
-        allocator.construct(&data_[i]);
+        alloc_traits::construct(allocator(), &data_[i]);
       }
       for (size_t i = new_size; i < size_; ++i) {
-        allocator.destroy(&data_[i]);
+        alloc_traits::destroy(allocator(), &data_[i]);
       }
       size_ = new_size;
     }
 
-    template<typename T>
-    void vector<T>::resize(size_t new_size, const T& value) {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::resize(size_t new_size, const T& value) {
       if (new_size > capacity_) {
-        reserve(new_size);
+        if (contains_address(&value)) {
+          // value would dangle once the elements move.
+          const T copy(value);
+          resize(new_size, copy);
+          return;
+        }
+        grow(new_size);
       }
-      for (size_t i = size_; i < new_size; ++i) {
-        allocator.construct(&data_[i], value);
+      if (new_size > size_) {
+        construct_at_end(new_size - size_, [this, &value](T* slot, size_t) {
+          alloc_traits::construct(allocator(), slot, value);
+        });
       }
       for (size_t i = new_size; i < size_; ++i) {
-        allocator.destroy(&data_[i]);
+        alloc_traits::destroy(allocator(), &data_[i]);
+      }
+      size_ = std::min(size_, new_size);
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::resize_for_overwrite(size_t new_size) {
+      static_assert(std::is_trivially_default_constructible<T>::value,
+                    "resize_for_overwrite leaves elements uninitialized, T must be trivially default-constructible");
+      if (new_size > capacity_) {
+        grow(new_size);
+      }
+      for (size_t i = new_size; i < size_; ++i) {
+        alloc_traits::destroy(allocator(), &data_[i]);
       }
       size_ = new_size;
     }
 
-    template<typename T>
-    void vector<T>::shrink_to_fit() {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    T* vector<T, Allocator, GrowthPolicy>::append_uninitialized(size_t count) {
+      static_assert(std::is_trivially_default_constructible<T>::value,
+                    "append_uninitialized leaves elements uninitialized, T must be trivially default-constructible");
+      if (count > capacity_ - size_) {
+        grow(size_ + count);
+      }
+      T* first = data_ + size_;
+      size_ += count;
+      return first;
+    }
+
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::shrink_to_fit() {
       if (size_ < capacity_) {
-        T* new_data = allocator.allocate(size_);
-        for (size_t i = 0; i < size_; ++i) {
-          allocator.construct(&new_data[i], std::move(data_[i]));
-          allocator.destroy(&data_[i]);
+        if constexpr (detail::can_reallocate<Allocator, T>::value) {
+          if (size_) {
+            data_ = allocator().reallocate(data_, capacity_, size_);
+            capacity_ = size_;
+            return;
+          }
+        }
+        T* new_data = size_ ? alloc_traits::allocate(allocator(), size_) : nullptr;
+        try {
+          detail::relocate(allocator(), data_, size_, new_data);
+        } catch (...) {
+          if (new_data) {
+            alloc_traits::deallocate(allocator(), new_data, size_);
+          }
+          throw;
         }
-        allocator.deallocate(data_, capacity_);
+        alloc_traits::deallocate(allocator(), data_, capacity_);
         data_ = new_data;
         capacity_ = size_;
       }
     }
 
-    template<typename T>
-    void vector<T>::trim_to_size() {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::trim_to_size() {
       if (capacity_ > size_) {
         shrink_to_fit();
       }
     }
 
-    template<typename T>
-    void vector<T>::ensure_capacity(size_t min_capacity) {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    void vector<T, Allocator, GrowthPolicy>::ensure_capacity(size_t min_capacity) {
       if (capacity_ < min_capacity) {
-        reserve(min_capacity);
+        grow(min_capacity);
       }
     }
 
-    template<typename T>
-    size_t vector<T>::size() const noexcept {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    size_t vector<T, Allocator, GrowthPolicy>::size() const noexcept {
       return size_;
     }
 
-    template<typename T>
-    size_t vector<T>::capacity() const noexcept {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    size_t vector<T, Allocator, GrowthPolicy>::capacity() const noexcept {
       return capacity_;
     }
 
-    template<typename T>
-    T* vector<T>::data() noexcept {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    T* vector<T, Allocator, GrowthPolicy>::data() noexcept {
       return data_;
     }
 
-    template<typename T>
-    const T* vector<T>::data() const noexcept {
+    template<typename T, typename Allocator, typename GrowthPolicy>
+    const T* vector<T, Allocator, GrowthPolicy>::data() const noexcept {
       return data_;
     }
 